@@ -20,6 +20,7 @@ function(tinyorm_sources out_headers out_sources)
     list(APPEND headers
         basegrammar.hpp
         concerns/countsqueries.hpp
+        concerns/detectsconcurrencyerrors.hpp
         concerns/detectslostconnections.hpp
         concerns/hasconnectionresolver.hpp
         concerns/logsqueries.hpp
@@ -36,7 +37,9 @@ function(tinyorm_sources out_headers out_sources)
         configurations/mysqlconfigurationparser.hpp
         configurations/postgresconfigurationparser.hpp
         configurations/sqliteconfigurationparser.hpp
+        connectors/circuitbreaker.hpp
         connectors/connectorinterface.hpp
+        connectors/hostselector.hpp
         connectors/mysqlconnector.hpp
         connectors/postgresconnector.hpp
         connectors/sqliteconnector.hpp
@@ -44,6 +47,10 @@ function(tinyorm_sources out_headers out_sources)
         databaseconnection.hpp
         databasemanager.hpp
         db.hpp
+        drivers/libpqdriver.hpp
+        drivers/sqlite3driver.hpp
+        exceptions/circuitbreakeropenerror.hpp
+        exceptions/connectionpooltimeouterror.hpp
         exceptions/domainerror.hpp
         exceptions/invalidargumenterror.hpp
         exceptions/invalidformaterror.hpp
@@ -52,7 +59,9 @@ function(tinyorm_sources out_headers out_sources)
         exceptions/lostconnectionerror.hpp
         exceptions/multiplerecordsfounderror.hpp
         exceptions/ormerror.hpp
+        exceptions/querycancelederror.hpp
         exceptions/queryerror.hpp
+        exceptions/querytimeouterror.hpp
         exceptions/recordsnotfounderror.hpp
         exceptions/runtimeerror.hpp
         exceptions/searchpathemptyerror.hpp
@@ -63,6 +72,7 @@ function(tinyorm_sources out_headers out_sources)
         macros/archdetect.hpp
         macros/commonnamespace.hpp
         macros/compilerdetect.hpp
+        macros/coroutines.hpp
         macros/export.hpp
         macros/export_common.hpp
         macros/likely.hpp
@@ -103,11 +113,21 @@ function(tinyorm_sources out_headers out_sources)
         schema/schematypes.hpp
         schema/sqliteschemabuilder.hpp
         sqliteconnection.hpp
+        support/asyncquery.hpp
+        support/connectionpool.hpp
         support/databaseconfiguration.hpp
         support/databaseconnectionsmap.hpp
+        support/keepalivescheduler.hpp
+        support/pooledconnection.hpp
+        support/querycancelhandle.hpp
+        support/scattergather.hpp
+        support/statementcache.hpp
+        types/connectionpoolstats.hpp
         types/log.hpp
         types/sqlquery.hpp
+        types/statementcachestats.hpp
         types/statementscounter.hpp
+        types/warmupresult.hpp
         utils/configuration.hpp
         utils/container.hpp
         utils/fs.hpp
@@ -177,6 +197,7 @@ function(tinyorm_sources out_headers out_sources)
     list(APPEND sources
         basegrammar.cpp
         concerns/countsqueries.cpp
+        concerns/detectsconcurrencyerrors.cpp
         concerns/detectslostconnections.cpp
         concerns/hasconnectionresolver.cpp
         concerns/logsqueries.cpp
@@ -188,14 +209,18 @@ function(tinyorm_sources out_headers out_sources)
         configurations/mysqlconfigurationparser.cpp
         configurations/postgresconfigurationparser.cpp
         configurations/sqliteconfigurationparser.cpp
+        connectors/circuitbreaker.cpp
         connectors/connectionfactory.cpp
         connectors/connector.cpp
+        connectors/hostselector.cpp
         connectors/mysqlconnector.cpp
         connectors/postgresconnector.cpp
         connectors/sqliteconnector.cpp
         databaseconnection.cpp
         databasemanager.cpp
         db.cpp
+        drivers/libpqdriver.cpp
+        drivers/sqlite3driver.cpp
         exceptions/logicerror.cpp
         exceptions/queryerror.cpp
         exceptions/runtimeerror.cpp
@@ -226,6 +251,12 @@ function(tinyorm_sources out_headers out_sources)
         schema/schemabuilder.cpp
         schema/sqliteschemabuilder.cpp
         sqliteconnection.cpp
+        support/asyncquery.cpp
+        support/connectionpool.cpp
+        support/keepalivescheduler.cpp
+        support/querycancelhandle.cpp
+        support/scattergather.cpp
+        support/statementcache.cpp
         types/sqlquery.cpp
         utils/configuration.cpp
         utils/fs.cpp
@@ -12,6 +12,7 @@ else: \
 headersList += \
     $$PWD/orm/basegrammar.hpp \
     $$PWD/orm/concerns/countsqueries.hpp \
+    $$PWD/orm/concerns/detectsconcurrencyerrors.hpp \
     $$PWD/orm/concerns/detectslostconnections.hpp \
     $$PWD/orm/concerns/hasconnectionresolver.hpp \
     $$PWD/orm/concerns/logsqueries.hpp \
@@ -26,9 +27,11 @@ headersList += \
     $$PWD/orm/configurations/postgresconfigurationparser.hpp \
     $$PWD/orm/configurations/sqliteconfigurationparser.hpp \
     $$PWD/orm/connectionresolverinterface.hpp \
+    $$PWD/orm/connectors/circuitbreaker.hpp \
     $$PWD/orm/connectors/connectionfactory.hpp \
     $$PWD/orm/connectors/connector.hpp \
     $$PWD/orm/connectors/connectorinterface.hpp \
+    $$PWD/orm/connectors/hostselector.hpp \
     $$PWD/orm/connectors/mysqlconnector.hpp \
     $$PWD/orm/connectors/postgresconnector.hpp \
     $$PWD/orm/connectors/sqliteconnector.hpp \
@@ -36,6 +39,10 @@ headersList += \
     $$PWD/orm/databaseconnection.hpp \
     $$PWD/orm/databasemanager.hpp \
     $$PWD/orm/db.hpp \
+    $$PWD/orm/drivers/libpqdriver.hpp \
+    $$PWD/orm/drivers/sqlite3driver.hpp \
+    $$PWD/orm/exceptions/circuitbreakeropenerror.hpp \
+    $$PWD/orm/exceptions/connectionpooltimeouterror.hpp \
     $$PWD/orm/exceptions/domainerror.hpp \
     $$PWD/orm/exceptions/invalidargumenterror.hpp \
     $$PWD/orm/exceptions/invalidformaterror.hpp \
@@ -44,7 +51,9 @@ headersList += \
     $$PWD/orm/exceptions/lostconnectionerror.hpp \
     $$PWD/orm/exceptions/multiplerecordsfounderror.hpp \
     $$PWD/orm/exceptions/ormerror.hpp \
+    $$PWD/orm/exceptions/querycancelederror.hpp \
     $$PWD/orm/exceptions/queryerror.hpp \
+    $$PWD/orm/exceptions/querytimeouterror.hpp \
     $$PWD/orm/exceptions/recordsnotfounderror.hpp \
     $$PWD/orm/exceptions/runtimeerror.hpp \
     $$PWD/orm/exceptions/searchpathemptyerror.hpp \
@@ -55,6 +64,7 @@ headersList += \
     $$PWD/orm/macros/archdetect.hpp \
     $$PWD/orm/macros/commonnamespace.hpp \
     $$PWD/orm/macros/compilerdetect.hpp \
+    $$PWD/orm/macros/coroutines.hpp \
     $$PWD/orm/macros/export.hpp \
     $$PWD/orm/macros/export_common.hpp \
     $$PWD/orm/macros/likely.hpp \
@@ -95,11 +105,21 @@ headersList += \
     $$PWD/orm/schema/schematypes.hpp \
     $$PWD/orm/schema/sqliteschemabuilder.hpp \
     $$PWD/orm/sqliteconnection.hpp \
+    $$PWD/orm/support/asyncquery.hpp \
+    $$PWD/orm/support/connectionpool.hpp \
     $$PWD/orm/support/databaseconfiguration.hpp \
     $$PWD/orm/support/databaseconnectionsmap.hpp \
+    $$PWD/orm/support/keepalivescheduler.hpp \
+    $$PWD/orm/support/pooledconnection.hpp \
+    $$PWD/orm/support/querycancelhandle.hpp \
+    $$PWD/orm/support/scattergather.hpp \
+    $$PWD/orm/support/statementcache.hpp \
+    $$PWD/orm/types/connectionpoolstats.hpp \
     $$PWD/orm/types/log.hpp \
     $$PWD/orm/types/sqlquery.hpp \
+    $$PWD/orm/types/statementcachestats.hpp \
     $$PWD/orm/types/statementscounter.hpp \
+    $$PWD/orm/types/warmupresult.hpp \
     $$PWD/orm/utils/configuration.hpp \
     $$PWD/orm/utils/container.hpp \
     $$PWD/orm/utils/fs.hpp \
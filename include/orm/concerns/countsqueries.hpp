@@ -27,7 +27,7 @@ namespace Concerns
     {
         Q_DISABLE_COPY(CountsQueries)
 
-        // To access hitTransactionalCounters() method
+        // To access hitTransactionalCounters() and hitRetriedCounter() methods
         friend class ManagesTransactions;
 
     public:
@@ -81,6 +81,8 @@ namespace Concerns
         /*! Count transactional queries execution time and statements counter. */
         std::optional<qint64>
         hitTransactionalCounters(QElapsedTimer timer, bool countElapsed);
+        /*! Count the re-run transaction. */
+        void hitRetriedCounter();
 
         /*! Dynamic cast *this to the DatabaseConnection & derived type. */
         DatabaseConnection &databaseConnection();
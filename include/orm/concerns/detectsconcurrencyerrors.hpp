@@ -0,0 +1,56 @@
+#pragma once
+#ifndef ORM_CONCERNS_DETECTSCONCURRENCYERRORS_HPP
+#define ORM_CONCERNS_DETECTSCONCURRENCYERRORS_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QtGlobal>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+class QSqlError;
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+
+namespace Exceptions
+{
+    class SqlError;
+}
+
+namespace Concerns
+{
+
+    /*! Detect deadlocks and serialization failures, the transaction can be re-run. */
+    class SHAREDLIB_EXPORT DetectsConcurrencyErrors
+    {
+        Q_DISABLE_COPY(DetectsConcurrencyErrors)
+
+    public:
+        /*! Default constructor. */
+        inline DetectsConcurrencyErrors() = default;
+        /*! Pure virtual destructor, to pass -Weffc++. */
+        inline virtual ~DetectsConcurrencyErrors() = 0;
+
+        /*! Determine if the given exception was caused by a concurrency error such as
+            a deadlock or serialization failure. */
+        static bool causedByConcurrencyError(const Exceptions::SqlError &e);
+        /*! Determine if the given exception was caused by a concurrency error such as
+            a deadlock or serialization failure. */
+        static bool causedByConcurrencyError(const QSqlError &e);
+    };
+
+    /* public */
+
+    DetectsConcurrencyErrors::~DetectsConcurrencyErrors() = default;
+
+} // namespace Concerns
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_CONCERNS_DETECTSCONCURRENCYERRORS_HPP
@@ -46,6 +46,11 @@ namespace Concerns
         void logQueryForPretend(const QString &query,
                                 const QVector<QVariant> &preparedBindings,
                                 const QString &type) const;
+        /*! Log a query executed without the QSqlQuery (batch, COPY) into
+            the connection's query log. */
+        void logDirectQuery(const QString &query,
+                            const QVector<QVariant> &preparedBindings,
+                            std::optional<qint64> elapsed, int affected) const;
         /*! Log a transaction query into the connection's query log. */
         void logTransactionQuery(const QString &query,
                                  std::optional<qint64> elapsed) const;
@@ -7,6 +7,10 @@ TINY_SYSTEM_HEADER
 
 #include <QString>
 
+#include <chrono>
+#include <exception>
+#include <functional>
+
 #include "orm/macros/commonnamespace.hpp"
 #include "orm/macros/export.hpp"
 
@@ -25,7 +29,6 @@ namespace Concerns
 
     class CountsQueries;
 
-    // TODO next transaction method with callback silverqx
     // TODO rewrite transactions, look at beginTransaction(), commit(), ... whats up, you will see immediately 😎 silverqx
     /*! Manages database transactions. */
     class SHAREDLIB_EXPORT ManagesTransactions
@@ -43,6 +46,14 @@ namespace Concerns
         /*! Pure virtual destructor, to pass -Weffc++. */
         inline virtual ~ManagesTransactions() = 0;
 
+        /*! Execute the callback within a transaction, commits on success and rolls
+            back on exception, re-runs the callback after a deadlock or serialization
+            failure with the exponential backoff (with jitter). */
+        void transaction(const std::function<void(DatabaseConnection &)> &callback,
+                         int attempts = 1,
+                         std::chrono::milliseconds backoff =
+                             std::chrono::milliseconds(10));
+
         /*! Start a new database transaction. */
         bool beginTransaction();
         /*! Commit the active database transaction. */
@@ -69,6 +80,17 @@ namespace Concerns
         DatabaseConnection &setSavepointNamespace(const QString &savepointNamespace);
 
     private:
+        /*! Execute the callback within a savepoint of the active transaction. */
+        void transactionInSavepoint(
+                const std::function<void(DatabaseConnection &)> &callback);
+        /*! Roll back the transaction after the failed callback or commit (if still
+            active), returns whether the transaction can be re-run. */
+        bool rollBackAndShouldRetry(const std::exception_ptr &ePtr, int currentAttempt,
+                                    int attempts);
+        /*! Sleep before the next attempt (exponential backoff with jitter). */
+        static void sleepBeforeRetry(std::chrono::milliseconds backoff,
+                                     int currentAttempt);
+
         /*! Reset in transaction state and savepoints. */
         DatabaseConnection &resetTransactions();
 
@@ -0,0 +1,200 @@
+#pragma once
+#ifndef ORM_CONNECTORS_CIRCUITBREAKER_HPP
+#define ORM_CONNECTORS_CIRCUITBREAKER_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QVariantHash>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Connectors
+{
+
+    /*! State of the circuit breaker. */
+    enum struct CircuitState
+    {
+        Closed,   // Queries are executed normally
+        Open,     // Queries fail fast without touching the database
+        HalfOpen, // One probe query tests whether the database has recovered
+    };
+
+    /*! Circuit breaker statistics (state transitions and rejected queries). */
+    struct CircuitBreakerStats
+    {
+        /*! The current state. */
+        CircuitState state = CircuitState::Closed;
+        /*! Number of connection failures since the last successful query. */
+        std::size_t consecutiveFailures = 0;
+        /*! Number of transitions to the open state. */
+        std::size_t opened = 0;
+        /*! Number of transitions to the half-open state (probes). */
+        std::size_t halfOpened = 0;
+        /*! Number of transitions back to the closed state (recoveries). */
+        std::size_t closed = 0;
+        /*! Number of queries that failed fast because the circuit was open. */
+        std::size_t rejected = 0;
+    };
+
+    /*! Circuit breaker around the lost connection reconnect logic, it's shared by all
+        connections and threads with the same connection name. After
+        the circuit_threshold consecutive connection failures the circuit opens and
+        queries fail fast for the circuit_open_time, then one probe query is let
+        through to test whether the database has recovered. */
+    class SHAREDLIB_EXPORT CircuitBreaker
+    {
+        Q_DISABLE_COPY_MOVE(CircuitBreaker)
+
+    public:
+        /*! Constructor. */
+        CircuitBreaker(QString connection, std::size_t threshold,
+                       std::chrono::milliseconds openTime);
+        /*! Default destructor. */
+        inline ~CircuitBreaker() = default;
+
+        /*! Get the circuit breaker for the given connection name (process-wide),
+            returns nullptr if the circuit_threshold configuration option isn't set. */
+        static std::shared_ptr<CircuitBreaker>
+        forConnection(const QString &connection, const QVariantHash &config);
+        /*! Get the statistics of the circuit breaker for the given connection name. */
+        static std::optional<CircuitBreakerStats> stats(const QString &connection);
+        /*! Forget the circuit breaker for the given connection name (already created
+            connections keep theirs), called by the DatabaseManager::removeConnection(). */
+        static void remove(const QString &connection);
+
+        /*! Throw the CircuitBreakerOpenError if the circuit is open, the first call
+            after the circuit_open_time is let through as the half-open probe (returns
+            true), the probe without the result is replaced after the same time. */
+        bool acquire();
+        /*! Finish the half-open probe that has ended without the result, the next
+            query is let through as the probe. */
+        void release();
+        /*! Determine whether the lost connection can be reconnected (not open). */
+        inline bool allowsReconnect() const noexcept;
+
+        /*! Record a successful query, closes the circuit. */
+        void recordSuccess();
+        /*! Record a connection failure, opens the circuit after the threshold. */
+        void recordFailure();
+
+        /*! Get the current state. */
+        inline CircuitState state() const noexcept;
+        /*! Get the statistics. */
+        CircuitBreakerStats stats() const;
+
+        /*! Get the threshold from the circuit_threshold configuration option. */
+        static std::size_t threshold(const QVariantHash &config);
+        /*! Get the open time from the circuit_open_time configuration option. */
+        static std::chrono::milliseconds openTime(const QVariantHash &config);
+
+    private:
+        /*! Transition to the given state, the mutex has to be locked. */
+        void transitionTo(CircuitState state);
+
+        /*! The connection name (for log messages). */
+        QString m_connection;
+        /*! Number of consecutive failures that open the circuit. */
+        std::size_t m_threshold;
+        /*! How long the circuit stays open before the probe. */
+        std::chrono::milliseconds m_openTime;
+
+        /*! The current state (lock-free check on the query hot path). */
+        std::atomic<CircuitState> m_state = CircuitState::Closed;
+        /*! Determine whether there are failures to reset (lock-free check). */
+        std::atomic<bool> m_hasFailures = false;
+
+        /*! Mutex that guards the members below. */
+        mutable std::mutex m_mutex;
+        /*! The circuit stays open until this time point. */
+        std::chrono::steady_clock::time_point m_openUntil {};
+        /*! Determine whether the half-open probe is running. */
+        bool m_probing = false;
+        /*! The running probe is replaced by the next query after this time point. */
+        std::chrono::steady_clock::time_point m_probeUntil {};
+        /*! The statistics. */
+        CircuitBreakerStats m_stats {};
+    };
+
+    /*! RAII guard around one query protected by the circuit breaker, acquires
+        the circuit in the constructor and releases the half-open probe in
+        the destructor if its result wasn't recorded (eg. if the query setup threw). */
+    class CircuitBreakerGuard
+    {
+        Q_DISABLE_COPY_MOVE(CircuitBreakerGuard)
+
+    public:
+        /*! Constructor, throws the CircuitBreakerOpenError if the circuit is open,
+            the nullptr circuit breaker (disabled) does nothing. */
+        inline explicit CircuitBreakerGuard(CircuitBreaker *circuitBreaker);
+        /*! Destructor, releases the unfinished half-open probe. */
+        inline ~CircuitBreakerGuard();
+
+        /*! Record a successful query, closes the circuit. */
+        inline void recordSuccess();
+        /*! Record a connection failure, opens the circuit after the threshold. */
+        inline void recordFailure();
+
+    private:
+        /*! The circuit breaker, nullptr if disabled or if the result was recorded. */
+        CircuitBreaker *m_circuitBreaker;
+        /*! Determine whether this query is the half-open probe. */
+        bool m_probe;
+    };
+
+    /* CircuitBreaker */
+
+    /* public */
+
+    bool CircuitBreaker::allowsReconnect() const noexcept
+    {
+        return m_state.load(std::memory_order_acquire) != CircuitState::Open;
+    }
+
+    CircuitState CircuitBreaker::state() const noexcept
+    {
+        return m_state.load(std::memory_order_acquire);
+    }
+
+    /* CircuitBreakerGuard */
+
+    /* public */
+
+    CircuitBreakerGuard::CircuitBreakerGuard(CircuitBreaker *const circuitBreaker)
+        : m_circuitBreaker(circuitBreaker)
+        , m_probe(circuitBreaker != nullptr && circuitBreaker->acquire())
+    {}
+
+    CircuitBreakerGuard::~CircuitBreakerGuard()
+    {
+        if (m_circuitBreaker != nullptr && m_probe)
+            m_circuitBreaker->release();
+    }
+
+    void CircuitBreakerGuard::recordSuccess()
+    {
+        if (m_circuitBreaker != nullptr)
+            std::exchange(m_circuitBreaker, nullptr)->recordSuccess();
+    }
+
+    void CircuitBreakerGuard::recordFailure()
+    {
+        if (m_circuitBreaker != nullptr)
+            std::exchange(m_circuitBreaker, nullptr)->recordFailure();
+    }
+
+} // namespace Orm::Connectors
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_CONNECTORS_CIRCUITBREAKER_HPP
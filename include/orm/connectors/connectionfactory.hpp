@@ -39,6 +39,9 @@ namespace Connectors
         static std::unique_ptr<ConnectorInterface>
         createConnector(const QVariantHash &config);
 
+        /*! Get the QSqlDatabase connection name of the read connection. */
+        static QString readConnectionName(const QString &connection);
+
     protected:
         /*! Parse and prepare the database configuration. */
         static QVariantHash
@@ -47,6 +50,21 @@ namespace Connectors
         /*! Create a single database connection  instance. */
         static std::shared_ptr<DatabaseConnection>
         createSingleConnection(QVariantHash &&config);
+        /*! Create a read/write database connection instance. */
+        static std::shared_ptr<DatabaseConnection>
+        createReadWriteConnection(QVariantHash &&config);
+
+        /*! Get the read configuration for a read/write connection. */
+        static QVariantHash getReadConfig(const QVariantHash &config);
+        /*! Get the write configuration for a read/write connection. */
+        static QVariantHash getWriteConfig(const QVariantHash &config);
+        /*! Get a read/write level configuration. */
+        static QVariantHash
+        getReadWriteConfig(const QVariantHash &config, const QString &type);
+        /*! Merge a configuration for a read/write connection. */
+        static QVariantHash
+        mergeReadWriteConfig(const QVariantHash &config, const QVariantHash &merge);
+
         /*! Create a new Closure that resolves to a QSqlDatabase instance
             ( only a connection name returned ). */
         static std::function<ConnectionName()>
@@ -0,0 +1,91 @@
+#pragma once
+#ifndef ORM_CONNCECTORS_HOSTSELECTOR_HPP
+#define ORM_CONNCECTORS_HOSTSELECTOR_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QStringList>
+#include <QVariantHash>
+
+#include <chrono>
+#include <optional>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Connectors
+{
+
+    /*! Strategy used to pick a host if multiple hosts are configured. */
+    enum struct HostStrategy
+    {
+        Sequential,    // Try hosts in the configured order (default)
+        Random,        // Try hosts in a random order
+        RoundRobin,    // Rotate the first tried host on every connect
+        LowestLatency, // Try the host with the lowest recent connect time first
+    };
+
+    /*! Health of the database host (shared by all connections and threads). */
+    struct HostHealth
+    {
+        /*! Number of successful connects. */
+        std::size_t successes = 0;
+        /*! Number of failed connects. */
+        std::size_t failures = 0;
+        /*! Number of failed connects since the last successful connect. */
+        std::size_t consecutiveFailures = 0;
+        /*! Moving average of the connect time in milliseconds (-1 if unknown). */
+        qint64 latency = -1;
+        /*! Determine whether the host is skipped because it failed recently. */
+        bool coolingDown = false;
+    };
+
+    /*! Orders the configured hosts by the host_strategy and tracks hosts health.
+        Hosts that failed recently are in the cool-down (host_cooldown configuration
+        option) and they are tried as the last ones. */
+    class SHAREDLIB_EXPORT HostSelector
+    {
+        Q_DISABLE_COPY_MOVE(HostSelector)
+
+    public:
+        /*! Deleted default constructor, this is a pure library class. */
+        HostSelector() = delete;
+        /*! Deleted destructor. */
+        ~HostSelector() = delete;
+
+        /*! Get the hosts in the order in which they should be tried. */
+        static QStringList orderHosts(const QStringList &hosts,
+                                      const QVariantHash &config);
+
+        /*! Record a successful connect to the given host. */
+        static void markSuccess(const QVariantHash &config, const QString &host,
+                                qint64 elapsed);
+        /*! Record a failed connect to the given host, starts its cool-down. */
+        static void markFailure(const QVariantHash &config, const QString &host);
+
+        /*! Get the health of the given host (std::nullopt if not connected yet). */
+        static std::optional<HostHealth>
+        health(const QVariantHash &config, const QString &host);
+        /*! Forget the health of all hosts. */
+        static void resetHealth();
+
+        /*! Get the host strategy from the host_strategy configuration option. */
+        static HostStrategy strategy(const QVariantHash &config);
+        /*! Get the cool-down from the host_cooldown configuration option. */
+        static std::chrono::milliseconds cooldown(const QVariantHash &config);
+
+    private:
+        /*! Get the key identifying the host in the health registry. */
+        static QString hostKey(const QVariantHash &config, const QString &host);
+        /*! Get the key identifying the hosts list for the round-robin strategy. */
+        static QString hostsKey(const QStringList &hosts, const QVariantHash &config);
+    };
+
+} // namespace Orm::Connectors
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_CONNCECTORS_HOSTSELECTOR_HPP
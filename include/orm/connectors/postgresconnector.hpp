@@ -36,6 +36,10 @@ namespace Orm::Connectors
         const QVariantHash &getConnectorOptions() const override;
 
     protected:
+        /*! Get the configuration with the native libpq driver if it's enabled
+            by the libpq_native configuration option. */
+        static QVariantHash nativeDriverConfig(const QVariantHash &config);
+
         /*! Set the connection transaction isolation level. */
         static void configureIsolationLevel(const QSqlDatabase &connection,
                                             const QVariantHash &config);
@@ -32,11 +32,27 @@ namespace Orm::Connectors
         const QVariantHash &getConnectorOptions() const override;
 
     protected:
+        /*! Get the configuration with the native sqlite3 driver if it's enabled
+            by the sqlite3_native configuration option. */
+        static QVariantHash nativeDriverConfig(const QVariantHash &config);
+
         /*! Set the connection foreign key constraints. */
         static void configureForeignKeyConstraints(const QSqlDatabase &connection,
                                                    const QVariantHash &config);
 
+        /*! Get the validated PRAGMA configuration options (name and value). */
+        static QVector<std::pair<QString, QString>>
+        getPragmas(const QVariantHash &config, bool isMemory);
+        /*! Set the PRAGMA tuning options (journal_mode, synchronous, ...). */
+        static void configurePragmas(const QSqlDatabase &connection,
+                                     const QVector<std::pair<QString, QString>> &pragmas,
+                                     bool isMemory);
+
     private:
+        /*! Validate and normalize the PRAGMA value, it's interpolated into
+            the query. */
+        static QString pragmaValue(const QString &option, const QVariant &value);
+
         /*! Check whether the SQLite database file exists. */
         static void checkDatabaseExists(const QVariantHash &config);
 
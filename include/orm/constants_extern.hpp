@@ -71,7 +71,9 @@ namespace Orm::Constants
     // Database related
     SHAREDLIB_EXPORT extern const QString QMYSQL;
     SHAREDLIB_EXPORT extern const QString QPSQL;
+    SHAREDLIB_EXPORT extern const QString QPSQL_LIBPQ;
     SHAREDLIB_EXPORT extern const QString QSQLITE;
+    SHAREDLIB_EXPORT extern const QString QSQLITE_LIB;
     SHAREDLIB_EXPORT extern const QString MYSQL_;
     SHAREDLIB_EXPORT extern const QString POSTGRESQL;
     SHAREDLIB_EXPORT extern const QString SQLITE;
@@ -113,11 +115,40 @@ namespace Orm::Constants
     SHAREDLIB_EXPORT extern const QString isolation_level;
     SHAREDLIB_EXPORT extern const QString foreign_key_constraints;
     SHAREDLIB_EXPORT extern const QString check_database_exists;
+    SHAREDLIB_EXPORT extern const QString journal_mode;
+    SHAREDLIB_EXPORT extern const QString synchronous;
+    SHAREDLIB_EXPORT extern const QString cache_size;
+    SHAREDLIB_EXPORT extern const QString mmap_size;
+    SHAREDLIB_EXPORT extern const QString temp_store;
+    SHAREDLIB_EXPORT extern const QString busy_timeout;
+    SHAREDLIB_EXPORT extern const QString query_only;
+    SHAREDLIB_EXPORT extern const QString wal_readers;
+    SHAREDLIB_EXPORT extern const QString in_array_threshold;
+    SHAREDLIB_EXPORT extern const QString max_bindings;
     SHAREDLIB_EXPORT extern const QString prefix_indexes;
     SHAREDLIB_EXPORT extern const QString return_qdatetime;
     SHAREDLIB_EXPORT extern const QString application_name;
     SHAREDLIB_EXPORT extern const QString synchronous_commit;
     SHAREDLIB_EXPORT extern const QString spatial_ref_sys;
+    SHAREDLIB_EXPORT extern const QString pool_min_size;
+    SHAREDLIB_EXPORT extern const QString pool_max_size;
+    SHAREDLIB_EXPORT extern const QString pool_acquire_timeout;
+    SHAREDLIB_EXPORT extern const QString pool_keepalive_interval;
+    SHAREDLIB_EXPORT extern const QString pool_max_idle_time;
+    SHAREDLIB_EXPORT extern const QString statement_cache_size;
+    SHAREDLIB_EXPORT extern const QString statement_timeout;
+    SHAREDLIB_EXPORT extern const QString read_;
+    SHAREDLIB_EXPORT extern const QString write_;
+    SHAREDLIB_EXPORT extern const QString sticky;
+    SHAREDLIB_EXPORT extern const QString max_replica_lag;
+    SHAREDLIB_EXPORT extern const QString replica_lag_interval;
+    SHAREDLIB_EXPORT extern const QString host_strategy;
+    SHAREDLIB_EXPORT extern const QString host_cooldown;
+    SHAREDLIB_EXPORT extern const QString circuit_threshold;
+    SHAREDLIB_EXPORT extern const QString circuit_open_time;
+    SHAREDLIB_EXPORT extern const QString libpq_native;
+    SHAREDLIB_EXPORT extern const QString sqlite3_native;
+    SHAREDLIB_EXPORT extern const QString warm_up_statements;
 
     SHAREDLIB_EXPORT extern const QString H127001;
     SHAREDLIB_EXPORT extern const QString LOCALHOST;
@@ -70,7 +70,9 @@ namespace Orm::Constants
     // Database related
     inline const QString QMYSQL       = QStringLiteral("QMYSQL");
     inline const QString QPSQL        = QStringLiteral("QPSQL");
+    inline const QString QPSQL_LIBPQ  = QStringLiteral("QPSQL_LIBPQ");
     inline const QString QSQLITE      = QStringLiteral("QSQLITE");
+    inline const QString QSQLITE_LIB  = QStringLiteral("QSQLITE_LIB");
     inline const QString MYSQL_       = QStringLiteral("MySQL");
     inline const QString POSTGRESQL   = QStringLiteral("PostgreSQL");
     inline const QString SQLITE       = QStringLiteral("SQLite");
@@ -116,6 +118,26 @@ namespace Orm::Constants
     inline const QString
     check_database_exists   = QStringLiteral("check_database_exists");
     inline const QString
+    journal_mode            = QStringLiteral("journal_mode");
+    inline const QString
+    synchronous             = QStringLiteral("synchronous");
+    inline const QString
+    cache_size              = QStringLiteral("cache_size");
+    inline const QString
+    mmap_size               = QStringLiteral("mmap_size");
+    inline const QString
+    temp_store              = QStringLiteral("temp_store");
+    inline const QString
+    busy_timeout            = QStringLiteral("busy_timeout");
+    inline const QString
+    query_only              = QStringLiteral("query_only");
+    inline const QString
+    wal_readers             = QStringLiteral("wal_readers");
+    inline const QString
+    in_array_threshold      = QStringLiteral("in_array_threshold");
+    inline const QString
+    max_bindings            = QStringLiteral("max_bindings");
+    inline const QString
     prefix_indexes          = QStringLiteral("prefix_indexes");
     inline const QString
     return_qdatetime        = QStringLiteral("return_qdatetime");
@@ -125,6 +147,44 @@ namespace Orm::Constants
     synchronous_commit      = QStringLiteral("synchronous_commit");
     inline const QString
     spatial_ref_sys         = QStringLiteral("spatial_ref_sys");
+    inline const QString
+    pool_min_size           = QStringLiteral("pool_min_size");
+    inline const QString
+    pool_max_size           = QStringLiteral("pool_max_size");
+    inline const QString
+    pool_acquire_timeout    = QStringLiteral("pool_acquire_timeout");
+    inline const QString
+    pool_keepalive_interval = QStringLiteral("pool_keepalive_interval");
+    inline const QString
+    pool_max_idle_time      = QStringLiteral("pool_max_idle_time");
+    inline const QString
+    statement_cache_size    = QStringLiteral("statement_cache_size");
+    inline const QString
+    statement_timeout       = QStringLiteral("statement_timeout");
+    inline const QString
+    read_                   = QStringLiteral("read");
+    inline const QString
+    write_                  = QStringLiteral("write");
+    inline const QString
+    sticky                  = QStringLiteral("sticky");
+    inline const QString
+    max_replica_lag         = QStringLiteral("max_replica_lag");
+    inline const QString
+    replica_lag_interval    = QStringLiteral("replica_lag_interval");
+    inline const QString
+    host_strategy           = QStringLiteral("host_strategy");
+    inline const QString
+    host_cooldown           = QStringLiteral("host_cooldown");
+    inline const QString
+    circuit_threshold       = QStringLiteral("circuit_threshold");
+    inline const QString
+    circuit_open_time       = QStringLiteral("circuit_open_time");
+    inline const QString
+    libpq_native            = QStringLiteral("libpq_native");
+    inline const QString
+    sqlite3_native          = QStringLiteral("sqlite3_native");
+    inline const QString
+    warm_up_statements      = QStringLiteral("warm_up_statements");
 
     inline const QString H127001   = QStringLiteral("127.0.0.1");
     inline const QString LOCALHOST = QStringLiteral("localhost");
@@ -5,18 +5,26 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <QtSql/QSqlDatabase>
+
 #include "orm/concerns/countsqueries.hpp"
+#include "orm/concerns/detectsconcurrencyerrors.hpp"
 #include "orm/concerns/detectslostconnections.hpp"
 #include "orm/concerns/logsqueries.hpp"
 #include "orm/concerns/managestransactions.hpp"
+#include "orm/connectors/circuitbreaker.hpp"
 #include "orm/connectors/connectorinterface.hpp"
 #include "orm/exceptions/queryerror.hpp"
 #include "orm/query/grammars/grammar.hpp"
 #include "orm/query/processors/processor.hpp"
 #include "orm/schema/grammars/schemagrammar.hpp"
 #include "orm/schema/schemabuilder.hpp"
+#include "orm/support/querycancelhandle.hpp"
+#include "orm/support/statementcache.hpp"
 #include "orm/types/sqlquery.hpp"
 
+class QThread;
+
 TINYORM_BEGIN_COMMON_NAMESPACE
 
 namespace Orm
@@ -45,6 +53,7 @@ namespace Orm
         detected. */
     class SHAREDLIB_EXPORT DatabaseConnection :
             public Concerns::DetectsLostConnections,
+            public Concerns::DetectsConcurrencyErrors,
             public Concerns::ManagesTransactions,
             public Concerns::LogsQueries,
             public Concerns::CountsQueries,
@@ -79,6 +88,10 @@ namespace Orm
                 QVariantHash &&config = {});
 
     public:
+        /*! Default interval of the replication lag measurements. */
+        constexpr static std::chrono::milliseconds
+        DefaultReplicaLagInterval = std::chrono::milliseconds(1000);
+
         /*! Pure virtual destructor. */
         inline ~DatabaseConnection() override = 0;
 
@@ -104,18 +117,27 @@ namespace Orm
         /* Running SQL Queries */
         /*! Run a select statement against the database. */
         SqlQuery
-        select(const QString &queryString, QVector<QVariant> bindings = {});
+        select(const QString &queryString, QVector<QVariant> bindings = {},
+               bool useReadConnection = true);
         /*! Run a select statement against the database. */
         inline SqlQuery
         selectFromWriteConnection(const QString &queryString,
                                   QVector<QVariant> bindings = {});
 
+        /*! Run a select statement and return the forward-only result, rows can be
+            read only once from the first to the last one (constant memory usage). */
+        SqlQuery
+        cursor(const QString &queryString, QVector<QVariant> bindings = {},
+               bool useReadConnection = true);
+
         /*! Run a select statement and return a single result. */
         SqlQuery
-        selectOne(const QString &queryString, QVector<QVariant> bindings = {});
+        selectOne(const QString &queryString, QVector<QVariant> bindings = {},
+                  bool useReadConnection = true);
         /*! Run a select statement and return the first column of the first row. */
         QVariant
-        scalar(const QString &queryString, QVector<QVariant> bindings = {});
+        scalar(const QString &queryString, QVector<QVariant> bindings = {},
+               bool useReadConnection = true);
 
         /*! Run an insert statement against the database. */
         inline SqlQuery
@@ -137,6 +159,10 @@ namespace Orm
         /*! Run a raw, unprepared query against the database (good for DDL queries). */
         SqlQuery unprepared(const QString &queryString);
 
+        /*! Run the independent statements in as few round trips as the driver allows
+            and get the number of rows affected by every statement. */
+        QVector<int> batch(const QVector<BatchStatement> &statements);
+
         /* Obtain connection instance */
         /*! Get underlying database connection (QSqlDatabase). */
         QSqlDatabase getQtConnection();
@@ -149,6 +175,18 @@ namespace Orm
         DatabaseConnection &setQtConnectionResolver(
                 const std::function<Connectors::ConnectionName()> &resolver);
 
+        /*! Get underlying database connection used for the select queries (QSqlDatabase),
+            returns the write connection if the read connection can't be used. */
+        QSqlDatabase getReadQtConnection();
+        /*! Get the connection resolver for an underlying read database connection. */
+        inline const std::function<Connectors::ConnectionName()> &
+        getReadQtConnectionResolver() const noexcept;
+        /*! Set the connection resolver for an underlying read database connection. */
+        DatabaseConnection &setReadQtConnectionResolver(
+                const std::function<Connectors::ConnectionName()> &resolver);
+        /*! Determine whether the connection has a separate read connection. */
+        inline bool hasReadConnection() const noexcept;
+
         /*! Get a new QSqlQuery instance for the current connection. */
         QSqlQuery getQtQuery();
 
@@ -177,6 +215,12 @@ namespace Orm
         /*! Disconnect from the underlying Qt's connection. */
         void disconnect();
 
+        /*! Detach the underlying QSqlDriver from the current thread, so it can be
+            acquired by another thread (used by the ConnectionPool). */
+        void releaseThreadAffinity();
+        /*! Move the previously detached QSqlDriver to the current thread. */
+        void acquireThreadAffinity();
+
         /*! Get the query grammar used by the connection. */
         inline const QueryGrammar &getQueryGrammar() const noexcept;
         /*! Get the query grammar used by the connection. */
@@ -196,6 +240,66 @@ namespace Orm
         /*! Set the reconnect instance on the connection. */
         DatabaseConnection &setReconnector(const ReconnectorType &reconnector);
 
+        /* Prepared statement cache */
+        /*! Get the maximum number of cached prepared statements. */
+        inline std::size_t getStatementCacheSize() const noexcept;
+        /*! Set the maximum number of cached prepared statements (0 disables it). */
+        DatabaseConnection &setStatementCacheSize(std::size_t size);
+        /*! Remove all cached prepared statements. */
+        void clearStatementCache();
+        /*! Prepare the given statements and put them to the prepared statement cache,
+            returns the number of successfully prepared statements (does nothing
+            and returns 0 if the statement_cache_size is 0). */
+        std::size_t prepareStatements(const QStringList &queryStrings);
+        /*! Get the prepared statement cache statistics. */
+        StatementCacheStats statementCacheStats() const;
+        /*! Reset the prepared statement cache hits, misses, and evictions. */
+        void resetStatementCacheStats() noexcept;
+
+        /* Statement timeout and cancellation */
+        /*! Get the default statement timeout (std::nullopt for the server default). */
+        inline const std::optional<std::chrono::milliseconds> &
+        getStatementTimeout() const noexcept;
+        /*! Set the default statement timeout (std::nullopt for the server default). */
+        DatabaseConnection &
+        setStatementTimeout(std::optional<std::chrono::milliseconds> timeout) noexcept;
+        /*! Execute the callback with the given statement timeout, used by
+            the Builder::timeout(). */
+        SqlQuery withStatementTimeout(std::chrono::milliseconds timeout,
+                                      const std::function<SqlQuery()> &callback);
+        /*! Get the handle that cancels the query running on this connection from
+            another thread (invalid if not supported by the driver). */
+        QueryCancelHandle cancelHandle(bool useReadConnection = true);
+        /*! Re-apply the statement timeout before the next query on the write connection,
+            the rollback reverts the SET statement_timeout on PostgreSQL. */
+        void invalidateStatementTimeout() noexcept;
+
+        /* Replication lag */
+        /*! Get the maximum replication lag of the read connection, reads are sent to
+            the write connection if the replica lags more (std::nullopt if unbounded). */
+        inline const std::optional<std::chrono::milliseconds> &
+        getMaxReplicaLag() const noexcept;
+        /*! Set the maximum replication lag of the read connection (std::nullopt
+            if unbounded). */
+        DatabaseConnection &
+        setMaxReplicaLag(std::optional<std::chrono::milliseconds> lag) noexcept;
+        /*! Execute the callback with the given maximum replication lag of the read
+            connection, used by the Builder::maxStaleness(). */
+        SqlQuery withMaxStaleness(std::chrono::milliseconds staleness,
+                                  const std::function<SqlQuery()> &callback);
+        /*! Get the replication lag of the read connection, it's measured at most once
+            per the replica_lag_interval (std::nullopt if the replica isn't replicating
+            or it's unreachable). */
+        std::optional<std::chrono::milliseconds> replicaLag();
+
+        /*! Get the circuit breaker shared by all connections with the same name
+            (nullptr if the circuit_threshold configuration option isn't set). */
+        inline const std::shared_ptr<Connectors::CircuitBreaker> &
+        getCircuitBreaker() const noexcept;
+        /*! Set the circuit breaker (nullptr disables it). */
+        DatabaseConnection &
+        setCircuitBreaker(std::shared_ptr<Connectors::CircuitBreaker> circuitBreaker);
+
         /* Connection configuration */
         /*! Get an option value from the configuration options. */
         QVariant getConfig(const QString &option) const;
@@ -215,6 +319,11 @@ namespace Orm
         inline const QString &getDatabaseName() const noexcept;
         /*! Get the host name of the connected database. */
         inline const QString &getHostName() const noexcept;
+        /*! Get the name of the connection pool this connection was borrowed from
+            (empty if it's not a pooled connection). */
+        inline const QString &getPoolName() const noexcept;
+        /*! Set the name of the connection pool (used by the ConnectionPool). */
+        DatabaseConnection &setPoolName(const QString &name);
 
         /*! Get the QtTimeZoneConfig for the current connection. */
         inline const QtTimeZoneConfig &getQtTimeZone() const noexcept;
@@ -261,6 +370,32 @@ namespace Orm
         /*! Get the default post processor instance. */
         virtual std::unique_ptr<QueryProcessor> getDefaultPostProcessor() const = 0;
 
+        /*! Get the SQL that sets the statement timeout for the current session
+            (std::nullopt resets it to the server default), empty if not supported. */
+        virtual QString
+        compileStatementTimeout(const std::optional<std::chrono::milliseconds> &timeout);
+        /*! Get the SQL that cancels the query running on the given connection, empty
+            if not supported. */
+        virtual QString compileCancelQuery(const QSqlDatabase &connection);
+        /*! Determine whether the batch can be sent as one multi-statement query. */
+        virtual bool supportsMultiStatementBatch();
+        /*! Query the replication lag of the replica behind the given connection, zero
+            if it isn't a replica (std::nullopt if the replication is stopped). */
+        virtual std::optional<std::chrono::milliseconds>
+        queryReplicaLag(const QSqlDatabase &connection);
+
+        /*! Replace the placeholders by the bindings formatted and escaped by the driver,
+            placeholders inside the quoted strings and identifiers, comments, and
+            dollar-quoted strings are skipped (per the given driver's SQL syntax). */
+        static QString inlineBindings(const QString &queryString,
+                                      const QVector<QVariant> &bindings,
+                                      const QSqlDriver &driver,
+                                      const QString &driverName);
+        /*! Run the query executed directly by the database client library (bypassing
+            the QSqlQuery), it's counted, timed, and logged like other queries. */
+        quint64 runDirect(const QString &queryString, bool affecting,
+                          const std::function<quint64()> &callback);
+
         /*! Callback type used in the run() method. */
         template<typename Return>
         using RunCallback =
@@ -279,6 +414,8 @@ namespace Orm
 
         /*! The active QSqlDatabase connection name. */
         std::optional<Connectors::ConnectionName> m_qtConnection = std::nullopt;
+        /*! The active QSqlDatabase handle cached for the query hot path. */
+        QtConnectionHandle m_qtConnectionHandle {};
         /*! The QSqlDatabase connection resolver. */
         std::function<Connectors::ConnectionName()> m_qtConnectionResolver;
         /*! The name of the connected database. */
@@ -310,8 +447,53 @@ namespace Orm
         bool m_pretending = false;
 
     private:
-        /*! Prepare an SQL statement and return the query object. */
-        QSqlQuery prepareQuery(const QString &queryString);
+        /*! QSqlDatabase handle cached for the thread that obtained it. */
+        struct QtConnectionHandle
+        {
+            /*! The cached QSqlDatabase handle. */
+            QSqlDatabase database;
+            /*! The thread that obtained the handle (nullptr if not cached). */
+            QThread *thread = nullptr;
+            /*! The statement timeout set on the session (std::nullopt if the server
+                default). */
+            std::optional<std::chrono::milliseconds> statementTimeout = std::nullopt;
+            /*! Whether the statement timeout set on the session is unknown (eg. after
+                the rollback), it's re-applied before the next query. */
+            bool statementTimeoutStale = false;
+        };
+
+        /*! Get the QSqlDatabase handle, the QSqlDatabase connection repository is
+            used only if the handle isn't cached for the current thread or is closed. */
+        static QSqlDatabase
+        cachedQtConnection(QtConnectionHandle &handle,
+                           const Connectors::ConnectionName &connection);
+
+        /*! Run a select statement against the database. */
+        SqlQuery
+        selectInternal(const QString &queryString, QVector<QVariant> &&bindings,
+                       bool useReadConnection, bool forwardOnly);
+
+        /*! Run the batch as one multi-statement query (one round trip). */
+        QVector<int> runMultiStatementBatch(const QVector<BatchStatement> &statements);
+
+        /*! Prepare an SQL statement and return the query object, the check-in handler
+            is set if the statement is cached (the cache isn't used if nullptr). */
+        QSqlQuery prepareQuery(const QString &queryString,
+                               bool useReadConnection = false,
+                               bool forwardOnly = false,
+                               Support::StatementCache::CheckInType *checkIn = nullptr);
+        /*! Remove the prepared statement from the statement caches. */
+        void forgetPreparedStatement(const QString &queryString);
+        /*! Determine whether the select queries should be sent to the read connection. */
+        bool shouldUseReadConnection() const;
+        /*! Get the read QSqlDatabase connection, even if reads are currently sent
+            to the write connection. */
+        QSqlDatabase getRawReadQtConnection();
+        /*! Determine whether the replication lag of the read connection is within
+            the maximum replication lag (always true if unbounded). */
+        bool isReplicaLagAcceptable();
+        /*! Set the statement timeout on the given connection if it has changed. */
+        void applyStatementTimeout(bool readConnection);
         /*! Get a new invalid QSqlQuery instance for the pretend. */
         inline static QSqlQuery getQtQueryForPretend();
 
@@ -331,6 +513,14 @@ namespace Orm
                 const QString &queryString, const QVector<QVariant> &preparedBindings,
                 const RunCallback<Return> &callback) const;
 
+        /*! Throw the QueryTimeoutError or QueryCanceledError if the query was aborted
+            by the statement timeout or canceled. */
+        static void throwIfQueryCanceled(const Exceptions::QueryError &e);
+        /*! Record the failed query in the circuit breaker, only connection errors are
+            counted as failures. */
+        void recordCircuitBreakerFailure(Connectors::CircuitBreakerGuard &circuitBreaker,
+                                         const std::exception_ptr &ePtr) const;
+
         /*! Determine if the elapsed time for queries should be counted. */
         inline bool shouldCountElapsed() const;
 
@@ -348,10 +538,60 @@ namespace Orm
         QString m_connectionName;
         /*! Host name, obtained from the connection configuration. */
         QString m_hostName;
+        /*! Name of the connection pool of the pooled connection (DatabaseManager's
+            connection name, the pooled connection has its own name). */
+        QString m_poolName;
 
         /*! Connection's driver name in printable format eg. QMYSQL -> MySQL. */
         std::optional<std::reference_wrapper<const QString>>
         m_driverNamePrintable = std::nullopt;
+
+        /*! The QSqlDriver detached from its thread by the releaseThreadAffinity(). */
+        QSqlDriver *m_detachedDriver = nullptr;
+        /*! The read QSqlDriver detached from its thread by the releaseThreadAffinity(). */
+        QSqlDriver *m_detachedReadDriver = nullptr;
+
+        /*! The active read QSqlDatabase connection name. */
+        std::optional<Connectors::ConnectionName> m_readQtConnection = std::nullopt;
+        /*! The active read QSqlDatabase handle cached for the query hot path. */
+        QtConnectionHandle m_readQtConnectionHandle {};
+        /*! The read QSqlDatabase connection resolver (read/write connections only). */
+        std::function<Connectors::ConnectionName()> m_readQtConnectionResolver;
+        /*! Use the write connection for reads after the records have been modified. */
+        bool m_sticky;
+
+        /*! LRU cache of prepared statements (statement_cache_size config. option),
+            the SqlQuery-ies check in their statements using the weak pointer. */
+        std::shared_ptr<Support::StatementCache> m_statementCache;
+        /*! LRU cache of prepared statements for the read connection. */
+        std::shared_ptr<Support::StatementCache> m_readStatementCache;
+
+        /*! The default statement timeout (statement_timeout config. option). */
+        std::optional<std::chrono::milliseconds> m_statementTimeout;
+        /*! The statement timeout for the currently executed query (Builder::timeout()). */
+        std::optional<std::chrono::milliseconds> m_statementTimeoutOverride = std::nullopt;
+        /*! The password referenced by the cancel handles of the write connection. */
+        std::shared_ptr<const QString> m_cancelPassword;
+        /*! The password referenced by the cancel handles of the read connection. */
+        std::shared_ptr<const QString> m_readCancelPassword;
+
+        /*! The maximum replication lag of the read connection (max_replica_lag config.
+            option). */
+        std::optional<std::chrono::milliseconds> m_maxReplicaLag;
+        /*! The maximum replication lag for the currently executed query
+            (Builder::maxStaleness()). */
+        std::optional<std::chrono::milliseconds> m_maxStalenessOverride = std::nullopt;
+        /*! How often the replication lag is measured (replica_lag_interval config.
+            option). */
+        std::chrono::milliseconds m_replicaLagInterval;
+        /*! The last measured replication lag of the read connection. */
+        std::optional<std::chrono::milliseconds> m_replicaLag = std::nullopt;
+        /*! When the replication lag was measured (std::nullopt if never). */
+        std::optional<std::chrono::steady_clock::time_point>
+        m_replicaLagMeasuredAt = std::nullopt;
+
+        /*! The circuit breaker around the lost connection reconnect logic. */
+        std::shared_ptr<Connectors::CircuitBreaker> m_circuitBreaker = nullptr;
     };
 #if defined(__GNUG__) && !defined(__clang__)
 #  pragma GCC diagnostic pop
@@ -385,8 +625,7 @@ namespace Orm
                                                   QVector<QVariant> bindings)
     {
         // This member function is used from the schema builders/post-processors only
-        // FEATURE read/write connection silverqx
-        return select(queryString, std::move(bindings)/*, false*/);
+        return select(queryString, std::move(bindings), false);
     }
 
     SqlQuery
@@ -415,6 +654,17 @@ namespace Orm
         return m_qtConnectionResolver;
     }
 
+    const std::function<Connectors::ConnectionName()> &
+    DatabaseConnection::getReadQtConnectionResolver() const noexcept
+    {
+        return m_readQtConnectionResolver;
+    }
+
+    bool DatabaseConnection::hasReadConnection() const noexcept
+    {
+        return static_cast<bool>(m_readQtConnectionResolver);
+    }
+
     bool DatabaseConnection::isOpen()
     {
         return m_qtConnection && getQtConnection().isOpen();
@@ -454,6 +704,37 @@ namespace Orm
         return m_queryGrammar;
     }
 
+    /* Prepared statement cache */
+
+    std::size_t DatabaseConnection::getStatementCacheSize() const noexcept
+    {
+        return m_statementCache->capacity();
+    }
+
+    /* Statement timeout and cancellation */
+
+    const std::optional<std::chrono::milliseconds> &
+    DatabaseConnection::getStatementTimeout() const noexcept
+    {
+        return m_statementTimeout;
+    }
+
+    /* Replication lag */
+
+    const std::optional<std::chrono::milliseconds> &
+    DatabaseConnection::getMaxReplicaLag() const noexcept
+    {
+        return m_maxReplicaLag;
+    }
+
+    const std::shared_ptr<Connectors::CircuitBreaker> &
+    DatabaseConnection::getCircuitBreaker() const noexcept
+    {
+        return m_circuitBreaker;
+    }
+
+    /* Connection configuration */
+
     const QVariantHash &DatabaseConnection::getConfig() const noexcept
     {
         return m_config;
@@ -476,6 +757,11 @@ namespace Orm
         return m_hostName;
     }
 
+    const QString &DatabaseConnection::getPoolName() const noexcept
+    {
+        return m_poolName;
+    }
+
     const QtTimeZoneConfig &DatabaseConnection::getQtTimeZone() const noexcept
     {
         return m_qtTimeZone;
@@ -532,17 +818,30 @@ namespace Orm
            naming. */
         const auto &preparedBindings = prepareBindings(bindings);
 
+        // Fail fast while the database is unreachable (the circuit is open)
+        Connectors::CircuitBreakerGuard circuitBreaker(
+                    m_pretending ? nullptr : m_circuitBreaker.get());
+
         /* Here we will run this query. If an exception occurs we'll determine if it was
            caused by a connection that has been lost. If that is the cause, we'll try
            to re-establish connection and re-run the query with a fresh connection. */
         try {
-            result = runQueryCallback(queryString, preparedBindings, callback);
+            try {
+                result = runQueryCallback(queryString, preparedBindings, callback);
+
+            }  catch (const Exceptions::QueryError &e) {
+                result = handleQueryException(std::current_exception(), e,
+                                              queryString, preparedBindings, callback);
+            }
+
+        } catch (...) {
+            recordCircuitBreakerFailure(circuitBreaker, std::current_exception());
 
-        }  catch (const Exceptions::QueryError &e) {
-            result = handleQueryException(std::current_exception(), e,
-                                          queryString, preparedBindings, callback);
+            throw;
         }
 
+        circuitBreaker.recordSuccess();
+
         std::optional<qint64> elapsed;
         if (countElapsed) {
             // Hit elapsed timer
@@ -589,6 +888,9 @@ namespace Orm
             const QString &queryString, const QVector<QVariant> &preparedBindings,
             const RunCallback<Return> &callback) const
     {
+        // Timeouts and cancellations are never re-run
+        throwIfQueryCanceled(e);
+
         // FUTURE add info about in transaction into the exception that it was a reason why connection was not reconnected/recovered silverqx
         if (inTransaction())
             std::rethrow_exception(ePtr);
@@ -606,6 +908,11 @@ namespace Orm
     {
         // TODO would be good to call KILL on lost connection to free locks, https://dev.mysql.com/doc/c-api/8.0/en/c-api-auto-reconnect.html silverqx
         if (causedByLostConnection(e)) {
+            /* Don't reconnect if other threads have already opened the circuit,
+               the database is unreachable. */
+            if (m_circuitBreaker && !m_circuitBreaker->allowsReconnect())
+                std::rethrow_exception(ePtr);
+
             reconnect();
 
             // BUG rethrow e when causedByLostConnection to correctly inform user, causedByLostConnection state lost during second runQueryCallback(), because it internally tries to connect to DB and throws "Unable to connect to database" instead of "Lost connection", probably another try-catch and if catched "Unable to connect to database" then rethrow e (Lost connection)? silverqx
@@ -7,8 +7,12 @@ TINY_SYSTEM_HEADER
 
 #include "orm/connectionresolverinterface.hpp"
 #include "orm/query/querybuilder.hpp" // IWYU pragma: export
+#include "orm/support/asyncquery.hpp"
 #include "orm/support/databaseconfiguration.hpp"
 #include "orm/support/databaseconnectionsmap.hpp"
+#include "orm/support/keepalivescheduler.hpp"
+#include "orm/support/pooledconnection.hpp"
+#include "orm/types/warmupresult.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
@@ -80,6 +84,11 @@ namespace Query
         selectFromWriteConnection(const QString &query, QVector<QVariant> bindings = {},
                                   const QString &connection = "");
 
+        /*! Run a select statement and return the forward-only result. */
+        SqlQuery
+        cursor(const QString &query, QVector<QVariant> bindings = {},
+               const QString &connection = "");
+
         /*! Run a select statement and return a single result. */
         SqlQuery
         selectOne(const QString &query, QVector<QVariant> bindings = {},
@@ -114,6 +123,19 @@ namespace Query
         /*! Run a raw, unprepared query against the database. */
         SqlQuery unprepared(const QString &query, const QString &connection = "");
 
+        /*! Run the independent statements in as few round trips as the driver allows
+            and get the number of rows affected by every statement. */
+        QVector<int> batch(const QVector<BatchStatement> &statements,
+                           const QString &connection = "");
+
+        /*! Execute the callback within a transaction, re-run it after a deadlock or
+            serialization failure. */
+        void transaction(const std::function<void(DatabaseConnection &)> &callback,
+                         int attempts = 1,
+                         std::chrono::milliseconds backoff =
+                             std::chrono::milliseconds(10),
+                         const QString &connection = "");
+
         /*! Start a new database transaction. */
         bool beginTransaction(const QString &connection = "");
         /*! Commit the active database transaction. */
@@ -161,7 +183,8 @@ namespace Query
         DatabaseManager &
         addConnections(const ConfigurationsType &configs,
                        const QString &defaultConnection);
-        /*! Remove the given connection from the manager. */
+        /*! Remove the given connection from the manager, throws if a connection
+            borrowed from its connection pool wasn't released yet. */
         bool removeConnection(const QString &name = "");
         /*! Determine whether a given connection is already registered. */
         bool containsConnection(const QString &name = "");
@@ -173,6 +196,89 @@ namespace Query
         /*! Force connection to the database (creates physical connection), doesn't have
             to be called before querying a database. */
         void connectEagerly(const QString &name = "");
+        /*! Connect to the given databases concurrently and prepare the statements
+            from the warm_up_statements configuration option (all connections
+            if empty, one thread per connection if the threads is 0), statements are
+            prepared only if the statement_cache_size is greater than 0, every
+            connection is warmed up only once (also the "" default connection). */
+        QVector<WarmUpResult>
+        warmUp(const QStringList &connections = {}, int threads = 0);
+
+        /* Connection pools */
+        /*! Get the connection pool for the given connection (creates it lazily). */
+        Support::ConnectionPool &connectionPool(const QString &name = "");
+        /*! Get the connection pool for the given connection as a std::shared_ptr,
+            it stays alive even if it's removed from the DatabaseManager. */
+        std::shared_ptr<Support::ConnectionPool>
+        connectionPoolShared(const QString &name = "");
+        /*! Get the pool of the read-only SQLite wal_readers connections for the given
+            connection, it's the connection pool if there are no wal_readers. */
+        Support::ConnectionPool &readerPool(const QString &name = "");
+        /*! Get the reader pool for the given connection as a std::shared_ptr. */
+        std::shared_ptr<Support::ConnectionPool>
+        readerPoolShared(const QString &name = "");
+        /*! Determine whether the connection pool for the given connection exists. */
+        bool hasConnectionPool(const QString &name = "") const;
+        /*! Borrow a connection from the connection pool, the connection is returned
+            back to the pool when the PooledConnection is destroyed. */
+        Support::PooledConnection acquire(const QString &name = "");
+        /*! Borrow a connection from the connection pool with the given timeout. */
+        Support::PooledConnection acquire(std::chrono::milliseconds timeout,
+                                          const QString &name = "");
+        /*! Get the connection pool statistics for the given connection. */
+        ConnectionPoolStats connectionPoolStats(const QString &name = "") const;
+
+        /* Keepalive */
+        /*! Ping and close the idle pooled connections periodically in the background
+            thread (see the pool_keepalive_interval and pool_max_idle_time). */
+        void startKeepAlive(std::chrono::milliseconds interval =
+                                std::chrono::milliseconds(5000));
+        /*! Stop the background keepalive thread. */
+        void stopKeepAlive();
+        /*! Determine whether the background keepalive thread is running. */
+        bool isKeepAliveRunning() const;
+        /*! Ping and close the idle connections of all connection pools now. */
+        void maintainConnectionPools();
+
+        /* Circuit breaker */
+        /*! Get the circuit breaker statistics for the given connection (std::nullopt
+            if the circuit_threshold configuration option isn't set). */
+        std::optional<Connectors::CircuitBreakerStats>
+        circuitBreakerStats(const QString &name = "") const;
+
+        /* Scatter/gather */
+        /*! Run a select statement on all the given connections concurrently and
+            concatenate the results in the order of the connections. */
+        QVector<QSqlRecord>
+        parallel(const QStringList &connections, const QString &query,
+                 const QVector<QVariant> &bindings = {});
+
+#ifdef T_COROUTINES
+        /* Async queries */
+        /*! Run a select statement in the async thread pool (awaitable). */
+        AsyncQuery<QVector<QSqlRecord>>
+        selectAsync(const QString &query, QVector<QVariant> bindings = {},
+                    const QString &connection = "");
+        /*! Run a select statement in the async thread pool (awaitable). */
+        AsyncQuery<QVector<QSqlRecord>>
+        selectFromWriteConnectionAsync(const QString &query,
+                                       QVector<QVariant> bindings = {},
+                                       const QString &connection = "");
+        /*! Run a select statement in the async thread pool and return the first
+            column of the first row (awaitable). */
+        AsyncQuery<QVariant>
+        scalarAsync(const QString &query, QVector<QVariant> bindings = {},
+                    const QString &connection = "");
+        /*! Execute an SQL statement in the async thread pool (awaitable). */
+        AsyncQuery<void>
+        statementAsync(const QString &query, QVector<QVariant> bindings = {},
+                       const QString &connection = "");
+        /*! Run an SQL statement in the async thread pool and get the number of rows
+            affected (awaitable). */
+        AsyncQuery<int>
+        affectingStatementAsync(const QString &query, QVector<QVariant> bindings = {},
+                                const QString &connection = "");
+#endif
 
         /*! Returns a list containing the names of all connections. */
         QStringList connectionNames() const;
@@ -389,6 +495,18 @@ namespace Query
         std::shared_ptr<DatabaseConnection>
         configure(std::shared_ptr<DatabaseConnection> &&connection) const;
 
+        /*! Disconnect and remove the connection pool for the given connection, throws
+            if any connection is borrowed. */
+        void removeConnectionPool(const QString &name);
+
+#ifdef T_COROUTINES
+        /*! Invoke the callback in the async thread pool on a pooled connection. */
+        template<typename T>
+        AsyncQuery<T>
+        runAsync(std::shared_ptr<Support::ConnectionPool> &&pool,
+                 std::function<T(DatabaseConnection &)> &&callback);
+#endif
+
         /*! Refresh an underlying QSqlDatabase connection resolver on a given
             TinyORM connection. */
         DatabaseConnection &refreshQtConnection(const QString &connection);
@@ -403,6 +521,19 @@ namespace Query
         /*! The callback to be executed to reconnect to a database. */
         ReconnectorType m_reconnector = nullptr;
 
+        /*! Connection pools shared across all threads (not thread_local). */
+        std::unordered_map<QString, std::shared_ptr<Support::ConnectionPool>>
+        m_connectionPools {};
+        /*! Reader pools, the connection pool if the connection has no wal_readers. */
+        std::unordered_map<QString, std::shared_ptr<Support::ConnectionPool>>
+        m_readerPools {};
+        /*! Mutex that guards the m_connectionPools and m_readerPools. */
+        mutable std::mutex m_connectionPoolsMutex {};
+        /*! Background keepalive thread, destroyed before the connection pools. */
+        std::unique_ptr<Support::KeepAliveScheduler> m_keepAlive = nullptr;
+        /*! Mutex that guards the m_keepAlive. */
+        mutable std::mutex m_keepAliveMutex {};
+
         /*! Shared pointer to the DatabaseManager instance. */
         static std::shared_ptr<DatabaseManager> m_instance;
     };
@@ -74,6 +74,11 @@ namespace Orm
         selectFromWriteConnection(const QString &query, QVector<QVariant> bindings = {},
                                   const QString &connection = "");
 
+        /*! Run a select statement and return the forward-only result. */
+        static SqlQuery
+        cursor(const QString &query, QVector<QVariant> bindings = {},
+               const QString &connection = "");
+
         /*! Run a select statement and return a single result. */
         static SqlQuery
         selectOne(const QString &query, QVector<QVariant> bindings = {},
@@ -109,6 +114,19 @@ namespace Orm
         static SqlQuery
         unprepared(const QString &query, const QString &connection = "");
 
+        /*! Run the independent statements in as few round trips as the driver allows
+            and get the number of rows affected by every statement. */
+        static QVector<int>
+        batch(const QVector<BatchStatement> &statements, const QString &connection = "");
+
+        /*! Execute the callback within a transaction, re-run it after a deadlock or
+            serialization failure. */
+        static void
+        transaction(const std::function<void(DatabaseConnection &)> &callback,
+                    int attempts = 1,
+                    std::chrono::milliseconds backoff = std::chrono::milliseconds(10),
+                    const QString &connection = "");
+
         /*! Start a new database transaction. */
         static bool beginTransaction(const QString &connection = "");
         /*! Commit the active database transaction. */
@@ -165,6 +183,80 @@ namespace Orm
         /*! Force connection to the database (creates physical connection), doesn't have
             to be called before querying a database. */
         static void connectEagerly(const QString &name = "");
+        /*! Connect to the given databases concurrently and prepare the statements
+            from the warm_up_statements configuration option (all connections
+            if empty, one thread per connection if the threads is 0). */
+        static QVector<WarmUpResult>
+        warmUp(const QStringList &connections = {}, int threads = 0);
+
+        /* Connection pools */
+        /*! Get the connection pool for the given connection (creates it lazily). */
+        static Support::ConnectionPool &connectionPool(const QString &name = "");
+        /*! Get the pool of read-only SQLite wal_readers connections, it's the connection
+            pool itself if the wal_readers option isn't configured. */
+        static Support::ConnectionPool &readerPool(const QString &name = "");
+        /*! Determine whether the connection pool for the given connection exists. */
+        static bool hasConnectionPool(const QString &name = "");
+        /*! Borrow a connection from the connection pool, the connection is returned
+            back to the pool when the PooledConnection is destroyed. */
+        static Support::PooledConnection acquire(const QString &name = "");
+        /*! Borrow a connection from the connection pool with the given timeout. */
+        static Support::PooledConnection
+        acquire(std::chrono::milliseconds timeout, const QString &name = "");
+        /*! Get the connection pool statistics for the given connection. */
+        static ConnectionPoolStats connectionPoolStats(const QString &name = "");
+
+        /* Keepalive */
+        /*! Ping and close the idle pooled connections periodically in the background
+            thread (see the pool_keepalive_interval and pool_max_idle_time). */
+        static void startKeepAlive(std::chrono::milliseconds interval =
+                                       std::chrono::milliseconds(5000));
+        /*! Stop the background keepalive thread. */
+        static void stopKeepAlive();
+        /*! Determine whether the background keepalive thread is running. */
+        static bool isKeepAliveRunning();
+        /*! Ping and close the idle connections of all connection pools now. */
+        static void maintainConnectionPools();
+
+        /* Circuit breaker */
+        /*! Get the circuit breaker statistics for the given connection (std::nullopt
+            if the circuit_threshold configuration option isn't set). */
+        static std::optional<Connectors::CircuitBreakerStats>
+        circuitBreakerStats(const QString &name = "");
+
+        /* Scatter/gather */
+        /*! Run a select statement on all the given connections concurrently and
+            concatenate the results in the order of the connections. */
+        static QVector<QSqlRecord>
+        parallel(const QStringList &connections, const QString &query,
+                 const QVector<QVariant> &bindings = {});
+
+#ifdef T_COROUTINES
+        /* Async queries */
+        /*! Run a select statement in the async thread pool (awaitable). */
+        static AsyncQuery<QVector<QSqlRecord>>
+        selectAsync(const QString &query, QVector<QVariant> bindings = {},
+                    const QString &connection = "");
+        /*! Run a select statement in the async thread pool (awaitable). */
+        static AsyncQuery<QVector<QSqlRecord>>
+        selectFromWriteConnectionAsync(const QString &query,
+                                       QVector<QVariant> bindings = {},
+                                       const QString &connection = "");
+        /*! Run a select statement in the async thread pool and return the first
+            column of the first row (awaitable). */
+        static AsyncQuery<QVariant>
+        scalarAsync(const QString &query, QVector<QVariant> bindings = {},
+                    const QString &connection = "");
+        /*! Execute an SQL statement in the async thread pool (awaitable). */
+        static AsyncQuery<void>
+        statementAsync(const QString &query, QVector<QVariant> bindings = {},
+                       const QString &connection = "");
+        /*! Run an SQL statement in the async thread pool and get the number of rows
+            affected (awaitable). */
+        static AsyncQuery<int>
+        affectingStatementAsync(const QString &query, QVector<QVariant> bindings = {},
+                                const QString &connection = "");
+#endif
 
         /*! Returns a list containing the names of all connections. */
         static QStringList connectionNames();
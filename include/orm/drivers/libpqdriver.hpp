@@ -0,0 +1,96 @@
+#pragma once
+#ifndef ORM_DRIVERS_LIBPQDRIVER_HPP
+#define ORM_DRIVERS_LIBPQDRIVER_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#ifdef TINYORM_LIBPQ_DRIVER
+#include <QtSql/QSqlDriver>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+// Forward declarations from the libpq-fe.h, to avoid including it in the header
+struct pg_conn;
+struct pg_result;
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Drivers
+{
+
+    class LibPqResult;
+
+    /*! Native PostgreSQL driver that talks to the libpq directly, it's the drop-in
+        replacement for the QPSQL driver. Prepared statements return results in
+        the binary format, forward-only queries are streamed in the single-row mode,
+        and multi-statement queries return all results in one round trip. */
+    class SHAREDLIB_EXPORT LibPqDriver final : public QSqlDriver
+    {
+        Q_DISABLE_COPY_MOVE(LibPqDriver)
+
+        // To access the connection and the streaming state
+        friend LibPqResult;
+
+    public:
+        /*! Constructor. */
+        explicit LibPqDriver(QObject *parent = nullptr);
+        /*! Virtual destructor. */
+        ~LibPqDriver() final;
+
+        /*! Register the driver under the QPSQL_LIBPQ name (thread-safe, only once). */
+        static void registerDriver();
+
+        /*! Determine whether the driver supports the given feature. */
+        bool hasFeature(DriverFeature feature) const final;
+
+        /*! Open the connection to the database server. */
+        bool open(const QString &database, const QString &user,
+                  const QString &password, const QString &host, int port,
+                  const QString &connectOptions) final;
+        /*! Close the connection. */
+        void close() final;
+        /*! Create a new result for the QSqlQuery. */
+        QSqlResult *createResult() const final;
+
+        /*! Begin a transaction. */
+        bool beginTransaction() final;
+        /*! Commit the active transaction. */
+        bool commitTransaction() final;
+        /*! Roll back the active transaction. */
+        bool rollbackTransaction() final;
+
+        /*! Get a string representation of the given field for the SQL query. */
+        QString formatValue(const QSqlField &field, bool trimStrings = false) const final;
+        /*! Quote the identifier. */
+        QString escapeIdentifier(const QString &identifier,
+                                 IdentifierType type) const final;
+
+        /*! Get the underlying PGconn handle. */
+        QVariant handle() const final;
+
+    private:
+        /*! Execute the simple command and report the error, used by the transactions. */
+        bool execCommand(const char *command, const QString &errorText);
+        /*! Read and discard the rest of the streamed result, the connection can run
+            only one query at a time. */
+        void finishStreaming() const;
+        /*! Generate the unique name for a prepared statement. */
+        QByteArray nextStatementName() const;
+
+        /*! The libpq connection handle. */
+        pg_conn *m_connection = nullptr;
+        /*! The result that is currently streamed in the single-row mode. */
+        mutable LibPqResult *m_streamingResult = nullptr;
+        /*! Counter used to generate the prepared statement names. */
+        mutable quint64 m_statementCounter = 0;
+    };
+
+} // namespace Orm::Drivers
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // TINYORM_LIBPQ_DRIVER
+
+#endif // ORM_DRIVERS_LIBPQDRIVER_HPP
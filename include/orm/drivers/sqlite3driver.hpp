@@ -0,0 +1,145 @@
+#pragma once
+#ifndef ORM_DRIVERS_SQLITE3DRIVER_HPP
+#define ORM_DRIVERS_SQLITE3DRIVER_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#ifdef TINYORM_SQLITE3_DRIVER
+#include <QtSql/QSqlDriver>
+
+#include <list>
+#include <unordered_map>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+// Forward declarations from the sqlite3.h, to avoid including it in the header
+struct sqlite3;
+struct sqlite3_stmt;
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Drivers
+{
+
+    class SQLite3Result;
+
+    /*! Native SQLite driver that talks to the sqlite3 library directly, it's
+        the drop-in replacement for the QSQLITE driver. Prepared sqlite3_stmt-s are
+        kept in the LRU cache keyed by the query string, so the same query is never
+        prepared twice, values are bound by the sqlite3_bind_xyz() and columns are
+        read by their storage class without any string conversions. */
+    class SHAREDLIB_EXPORT SQLite3Driver final : public QSqlDriver
+    {
+        Q_DISABLE_COPY_MOVE(SQLite3Driver)
+
+        // To access the connection and the statement cache
+        friend SQLite3Result;
+
+    public:
+        /*! Constructor. */
+        explicit SQLite3Driver(QObject *parent = nullptr);
+        /*! Virtual destructor. */
+        ~SQLite3Driver() final;
+
+        /*! Register the driver under the QSQLITE_LIB name (thread-safe, only once). */
+        static void registerDriver();
+
+        /*! Determine whether the driver supports the given feature. */
+        bool hasFeature(DriverFeature feature) const final;
+
+        /*! Open the database file. */
+        bool open(const QString &database, const QString &user,
+                  const QString &password, const QString &host, int port,
+                  const QString &connectOptions) final;
+        /*! Close the database, all cached statements are finalized. */
+        void close() final;
+        /*! Create a new result for the QSqlQuery. */
+        QSqlResult *createResult() const final;
+
+        /*! Begin a transaction. */
+        bool beginTransaction() final;
+        /*! Commit the active transaction. */
+        bool commitTransaction() final;
+        /*! Roll back the active transaction. */
+        bool rollbackTransaction() final;
+
+        /*! Get a string representation of the given field for the SQL query. */
+        QString formatValue(const QSqlField &field, bool trimStrings = false) const final;
+        /*! Quote the identifier. */
+        QString escapeIdentifier(const QString &identifier,
+                                 IdentifierType type) const final;
+
+        /*! Get the underlying sqlite3 handle. */
+        QVariant handle() const final;
+
+        /*! Get the maximum number of cached statements. */
+        inline std::size_t statementCacheSize() const noexcept;
+        /*! Get the number of statements served from the statement cache. */
+        inline std::size_t statementCacheHits() const noexcept;
+        /*! Get the number of statements that had to be prepared. */
+        inline std::size_t statementCacheMisses() const noexcept;
+
+    private:
+        /*! Execute the simple command and report the error, used by the transactions. */
+        bool execCommand(const char *command, const QString &errorText);
+
+        /*! Take the statement for the given query from the cache, nullptr if it
+            isn't cached, the statement is owned by the caller until it's returned. */
+        sqlite3_stmt *takeStatement(const QString &query) const;
+        /*! Return the statement to the cache, evicts the least recently used
+            statement if the cache is full. */
+        void returnStatement(const QString &query, sqlite3_stmt *statement) const;
+        /*! Finalize all the cached statements. */
+        void clearStatementCache() const;
+
+        /*! Statement cache entry type (query string and the statement). */
+        using CacheEntryType = std::pair<QString, sqlite3_stmt *>;
+        /*! Statement cache entries list type, the front is the most recently used. */
+        using CacheEntriesType = std::list<CacheEntryType>;
+
+        /*! The sqlite3 connection handle. */
+        sqlite3 *m_connection = nullptr;
+        /*! Incremented on every open, statements prepared on the previous connection
+            are finalized instead of being returned to the cache. */
+        quint64 m_generation = 0;
+
+        /*! The maximum number of cached statements. */
+        std::size_t m_statementCacheSize = 128;
+        /*! Cached statements ordered by usage, the front is the most recently used. */
+        mutable CacheEntriesType m_statementCache;
+        /*! Map the query string to the position in the statement cache, one query
+            string can have more statements if it was executed by more results. */
+        mutable std::unordered_multimap<QString, CacheEntriesType::iterator>
+        m_statementIndex;
+        /*! Number of statements served from the cache. */
+        mutable std::size_t m_statementCacheHits = 0;
+        /*! Number of statements that had to be prepared. */
+        mutable std::size_t m_statementCacheMisses = 0;
+    };
+
+    /* public */
+
+    std::size_t SQLite3Driver::statementCacheSize() const noexcept
+    {
+        return m_statementCacheSize;
+    }
+
+    std::size_t SQLite3Driver::statementCacheHits() const noexcept
+    {
+        return m_statementCacheHits;
+    }
+
+    std::size_t SQLite3Driver::statementCacheMisses() const noexcept
+    {
+        return m_statementCacheMisses;
+    }
+
+} // namespace Orm::Drivers
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // TINYORM_SQLITE3_DRIVER
+
+#endif // ORM_DRIVERS_SQLITE3DRIVER_HPP
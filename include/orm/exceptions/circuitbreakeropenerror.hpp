@@ -0,0 +1,27 @@
+#pragma once
+#ifndef ORM_EXCEPTIONS_CIRCUITBREAKEROPENERROR_HPP
+#define ORM_EXCEPTIONS_CIRCUITBREAKEROPENERROR_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include "orm/exceptions/lostconnectionerror.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Exceptions
+{
+
+    /*! TinyORM circuit breaker open exception, the query failed fast because
+        the database is unreachable. */
+    class CircuitBreakerOpenError : public LostConnectionError // clazy:exclude=copyable-polymorphic
+    {
+        /*! Inherit constructors. */
+        using LostConnectionError::LostConnectionError;
+    };
+
+} // namespace Orm::Exceptions
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_EXCEPTIONS_CIRCUITBREAKEROPENERROR_HPP
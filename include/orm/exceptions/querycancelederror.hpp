@@ -0,0 +1,34 @@
+#pragma once
+#ifndef ORM_EXCEPTIONS_QUERYCANCELEDERROR_HPP
+#define ORM_EXCEPTIONS_QUERYCANCELEDERROR_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include "orm/exceptions/queryerror.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Exceptions
+{
+
+    /*! TinyORM query canceled exception, the query was canceled by
+        the QueryCancelHandle (or by the database administrator). */
+    class QueryCanceledError : public QueryError // clazy:exclude=copyable-polymorphic
+    {
+    public:
+        /*! Constructor from the failed query exception. */
+        inline explicit QueryCanceledError(const QueryError &error);
+    };
+
+    /* public */
+
+    QueryCanceledError::QueryCanceledError(const QueryError &error)
+        : QueryError(error)
+    {}
+
+} // namespace Orm::Exceptions
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_EXCEPTIONS_QUERYCANCELEDERROR_HPP
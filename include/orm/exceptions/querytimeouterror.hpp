@@ -0,0 +1,27 @@
+#pragma once
+#ifndef ORM_EXCEPTIONS_QUERYTIMEOUTERROR_HPP
+#define ORM_EXCEPTIONS_QUERYTIMEOUTERROR_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include "orm/exceptions/querycancelederror.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Exceptions
+{
+
+    /*! TinyORM query timeout exception, the query was aborted because it exceeded
+        the statement timeout. */
+    class QueryTimeoutError : public QueryCanceledError // clazy:exclude=copyable-polymorphic
+    {
+        /*! Inherit constructors. */
+        using QueryCanceledError::QueryCanceledError;
+    };
+
+} // namespace Orm::Exceptions
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_EXCEPTIONS_QUERYTIMEOUTERROR_HPP
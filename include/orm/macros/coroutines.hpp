@@ -0,0 +1,16 @@
+#pragma once
+#ifndef ORM_MACROS_COROUTINES_HPP
+#define ORM_MACROS_COROUTINES_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+/* The async API (awaitable queries) is available only if the compiler supports
+   C++20 coroutines, eg. GCC 10 needs the -fcoroutines compiler option. */
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#  if __has_include(<coroutine>)
+#    define T_COROUTINES
+#  endif
+#endif
+
+#endif // ORM_MACROS_COROUTINES_HPP
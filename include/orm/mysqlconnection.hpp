@@ -5,8 +5,12 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <ranges>
+
 #include "orm/databaseconnection.hpp"
 
+class QIODevice;
+
 TINYORM_BEGIN_COMMON_NAMESPACE
 
 namespace Orm
@@ -48,6 +52,26 @@ namespace Orm
         void setConfigVersion(const QString &value);
 #endif
 
+        /* Bulk loading */
+        /*! Row producer for the loadData(), fills the given row and returns true,
+            returns false after the last row. */
+        using LoadDataRowProducer = std::function<bool(QVector<QVariant> &row)>;
+
+        /*! Bulk load the given rows into the table using the LOAD DATA LOCAL INFILE,
+            returns the number of loaded rows. */
+        int loadData(const QString &table, const QVector<QString> &columns,
+                     const QVector<QVector<QVariant>> &rows);
+        /*! Bulk load the rows from the given range into the table using the LOAD
+            DATA LOCAL INFILE, returns the number of loaded rows. */
+        template<std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>,
+                                     QVector<QVariant>>
+        int loadData(const QString &table, const QVector<QString> &columns, R &&rows);
+        /*! Bulk load the rows from the given producer into the table using the LOAD
+            DATA LOCAL INFILE, returns the number of loaded rows. */
+        int loadData(const QString &table, const QVector<QString> &columns,
+                     const LoadDataRowProducer &producer);
+
         /* Others */
         /*! Check database connection and show warnings when the state changed.
             MySQL reconnection logic is disabled (MYSQL_OPT_RECONNECT), TinyORM has
@@ -64,12 +88,33 @@ namespace Orm
         /*! Get the default post processor instance. */
         std::unique_ptr<QueryProcessor> getDefaultPostProcessor() const final;
 
+        /*! Get the SQL that sets the statement timeout for the current session. */
+        QString compileStatementTimeout(
+                    const std::optional<std::chrono::milliseconds> &timeout) final;
+        /*! Get the SQL that cancels the query running on the given connection. */
+        QString compileCancelQuery(const QSqlDatabase &connection) final;
+        /*! Determine whether the batch can be sent as one multi-statement query. */
+        bool supportsMultiStatementBatch() final;
+        /*! Query the replication lag of the replica behind the given connection. */
+        std::optional<std::chrono::milliseconds>
+        queryReplicaLag(const QSqlDatabase &connection) final;
+
         /*! MySQL server version. */
         std::optional<QString> m_version = std::nullopt;
         /*! Is currently connected the MariaDB database server? */
         std::optional<bool> m_isMaria = std::nullopt;
         /*! Determine whether to use the upsert alias (by MySQL version >=8.0.19). */
         std::optional<bool> m_useUpsertAlias = std::nullopt;
+
+    private:
+        /*! Write rows from the given producer to the LOAD DATA file, returns
+            the number of written rows. */
+        quint64 writeLoadDataFile(QIODevice &file,
+                                  QVector<QString>::size_type columnsSize,
+                                  const LoadDataRowProducer &producer) const;
+        /*! Compile the LOAD DATA LOCAL INFILE statement for the given file. */
+        QString compileLoadData(const QString &table, const QVector<QString> &columns,
+                                const QString &fileName) const;
     };
 
     /* public */
@@ -88,6 +133,28 @@ namespace Orm
                         std::move(config)));
     }
 
+    /* Bulk loading */
+
+    template<std::ranges::input_range R>
+    requires std::convertible_to<std::ranges::range_reference_t<R>, QVector<QVariant>>
+    int MySqlConnection::loadData(const QString &table, const QVector<QString> &columns,
+                                  R &&rows)
+    {
+        auto it = std::ranges::begin(rows);
+        const auto end = std::ranges::end(rows);
+
+        return loadData(table, columns, [&it, &end](QVector<QVariant> &row)
+        {
+            if (it == end)
+                return false;
+
+            row = *it;
+            ++it;
+
+            return true;
+        });
+    }
+
 } // namespace Orm
 
 TINYORM_END_COMMON_NAMESPACE
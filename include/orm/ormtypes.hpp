@@ -71,6 +71,8 @@ namespace Query
         COLUMN,
         IN_,
         NOT_IN,
+        IN_RAW,
+        NOT_IN_RAW,
         NULL_,
         NOT_NULL,
         RAW,
@@ -113,6 +115,13 @@ namespace Query
         QString     sql       {}; // for the raw version
     };
 
+    /*! Statement executed by the DatabaseConnection::batch(). */
+    struct BatchStatement
+    {
+        QString           query;
+        QVector<QVariant> bindings {};
+    };
+
     /*! Update item. */
     struct UpdateItem
     {
@@ -46,6 +46,53 @@ namespace Orm
             (without resolving the "$user" variable). */
         QStringList searchPathRaw(bool flushCache = false);
 
+        /* COPY */
+        /*! The COPY data format. */
+        enum struct CopyFormat
+        {
+            /*! Tab separated text rows. */
+            Text,
+            /*! PostgreSQL binary COPY format. */
+            Binary,
+        };
+
+        /*! Row producer for the copyIn(), fills the given row and returns true,
+            returns false after the last row. */
+        using CopyRowProducer = std::function<bool(QVector<QVariant> &row)>;
+        /*! Row consumer for the copyOut(), values are strings in the PostgreSQL text
+            format and NULL values are null QVariant-s. */
+        using CopyRowConsumer = std::function<void(QVector<QVariant> &&row)>;
+        /*! Data producer for the copyInRaw(), fills the given buffer and returns true,
+            returns false after the last chunk. */
+        using CopyDataProducer = std::function<bool(QByteArray &data)>;
+        /*! Data consumer for the copyOutRaw(). */
+        using CopyDataConsumer = std::function<void(const QByteArray &data)>;
+
+        /*! Copy the given rows into the table using the COPY FROM STDIN, returns
+            the number of copied rows. */
+        quint64 copyIn(const QString &table, const QVector<QString> &columns,
+                       const QVector<QVector<QVariant>> &rows);
+        /*! Copy the rows from the given producer into the table using the COPY FROM
+            STDIN, returns the number of copied rows. */
+        quint64 copyIn(const QString &table, const QVector<QString> &columns,
+                       const CopyRowProducer &producer);
+        /*! Copy the data in the given format into the table using the COPY FROM STDIN,
+            returns the number of copied rows. */
+        quint64 copyInRaw(const QString &table, const QVector<QString> &columns,
+                          CopyFormat format, const CopyDataProducer &producer);
+
+        /*! Copy the rows of the given select query to the consumer using the COPY TO
+            STDOUT, returns the number of copied rows. */
+        quint64 copyOut(const QString &query, const QVector<QVariant> &bindings,
+                        const CopyRowConsumer &consumer);
+        /*! Copy the rows of the given query builder to the consumer using the COPY TO
+            STDOUT, returns the number of copied rows. */
+        quint64 copyOut(QueryBuilder &query, const CopyRowConsumer &consumer);
+        /*! Copy the data of the given select query in the given format to the consumer
+            using the COPY TO STDOUT, returns the number of copied rows. */
+        quint64 copyOutRaw(const QString &query, const QVector<QVariant> &bindings,
+                           CopyFormat format, const CopyDataConsumer &consumer);
+
     protected:
         /*! Get the default query grammar instance. */
         std::unique_ptr<QueryGrammar> getDefaultQueryGrammar() const final;
@@ -56,6 +103,17 @@ namespace Orm
         /*! Get the default post processor instance. */
         std::unique_ptr<QueryProcessor> getDefaultPostProcessor() const final;
 
+        /*! Get the SQL that sets the statement timeout for the current session. */
+        QString compileStatementTimeout(
+                    const std::optional<std::chrono::milliseconds> &timeout) final;
+        /*! Get the SQL that cancels the query running on the given connection. */
+        QString compileCancelQuery(const QSqlDatabase &connection) final;
+        /*! Determine whether the batch can be sent as one multi-statement query. */
+        bool supportsMultiStatementBatch() final;
+        /*! Query the replication lag of the replica behind the given connection. */
+        std::optional<std::chrono::milliseconds>
+        queryReplicaLag(const QSqlDatabase &connection) final;
+
     private:
         /*! Get the PostgreSQL server 'search_path' (for pretend mode). */
         QStringList searchPathRawForPretending() const;
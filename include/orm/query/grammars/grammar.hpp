@@ -75,6 +75,35 @@ namespace Orm::Query::Grammars
 
         /*! Get the grammar specific operators. */
         virtual const QVector<QString> &getOperators() const;
+        /*! Determine whether the database sorts null values as the largest values
+            (last in the ascending order). */
+        virtual bool sortsNullsLast() const;
+
+        /* Array binding of the "where in" values */
+        /*! Get the minimum number of the "where in" values bound as one array
+            parameter (0 if disabled). */
+        inline std::size_t getInArrayThreshold() const noexcept;
+        /*! Set the minimum number of the "where in" values bound as one array
+            parameter (0 disables it). */
+        Grammar &setInArrayThreshold(std::size_t threshold) noexcept;
+        /*! Determine whether the given "where in" values are bound as one array
+            parameter. */
+        bool shouldBindInArray(const QVector<QVariant> &values) const;
+        /*! Prepare the "where in" values as one array binding. */
+        virtual QVariant prepareInArrayBinding(const QVector<QVariant> &values) const;
+
+        /* Bound parameters limit */
+        /*! The maximum number of rows inserted by one insert statement, bigger
+            statements don't insert faster and only take more memory to compile. */
+        constexpr static std::size_t MaxInsertChunkSize = 1000;
+
+        /*! Get the maximum number of bound parameters in one query. */
+        std::size_t getMaxBindings() const;
+        /*! Set the maximum number of bound parameters in one query (0 for the grammar
+            default). */
+        Grammar &setMaxBindings(std::size_t maxBindings) noexcept;
+        /*! Get the maximum number of rows inserted by one insert statement. */
+        std::size_t getInsertChunkSize(std::size_t columnsCount) const;
 
     protected:
         /*! Select component types. */
@@ -172,6 +201,18 @@ namespace Orm::Query::Grammars
         QString whereIn(const WhereConditionItem &where) const;
         /*! Compile a "where not in" clause. */
         QString whereNotIn(const WhereConditionItem &where) const;
+        /*! Determine whether the grammar can bind the "where in" values as one array
+            parameter. */
+        virtual bool supportsInArrayBinding() const;
+        /*! Compile a "where in" clause with the values bound as one array parameter. */
+        virtual QString whereInArray(const WhereConditionItem &where, bool nope) const;
+        /*! Get the driver's maximum number of bound parameters in one query. */
+        virtual std::size_t getDefaultMaxBindings() const;
+
+        /*! Compile a "where in raw" clause (integer values inlined). */
+        QString whereInRaw(const WhereConditionItem &where) const;
+        /*! Compile a "where not in raw" clause (integer values inlined). */
+        QString whereNotInRaw(const WhereConditionItem &where) const;
         /*! Compile a "where null" clause. */
         QString whereNull(const WhereConditionItem &where) const;
         /*! Compile a "where not null" clause. */
@@ -241,6 +282,12 @@ namespace Orm::Query::Grammars
         static QVector<QVariant>::size_type
         computeReserveForBindingsMap(const BindingsMap &bindings,
                                      const QVector<BindingType> &exclude = {});
+
+    private:
+        /*! The minimum number of the "where in" values bound as one array parameter. */
+        std::size_t m_inArrayThreshold = 0;
+        /*! The maximum number of bound parameters in one query (0 for the default). */
+        std::size_t m_maxBindings = 0;
     };
 
     /* public */
@@ -254,6 +301,11 @@ namespace Orm::Query::Grammars
         return compileInsert(query, values);
     }
 
+    std::size_t Grammar::getInArrayThreshold() const noexcept
+    {
+        return m_inArrayThreshold;
+    }
+
 } // namespace Orm::Query::Grammars
 
 TINYORM_END_COMMON_NAMESPACE
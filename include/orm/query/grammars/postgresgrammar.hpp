@@ -53,6 +53,12 @@ namespace Orm::Query::Grammars
 
         /*! Get the grammar specific operators. */
         const QVector<QString> &getOperators() const override;
+        /*! Determine whether the database sorts null values as the largest values
+            (last in the ascending order). */
+        bool sortsNullsLast() const override;
+
+        /*! Prepare the "where in" values as one array binding (array literal). */
+        QVariant prepareInArrayBinding(const QVector<QVariant> &values) const override;
 
         /*! Compile a basic where clause. */
         QString whereBasic(const WhereConditionItem &where) const;
@@ -78,6 +84,12 @@ namespace Orm::Query::Grammars
         /*! Compile the columns for an update statement. */
         QString compileUpdateColumns(const QVector<UpdateItem> &values) const override;
 
+        /*! Determine whether the grammar can bind the "where in" values as one array
+            parameter. */
+        bool supportsInArrayBinding() const override;
+        /*! Compile a "where in" clause with the values bound as one array parameter. */
+        QString whereInArray(const WhereConditionItem &where, bool nope) const override;
+
     private:
         /*! Compile an update statement with joins or limit into SQL. */
         QString compileUpdateWithJoinsOrLimit(QueryBuilder &query,
@@ -50,6 +50,9 @@ namespace Orm::Query::Grammars
         /*! Get the grammar specific operators. */
         const QVector<QString> &getOperators() const override;
 
+        /*! Prepare the "where in" values as one array binding (JSON array). */
+        QVariant prepareInArrayBinding(const QVector<QVariant> &values) const override;
+
     protected:
         /*! Map the ComponentType to a Grammar::compileXx() methods. */
         const QMap<SelectComponentType, SelectComponentValue> &
@@ -77,6 +80,15 @@ namespace Orm::Query::Grammars
         /*! Compile the columns for an update statement. */
         QString compileUpdateColumns(const QVector<UpdateItem> &values) const override;
 
+        /*! Determine whether the grammar can bind the "where in" values as one array
+            parameter. */
+        bool supportsInArrayBinding() const override;
+        /*! Compile a "where in" clause with the values bound as one array parameter. */
+        QString whereInArray(const WhereConditionItem &where, bool nope) const override;
+
+        /*! Get the driver's maximum number of bound parameters in one query. */
+        std::size_t getDefaultMaxBindings() const override;
+
     private:
         /*! Compile an update statement with joins or limit into SQL. */
         QString compileUpdateWithJoinsOrLimit(QueryBuilder &query,
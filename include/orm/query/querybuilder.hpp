@@ -5,10 +5,13 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <chrono>
 #include <unordered_set>
 
 #include "orm/query/concerns/buildsqueries.hpp"
 #include "orm/query/grammars/grammar.hpp"
+#include "orm/support/asyncquery.hpp"
+#include "orm/support/scattergather.hpp"
 #include "orm/utils/query.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -71,6 +74,27 @@ namespace Orm::Query
         /* Retrieving results */
         /*! Execute the query as a "select" statement. */
         SqlQuery get(const QVector<Column> &columns = {ASTERISK});
+        /*! Execute the query as a "select" statement and return the forward-only
+            result, rows can be read only once (constant memory usage). */
+        SqlQuery cursor(const QVector<Column> &columns = {ASTERISK});
+        /*! Execute the query as a "select" statement on all the given connections
+            concurrently and merge the results (ORDER BY, LIMIT, and OFFSET are
+            applied across all connections). */
+        QVector<QSqlRecord>
+        onConnections(const QStringList &connections,
+                      const QVector<Column> &columns = {ASTERISK});
+        /*! Execute the query on all the given connections the same way as
+            the onConnections(), every record is returned with the index
+            of the connection it comes from. */
+        QVector<Support::ScatterGather::IndexedRecord>
+        onConnectionsIndexed(const QStringList &connections,
+                             const QVector<Column> &columns = {ASTERISK});
+#ifdef T_COROUTINES
+        /*! Execute the query as a "select" statement in the async thread pool
+            (awaitable). */
+        AsyncQuery<QVector<QSqlRecord>>
+        getAsync(const QVector<Column> &columns = {ASTERISK});
+#endif
         /*! Execute a query for a single record by ID. */
         SqlQuery find(const QVariant &id, const QVector<Column> &columns = {ASTERISK});
 
@@ -112,7 +136,9 @@ namespace Orm::Query
         QString toSql();
 
         /* Insert, Update, Delete */
-        /*! Insert new records into the database (multi-rows insert). */
+        /*! Insert new records into the database (multi-rows insert), records over
+            the bound parameters limit are inserted using more statements in one
+            transaction and only the query of the last statement is returned. */
         std::optional<SqlQuery>
         insert(const QVector<QVariantMap> &values);
         /*! Insert a new record into the database. */
@@ -443,6 +469,21 @@ namespace Orm::Query
         /*! Add an "or where not in" clause to the query. */
         Builder &orWhereNotIn(const Column &column, const QVector<QVariant> &values);
 
+        /* where IN raw */
+        /*! Add a "where in raw" clause for integer values to the query. */
+        Builder &whereIntegerInRaw(const Column &column, const QVector<QVariant> &values,
+                                   const QString &condition = AND, bool nope = false);
+        /*! Add an "or where in raw" clause for integer values to the query. */
+        Builder &orWhereIntegerInRaw(const Column &column,
+                                     const QVector<QVariant> &values);
+        /*! Add a "where not in raw" clause for integer values to the query. */
+        Builder &whereIntegerNotInRaw(const Column &column,
+                                      const QVector<QVariant> &values,
+                                      const QString &condition = AND);
+        /*! Add an "or where not in raw" clause for integer values to the query. */
+        Builder &orWhereIntegerNotInRaw(const Column &column,
+                                        const QVector<QVariant> &values);
+
         /* where null */
         /*! Add a "where null" clause to the query. */
         Builder &whereNull(const QVector<Column> &columns = {ASTERISK},
@@ -716,6 +757,17 @@ namespace Orm::Query
         /*! Lock the selected rows in the table. */
         Builder &lock(QString &&value);
 
+        /*! Use the write connection for the select query (read/write connections). */
+        Builder &useWriteConnection() noexcept;
+        /*! Set the expected number of rows, used to reserve the hydrated models. */
+        Builder &sizeHint(int rows) noexcept;
+        /*! Set the statement timeout for the select query, the query throws
+            the QueryTimeoutError if it runs longer. */
+        Builder &timeout(std::chrono::milliseconds timeout) noexcept;
+        /*! Set the maximum replication lag of the read connection for the select
+            query, the write connection is used if the replica lags more. */
+        Builder &maxStaleness(std::chrono::milliseconds staleness) noexcept;
+
         /* Debugging */
         /*! Dump the current SQL and bindings. */
         void dump(bool replaceBindings = true, bool simpleBindings = false);
@@ -734,6 +786,9 @@ namespace Orm::Query
         inline std::shared_ptr<DatabaseConnection> getConnectionShared() const noexcept;
         /*! Get the query grammar instance as a std::shared_ptr. */
         inline std::shared_ptr<QueryGrammar> getGrammarShared() const noexcept;
+        /*! Set the database connection and its query grammar, bindings
+            and constraints are preserved. */
+        Builder &setConnection(DatabaseConnection &connection);
 
         /*! Get the current query value bindings as flattened QVector. */
         QVector<QVariant> getBindings() const;
@@ -791,6 +846,17 @@ namespace Orm::Query
         /*! Get the row locking. */
         inline const std::variant<std::monostate, bool, QString> &
         getLock() const noexcept;
+        /*! Determine whether the write connection is used for the select query. */
+        inline bool getUseWriteConnection() const noexcept;
+        /*! Get the expected number of rows (-1 if unknown). */
+        inline int getSizeHint() const noexcept;
+        /*! Get the statement timeout (std::nullopt for the connection default). */
+        inline const std::optional<std::chrono::milliseconds> &
+        getTimeout() const noexcept;
+        /*! Get the maximum replication lag of the read connection (std::nullopt for
+            the connection default). */
+        inline const std::optional<std::chrono::milliseconds> &
+        getMaxStaleness() const noexcept;
 
         /* Other methods */
         /*! Get a new instance of the query builder. */
@@ -910,6 +976,13 @@ namespace Orm::Query
     private:
         /*! Run the query as a "select" statement against the connection. */
         SqlQuery runSelect();
+        /*! Run the select query callback with the statement timeout and the maximum
+            staleness (if set). */
+        SqlQuery runWithTimeout(const std::function<SqlQuery()> &callback);
+
+        /*! Get the maximum number of rows inserted by one insert statement. */
+        QVector<QVariantMap>::size_type
+        insertChunkSize(const QVector<QVariantMap> &values) const;
 
         /*! Set the table which the query is targeting. */
         inline Builder &setFrom(const FromClause &from);
@@ -990,6 +1063,14 @@ namespace Orm::Query
         int m_offset = -1;
         /*! Indicates whether row locking is being used. */
         std::variant<std::monostate, bool, QString> m_lock {};
+        /*! Whether to use the write connection for the select query. */
+        bool m_useWriteConnection = false;
+        /*! The expected number of rows (-1 if unknown). */
+        int m_sizeHint = -1;
+        /*! The statement timeout for the select query. */
+        std::optional<std::chrono::milliseconds> m_timeout = std::nullopt;
+        /*! The maximum replication lag of the read connection for the select query. */
+        std::optional<std::chrono::milliseconds> m_maxStaleness = std::nullopt;
     };
 
     /* public */
@@ -1039,12 +1120,6 @@ namespace Orm::Query
            the results and get the exact data that was requested for the query. */
         auto query = get({column, key});
 
-        const auto size = QueryUtils::queryResultSize(query);
-
-        // Empty result
-        if (size == 0)
-            return {};
-
         /* If the column is qualified with a table or have an alias, we cannot use
            those directly in the "pluck" operations, we have to strip the table out or
            use the alias name instead. */
@@ -1773,6 +1848,28 @@ namespace Orm::Query
         return m_lock;
     }
 
+    bool Builder::getUseWriteConnection() const noexcept
+    {
+        return m_useWriteConnection;
+    }
+
+    int Builder::getSizeHint() const noexcept
+    {
+        return m_sizeHint;
+    }
+
+    const std::optional<std::chrono::milliseconds> &
+    Builder::getTimeout() const noexcept
+    {
+        return m_timeout;
+    }
+
+    const std::optional<std::chrono::milliseconds> &
+    Builder::getMaxStaleness() const noexcept
+    {
+        return m_maxStaleness;
+    }
+
     Builder Builder::clone() const
     {
         return *this;
@@ -0,0 +1,215 @@
+#pragma once
+#ifndef ORM_SUPPORT_ASYNCQUERY_HPP
+#define ORM_SUPPORT_ASYNCQUERY_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include "orm/macros/coroutines.hpp"
+
+#ifdef T_COROUTINES
+#include <QVector>
+#include <QtSql/QSqlRecord>
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+class QThreadPool;
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Support
+{
+
+    /*! Thread pool and helpers shared by all the AsyncQuery-ies. */
+    class SHAREDLIB_EXPORT AsyncQueryExecutor
+    {
+        Q_DISABLE_COPY_MOVE(AsyncQueryExecutor)
+
+    public:
+        /*! Deleted default constructor, this is a pure library class. */
+        AsyncQueryExecutor() = delete;
+        /*! Deleted destructor. */
+        ~AsyncQueryExecutor() = delete;
+
+        /*! Get the thread pool that executes the async queries, every running query
+            borrows one connection from the connection pool. */
+        static QThreadPool &threadPool();
+
+        /*! Start the work in the thread pool and invoke the callback in the current
+            thread after the work is done, the current thread has to run the Qt
+            event loop (throws if it doesn't have the event dispatcher). */
+        static void start(std::function<void()> &&work,
+                          std::function<void()> &&callback);
+    };
+
+    /*! Awaitable database query, the query is executed in the AsyncQueryExecutor
+        thread pool on a connection borrowed from the connection pool and
+        the awaiting coroutine is resumed in its original thread by the queued call,
+        this thread has to run the Qt event loop or the coroutine is never resumed. */
+    template<typename T>
+    class AsyncQuery
+    {
+        Q_DISABLE_COPY(AsyncQuery)
+
+        // To access the private constructor in the then() method
+        template<typename U>
+        friend class AsyncQuery;
+
+    public:
+        /*! Constructor, the work is invoked in the async thread pool. */
+        explicit AsyncQuery(std::function<T()> &&work);
+        /*! Default destructor. */
+        inline ~AsyncQuery() = default;
+
+        /*! Move constructor. */
+        inline AsyncQuery(AsyncQuery &&) noexcept = default;
+        /*! Move assignment operator. */
+        inline AsyncQuery &operator=(AsyncQuery &&) noexcept = default;
+
+        /*! Transform the result in the awaiting thread after the query is done. */
+        template<typename Continuation>
+        auto then(Continuation &&continuation) &&;
+
+        /* Awaitable */
+        /*! The query is never ready, it's always started by the co_await. */
+        inline bool await_ready() const noexcept;
+        /*! Start the query and resume the coroutine in the current thread. */
+        void await_suspend(std::coroutine_handle<> handle);
+        /*! Get the result of the query, rethrows an exception thrown by the query. */
+        T await_resume();
+
+    private:
+        /*! Constructor from already type-erased work and continuation. */
+        inline AsyncQuery(std::function<void()> &&work,
+                          std::function<T()> &&continuation);
+
+        /*! The work invoked in the async thread pool. */
+        std::function<void()> m_work;
+        /*! Produces the result in the awaiting thread. */
+        std::function<T()> m_continuation;
+        /*! Exception thrown by the work. */
+        std::exception_ptr m_exception = nullptr;
+    };
+
+    /* public */
+
+    template<typename T>
+    AsyncQuery<T>::AsyncQuery(std::function<T()> &&work)
+    {
+        if constexpr (std::is_void_v<T>) {
+            m_work = std::move(work);
+            m_continuation = [] {};
+        }
+        else {
+            // Shared by the worker thread and the awaiting thread
+            auto result = std::make_shared<std::optional<T>>();
+
+            m_work = [work = std::move(work), result]
+            {
+                result->emplace(std::invoke(work));
+            };
+            m_continuation = [result]
+            {
+                return std::move(**result);
+            };
+        }
+    }
+
+    template<typename T>
+    template<typename Continuation>
+    auto AsyncQuery<T>::then(Continuation &&continuation) &&
+    {
+        if constexpr (std::is_void_v<T>) {
+            using ResultType = std::invoke_result_t<Continuation>;
+
+            return AsyncQuery<ResultType>(
+                        std::move(m_work),
+                        [previous = std::move(m_continuation),
+                         continuation = std::forward<Continuation>(continuation)]
+                        () mutable -> ResultType
+            {
+                std::invoke(previous);
+
+                return std::invoke(continuation);
+            });
+        }
+        else {
+            using ResultType = std::invoke_result_t<Continuation, T &&>;
+
+            return AsyncQuery<ResultType>(
+                        std::move(m_work),
+                        [previous = std::move(m_continuation),
+                         continuation = std::forward<Continuation>(continuation)]
+                        () mutable -> ResultType
+            {
+                return std::invoke(continuation, std::invoke(previous));
+            });
+        }
+    }
+
+    template<typename T>
+    bool AsyncQuery<T>::await_ready() const noexcept
+    {
+        return false;
+    }
+
+    template<typename T>
+    void AsyncQuery<T>::await_suspend(const std::coroutine_handle<> handle)
+    {
+        /* The coroutine is resumed by the queued call in the awaiting thread,
+           the AsyncQuery is alive until then. */
+        AsyncQueryExecutor::start([this]
+        {
+            try {
+                std::invoke(m_work);
+            } catch (...) {
+                m_exception = std::current_exception();
+            }
+        },
+            [handle]
+        {
+            handle.resume();
+        });
+    }
+
+    template<typename T>
+    T AsyncQuery<T>::await_resume()
+    {
+        if (m_exception)
+            std::rethrow_exception(m_exception);
+
+        return std::invoke(m_continuation);
+    }
+
+    /* private */
+
+    template<typename T>
+    AsyncQuery<T>::AsyncQuery(std::function<void()> &&work,
+                              std::function<T()> &&continuation)
+        : m_work(std::move(work))
+        , m_continuation(std::move(continuation))
+    {}
+
+} // namespace Support
+
+    /*! Alias for the AsyncQuery. */
+    template<typename T>
+    using AsyncQuery = Support::AsyncQuery<T>;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // T_COROUTINES
+
+#endif // ORM_SUPPORT_ASYNCQUERY_HPP
@@ -0,0 +1,220 @@
+#pragma once
+#ifndef ORM_SUPPORT_CONNECTIONPOOL_HPP
+#define ORM_SUPPORT_CONNECTIONPOOL_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QVariantHash>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "orm/macros/export.hpp"
+#include "orm/types/connectionpoolstats.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+    class DatabaseConnection;
+
+namespace Support
+{
+    class PooledConnection;
+
+    /*! Bounded pool of database connections shared across threads.
+        Every pooled DatabaseConnection has its own QSqlDatabase connection, a borrowed
+        connection is used exclusively by the borrowing thread, the underlying
+        QSqlDriver thread affinity is handed over during the acquire/release.
+        The pool must be owned by the std::shared_ptr, the borrowed connections keep
+        it alive. */
+    class SHAREDLIB_EXPORT ConnectionPool :
+            public std::enable_shared_from_this<ConnectionPool>
+    {
+        Q_DISABLE_COPY_MOVE(ConnectionPool)
+
+        // To access the release() method
+        friend PooledConnection;
+
+    public:
+        /*! Constructor, the config is the original connection configuration,
+            the reader pool contains the read-only SQLite wal_readers connections. */
+        ConnectionPool(const QString &name, const QVariantHash &config,
+                       bool readers = false);
+        /*! Destructor. */
+        ~ConnectionPool();
+
+        /*! Borrow a connection, waits up to the pool_acquire_timeout. */
+        PooledConnection acquire();
+        /*! Borrow a connection, waits up to the given timeout. */
+        PooledConnection acquire(std::chrono::milliseconds timeout);
+
+        /*! Get the connection name this pool was created for. */
+        inline const QString &getName() const noexcept;
+        /*! Determine whether it's the pool of the read-only wal_readers connections. */
+        inline bool isReaderPool() const noexcept;
+        /*! Determine whether the given connection configuration has the reader pool
+            (the SQLite connection with the wal_readers configuration option). */
+        static bool hasReaderPool(const QVariantHash &config);
+        /*! Get the minimum number of connections kept in the pool. */
+        inline std::size_t minSize() const noexcept;
+        /*! Get the maximum number of connections in the pool. */
+        inline std::size_t maxSize() const noexcept;
+        /*! Get the default acquire timeout. */
+        inline std::chrono::milliseconds acquireTimeout() const noexcept;
+        /*! Get the idle time after which the idle connection is pinged. */
+        inline std::chrono::milliseconds keepAliveInterval() const noexcept;
+        /*! Get the idle time after which the idle connection is closed. */
+        inline std::chrono::milliseconds maxIdleTime() const noexcept;
+
+        /*! Ping the idle connections that are idle longer than the keepalive interval
+            and close the connections that are idle longer than the max. idle time. */
+        void maintain();
+
+        /*! Disconnect and remove all idle connections, throws if any connection
+            is borrowed. */
+        void disconnect();
+
+        /*! Get the pool statistics. */
+        ConnectionPoolStats stats() const;
+        /*! Reset the acquire and wait time statistics. */
+        void resetStats();
+
+    private:
+        /*! Idle connection and its idle time points. */
+        struct IdleConnection
+        {
+            /*! The idle connection. */
+            std::shared_ptr<DatabaseConnection> connection;
+            /*! Time point when the connection was returned back to the pool. */
+            std::chrono::steady_clock::time_point idleSince;
+            /*! Time point of the last keepalive ping (or the idleSince). */
+            std::chrono::steady_clock::time_point lastActivity;
+        };
+
+        /*! Result of the maintenance of one idle connection. */
+        enum struct Maintenance
+        {
+            /*! Nothing was done, the connection is not open. */
+            None,
+            /*! The connection was pinged. */
+            Pinged,
+            /*! The connection was pinged and reconnected after the failed ping. */
+            Revived,
+            /*! The ping and the reconnect failed, the connection was closed. */
+            Failed,
+            /*! The connection was closed. */
+            Reaped,
+        };
+
+        /*! Return a borrowed connection back to the pool. */
+        void release(std::shared_ptr<DatabaseConnection> &&connection) noexcept;
+        /*! Update the acquire statistics (the m_mutex must be locked). */
+        void recordAcquired(bool waited, qint64 elapsed);
+        /*! Disconnect and remove all idle connections (the m_mutex must be locked). */
+        void removeIdleConnections();
+        /*! Remove the QSqlDatabase connection of the given name and its read connection
+            (the read/write connection). */
+        static void removeQtConnections(const QString &name);
+
+        /*! Determine whether the idle connection is due for the maintenance. */
+        bool isMaintenanceDue(const IdleConnection &idle,
+                              std::chrono::steady_clock::time_point now) const;
+        /*! Ping or close the given idle connection (in the current thread). */
+        Maintenance maintainConnection(DatabaseConnection &connection,
+                                       const IdleConnection &idle,
+                                       std::chrono::steady_clock::time_point now) const;
+        /*! Ping the database, uses the mysql_ping() if enabled, select 1 otherwise. */
+        static bool pingConnection(DatabaseConnection &connection);
+
+        /*! Create a new pooled database connection instance. */
+        std::shared_ptr<DatabaseConnection> makeConnection(std::size_t index);
+        /*! Refresh the QSqlDatabase connection resolver on the pooled connection. */
+        void refreshQtConnection(const QString &name);
+
+        /*! Throw if the pool configuration is invalid. */
+        void throwIfInvalidSize() const;
+
+        /*! Connection name this pool was created for. */
+        QString m_name;
+        /*! Determine whether it's the pool of the read-only wal_readers connections. */
+        bool m_readers;
+        /*! The configuration of the pooled connections. */
+        QVariantHash m_config;
+        /*! The minimum number of connections kept in the pool. */
+        std::size_t m_minSize;
+        /*! The maximum number of connections in the pool. */
+        std::size_t m_maxSize;
+        /*! The default acquire timeout. */
+        std::chrono::milliseconds m_acquireTimeout;
+        /*! The idle time after which the idle connection is pinged (0 disabled). */
+        std::chrono::milliseconds m_keepAliveInterval;
+        /*! The idle time after which the idle connection is closed (0 disabled). */
+        std::chrono::milliseconds m_maxIdleTime;
+
+        /*! Mutex that guards all the data members below. */
+        mutable std::mutex m_mutex;
+        /*! Signaled when a connection is returned to the pool. */
+        std::condition_variable m_released;
+        /*! All connections created by the pool. */
+        std::vector<std::shared_ptr<DatabaseConnection>> m_connections;
+        /*! Idle connections ready to be borrowed. */
+        std::deque<IdleConnection> m_idle;
+        /*! Number of connections reserved for creation or already created. */
+        std::size_t m_size = 0;
+        /*! Number of idle connections taken out of the pool by all maintain() calls. */
+        std::size_t m_maintaining = 0;
+        /*! Next index used to compose the QSqlDatabase connection name. */
+        std::size_t m_nextIndex = 0;
+        /*! Pool statistics. */
+        ConnectionPoolStats m_stats {};
+    };
+
+    /* public */
+
+    const QString &ConnectionPool::getName() const noexcept
+    {
+        return m_name;
+    }
+
+    bool ConnectionPool::isReaderPool() const noexcept
+    {
+        return m_readers;
+    }
+
+    std::size_t ConnectionPool::minSize() const noexcept
+    {
+        return m_minSize;
+    }
+
+    std::size_t ConnectionPool::maxSize() const noexcept
+    {
+        return m_maxSize;
+    }
+
+    std::chrono::milliseconds ConnectionPool::acquireTimeout() const noexcept
+    {
+        return m_acquireTimeout;
+    }
+
+    std::chrono::milliseconds ConnectionPool::keepAliveInterval() const noexcept
+    {
+        return m_keepAliveInterval;
+    }
+
+    std::chrono::milliseconds ConnectionPool::maxIdleTime() const noexcept
+    {
+        return m_maxIdleTime;
+    }
+
+} // namespace Support
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_CONNECTIONPOOL_HPP
@@ -0,0 +1,71 @@
+#pragma once
+#ifndef ORM_SUPPORT_KEEPALIVESCHEDULER_HPP
+#define ORM_SUPPORT_KEEPALIVESCHEDULER_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QtGlobal>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+    /*! Invokes the keepalive task periodically in the background thread, the thread
+        is started by the constructor and stopped by the destructor. */
+    class SHAREDLIB_EXPORT KeepAliveScheduler
+    {
+        Q_DISABLE_COPY_MOVE(KeepAliveScheduler)
+
+    public:
+        /*! Constructor, starts the background thread. */
+        KeepAliveScheduler(std::chrono::milliseconds interval,
+                           std::function<void()> &&task);
+        /*! Destructor, stops and joins the background thread. */
+        ~KeepAliveScheduler();
+
+        /*! Get the interval between two task invocations. */
+        inline std::chrono::milliseconds interval() const noexcept;
+
+    private:
+        /*! The background thread loop. */
+        void run();
+
+        /*! The interval between two task invocations. */
+        std::chrono::milliseconds m_interval;
+        /*! The task invoked periodically. */
+        std::function<void()> m_task;
+
+        /*! Mutex that guards the m_stopping. */
+        std::mutex m_mutex;
+        /*! Signaled when the scheduler is being stopped. */
+        std::condition_variable m_stop;
+        /*! Determine whether the scheduler is being stopped. */
+        bool m_stopping = false;
+
+        /*! The background thread (the last data member, it uses all the others). */
+        std::thread m_thread;
+    };
+
+    /* public */
+
+    std::chrono::milliseconds KeepAliveScheduler::interval() const noexcept
+    {
+        return m_interval;
+    }
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_KEEPALIVESCHEDULER_HPP
@@ -0,0 +1,123 @@
+#pragma once
+#ifndef ORM_SUPPORT_POOLEDCONNECTION_HPP
+#define ORM_SUPPORT_POOLEDCONNECTION_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include "orm/databaseconnection.hpp"
+#include "orm/support/connectionpool.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+    /*! RAII handle for a connection borrowed from the ConnectionPool, the connection
+        is returned back to the pool when the handle is destroyed. */
+    class PooledConnection
+    {
+        Q_DISABLE_COPY(PooledConnection)
+
+    public:
+        /*! Constructor. */
+        inline PooledConnection(std::shared_ptr<ConnectionPool> &&pool,
+                                std::shared_ptr<DatabaseConnection> &&connection);
+        /*! Destructor, returns the connection back to the pool. */
+        inline ~PooledConnection() noexcept;
+
+        /*! Move constructor. */
+        inline PooledConnection(PooledConnection &&other) noexcept;
+        /*! Move assignment operator. */
+        inline PooledConnection &operator=(PooledConnection &&other) noexcept;
+
+        /*! Return a pointer to the borrowed database connection. */
+        inline DatabaseConnection *operator->() const noexcept;
+        /*! Return a reference to the borrowed database connection. */
+        inline DatabaseConnection &operator*() const noexcept;
+        /*! Return a reference to the borrowed database connection. */
+        inline DatabaseConnection &get() const noexcept;
+
+        /*! Determine whether the handle holds a connection. */
+        inline explicit operator bool() const noexcept;
+
+        /*! Return the connection back to the pool before the handle is destroyed. */
+        inline void release() noexcept;
+
+    private:
+        /*! The pool the connection was borrowed from, kept alive until the release. */
+        std::shared_ptr<ConnectionPool> m_pool;
+        /*! The borrowed database connection. */
+        std::shared_ptr<DatabaseConnection> m_connection;
+    };
+
+    /* public */
+
+    PooledConnection::PooledConnection(
+            std::shared_ptr<ConnectionPool> &&pool,
+            std::shared_ptr<DatabaseConnection> &&connection
+    )
+        : m_pool(std::move(pool))
+        , m_connection(std::move(connection))
+    {}
+
+    PooledConnection::~PooledConnection() noexcept
+    {
+        release();
+    }
+
+    PooledConnection::PooledConnection(PooledConnection &&other) noexcept
+        : m_pool(std::move(other.m_pool))
+        , m_connection(std::move(other.m_connection))
+    {}
+
+    PooledConnection &PooledConnection::operator=(PooledConnection &&other) noexcept
+    {
+        if (this == std::addressof(other))
+            return *this;
+
+        release();
+
+        m_pool = std::move(other.m_pool);
+        m_connection = std::move(other.m_connection);
+
+        return *this;
+    }
+
+    DatabaseConnection *PooledConnection::operator->() const noexcept
+    {
+        return m_connection.get();
+    }
+
+    DatabaseConnection &PooledConnection::operator*() const noexcept
+    {
+        return *m_connection;
+    }
+
+    DatabaseConnection &PooledConnection::get() const noexcept
+    {
+        return *m_connection;
+    }
+
+    PooledConnection::operator bool() const noexcept
+    {
+        return static_cast<bool>(m_connection);
+    }
+
+    void PooledConnection::release() noexcept
+    {
+        // Nothing to release, moved from or already released
+        if (!m_connection)
+            return;
+
+        m_pool->release(std::move(m_connection));
+
+        m_connection.reset();
+        m_pool.reset();
+    }
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_POOLEDCONNECTION_HPP
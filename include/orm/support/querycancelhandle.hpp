@@ -0,0 +1,95 @@
+#pragma once
+#ifndef ORM_SUPPORT_QUERYCANCELHANDLE_HPP
+#define ORM_SUPPORT_QUERYCANCELHANDLE_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QString>
+
+#include <memory>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+class QSqlDatabase;
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Support
+{
+
+    /*! Cancels the query running on the database connection from another thread,
+        the cancel request is sent through a new short-lived connection, the password
+        is owned by the DatabaseConnection, the handle only references it. */
+    class SHAREDLIB_EXPORT QueryCancelHandle
+    {
+    public:
+        /*! Default constructor, creates an invalid handle. */
+        inline QueryCancelHandle() = default;
+        /*! Constructor, must be called in the thread that owns the connection. */
+        QueryCancelHandle(const QSqlDatabase &connection, QString cancelQuery,
+                          const std::shared_ptr<const QString> &password);
+        /*! Default destructor. */
+        inline ~QueryCancelHandle() = default;
+
+        /*! Copy constructor. */
+        inline QueryCancelHandle(const QueryCancelHandle &) = default;
+        /*! Copy assignment operator. */
+        inline QueryCancelHandle &operator=(const QueryCancelHandle &) = default;
+
+        /*! Move constructor. */
+        inline QueryCancelHandle(QueryCancelHandle &&) noexcept = default;
+        /*! Move assignment operator. */
+        inline QueryCancelHandle &operator=(QueryCancelHandle &&) noexcept = default;
+
+        /*! Determine whether the handle can cancel queries (supported by the driver). */
+        inline bool isValid() const noexcept;
+
+        /*! Cancel the currently running query, can be called from any thread, returns
+            whether the cancel request was sent (it's a no-op if no query is running). */
+        bool cancel() const;
+
+        /*! Create the shared password of the given connection for the handles, it's
+            overwritten in memory when the last owner releases it. */
+        static std::shared_ptr<const QString>
+        makePassword(const QSqlDatabase &connection);
+
+    private:
+        /*! The QSqlDatabase driver name. */
+        QString m_driverName {};
+        /*! The database host name. */
+        QString m_hostName {};
+        /*! The database port. */
+        int m_port = -1;
+        /*! The database name. */
+        QString m_databaseName {};
+        /*! The database user name. */
+        QString m_userName {};
+        /*! The database password owned by the DatabaseConnection (expires with it). */
+        std::weak_ptr<const QString> m_password {};
+        /*! The driver connect options. */
+        QString m_connectOptions {};
+        /*! The SQL that cancels the query running on the connection. */
+        QString m_cancelQuery {};
+    };
+
+    /* public */
+
+    bool QueryCancelHandle::isValid() const noexcept
+    {
+        return !m_cancelQuery.isEmpty();
+    }
+
+} // namespace Support
+
+    /*! Alias for the QueryCancelHandle. */
+    using QueryCancelHandle = Support::QueryCancelHandle;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_QUERYCANCELHANDLE_HPP
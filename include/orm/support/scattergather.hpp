@@ -0,0 +1,115 @@
+#pragma once
+#ifndef ORM_SUPPORT_SCATTERGATHER_HPP
+#define ORM_SUPPORT_SCATTERGATHER_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QStringList>
+#include <QtSql/QSqlRecord>
+
+#include <chrono>
+#include <optional>
+
+#include "orm/macros/export.hpp"
+#include "orm/ormtypes.hpp"
+
+class QThreadPool;
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+    class DatabaseManager;
+
+namespace Support
+{
+
+    /*! Options of the query executed on every connection by the ScatterGather. */
+    struct ScatterGatherOptions
+    {
+        /*! Send the query to the write connection of the read/write connections. */
+        bool useWriteConnection = false;
+        /*! Statement timeout (the timeout of the connection if std::nullopt). */
+        std::optional<std::chrono::milliseconds> timeout = std::nullopt;
+        /*! Maximum replication lag of the read connection (the max_replica_lag
+            of the connection if std::nullopt). */
+        std::optional<std::chrono::milliseconds> maxStaleness = std::nullopt;
+    };
+
+    /*! Runs the same query on many connections concurrently (scatter) and merges
+        their results (gather), every worker borrows a connection from the connection
+        pool of the given connection. */
+    class SHAREDLIB_EXPORT ScatterGather
+    {
+        Q_DISABLE_COPY_MOVE(ScatterGather)
+
+    public:
+        /*! Record with the index of the result (connection) it comes from. */
+        using IndexedRecord = std::pair<QVector<QSqlRecord>::size_type, QSqlRecord>;
+
+        /*! Deleted default constructor, this is a pure library class. */
+        ScatterGather() = delete;
+        /*! Deleted destructor. */
+        ~ScatterGather() = delete;
+
+        /*! Run the select query on all the given connections concurrently, results
+            are in the same order as the connections. */
+        static QVector<QVector<QSqlRecord>>
+        select(DatabaseManager &manager, const QStringList &connections,
+               const QString &query, const QVector<QVariant> &bindings,
+               const ScatterGatherOptions &options = {});
+
+        /*! Concatenate the results in the order of the connections. */
+        static QVector<QSqlRecord> concat(QVector<QVector<QSqlRecord>> &&results);
+        /*! Merge the results, every result has to be already sorted by the given
+            order by items (their columns have to be in the select list), null values
+            are the smallest unless nullsLast is true (PostgreSQL). Strings are
+            compared binary, so only binary-collated string columns merge in the same
+            order as the database sorts them. */
+        static QVector<QSqlRecord>
+        mergeSorted(QVector<QVector<QSqlRecord>> &&results,
+                    const QVector<OrderByItem> &orders, bool nullsLast = false);
+        /*! Merge the results the same way as the mergeSorted(), every record is
+            returned with the index of the result (connection) it comes from. */
+        static QVector<IndexedRecord>
+        mergeSortedIndexed(QVector<QVector<QSqlRecord>> &&results,
+                           const QVector<OrderByItem> &orders, bool nullsLast = false);
+
+        /*! Get the thread pool that executes queries on the connections, it grows
+            to the number of the queried connections. */
+        static QThreadPool &threadPool();
+
+    private:
+        /*! Order by item resolved to the field name in the fetched records. */
+        struct MergeOrder
+        {
+            /*! Field name (without the table qualifier). */
+            QString fieldName;
+            /*! Determine whether the order is descending. */
+            bool descending;
+        };
+
+        /*! Resolve the field names for the order by items, throws for raw orders. */
+        static QVector<MergeOrder> mergeOrders(const QVector<OrderByItem> &orders);
+        /*! Throw if the order by field isn't in the fetched record. */
+        static void throwIfMissingOrderField(const QSqlRecord &record,
+                                             const QVector<MergeOrder> &orders);
+        /*! Make sure the thread pool has one worker thread for every connection. */
+        static void reserveThreads(int count);
+
+        /*! Compare the given records by the order by items. */
+        static bool lessThan(const QSqlRecord &left, const QSqlRecord &right,
+                             const QVector<MergeOrder> &orders, bool nullsLast);
+        /*! Compare the given values, nulls are the smallest or the largest if
+            nullsLast is true (-1, 0, or 1). */
+        static int compareValues(const QVariant &left, const QVariant &right,
+                                 bool nullsLast);
+    };
+
+} // namespace Support
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_SCATTERGATHER_HPP
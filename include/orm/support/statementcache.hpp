@@ -0,0 +1,114 @@
+#pragma once
+#ifndef ORM_SUPPORT_STATEMENTCACHE_HPP
+#define ORM_SUPPORT_STATEMENTCACHE_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QtSql/QSqlQuery>
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+#include "orm/macros/export.hpp"
+#include "orm/types/statementcachestats.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+    /*! LRU cache of the idle prepared QSqlQuery-ies keyed by the SQL query string.
+        A statement is checked out of the cache while its result is in use and it's
+        checked in back after that, so a busy statement is never handed out twice. */
+    class SHAREDLIB_EXPORT StatementCache :
+            public std::enable_shared_from_this<StatementCache>
+    {
+        Q_DISABLE_COPY_MOVE(StatementCache)
+
+    public:
+        /*! Check-in handler type, returns the statement back to the cache. */
+        using CheckInType = std::function<void(QSqlQuery &&)>;
+
+        /*! Constructor, the zero capacity disables the cache. */
+        inline explicit StatementCache(std::size_t capacity = 0) noexcept;
+        /*! Default destructor. */
+        inline ~StatementCache() = default;
+
+        /*! Check out the cached prepared query (removes it from the cache). */
+        std::unique_ptr<QSqlQuery> checkOut(const QString &queryString);
+        /*! Check in the idle prepared query, evicts the least recently used query
+            if full. */
+        void checkIn(const QString &queryString, std::unique_ptr<QSqlQuery> &&query);
+        /*! Get the handler that checks in the statement after its result is no longer
+            used (ignored if the cache was cleared meanwhile or if it's called from
+            another thread, it can outlive the cache). */
+        CheckInType checkInHandler(const QString &queryString);
+        /*! Remove the given query string from the cache. */
+        void remove(const QString &queryString);
+        /*! Remove all cached queries (statistics are preserved). */
+        void clear();
+
+        /*! Determine whether the cache is enabled. */
+        inline bool isEnabled() const noexcept;
+        /*! Get the maximum number of cached queries. */
+        inline std::size_t capacity() const noexcept;
+        /*! Set the maximum number of cached queries, the zero disables the cache. */
+        void setCapacity(std::size_t capacity);
+
+        /*! Get the cache statistics. */
+        StatementCacheStats stats() const;
+        /*! Reset the hits, misses, and evictions statistics. */
+        void resetStats() noexcept;
+
+    private:
+        /*! Cache entry type (query string and the prepared query). */
+        using EntryType = std::pair<QString, std::unique_ptr<QSqlQuery>>;
+        /*! Cache entries list type, the front is the most recently used. */
+        using EntriesType = std::list<EntryType>;
+
+        /*! Evict the least recently used entries above the capacity. */
+        void evictOverflow();
+
+        /*! The maximum number of cached queries. */
+        std::size_t m_capacity;
+        /*! Cached entries ordered by usage, the front is the most recently used. */
+        EntriesType m_entries;
+        /*! Map the query string to the position in the entries list. */
+        std::unordered_map<QString, EntriesType::iterator> m_index;
+
+        /*! Incremented by the clear(), checked out statements can't be checked in after
+            the clear (they belong to the disconnected connection). */
+        std::size_t m_generation = 0;
+
+        /*! Number of prepared statements served from the cache. */
+        std::size_t m_hits = 0;
+        /*! Number of statements that had to be prepared. */
+        std::size_t m_misses = 0;
+        /*! Number of the least recently used statements removed from the cache. */
+        std::size_t m_evictions = 0;
+    };
+
+    /* public */
+
+    StatementCache::StatementCache(const std::size_t capacity) noexcept
+        : m_capacity(capacity)
+    {}
+
+    bool StatementCache::isEnabled() const noexcept
+    {
+        return m_capacity > 0;
+    }
+
+    std::size_t StatementCache::capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_STATEMENTCACHE_HPP
@@ -83,6 +83,8 @@ namespace Orm::Tiny
         using BaseModelType = Model<Derived, AllRelations...>;
         /*! The Derived model type. */
         using DerivedType = Derived;
+        /*! Shard resolver type, maps the shard key value to the connection name. */
+        using ShardResolver = std::function<QString(const QVariant &shardKey)>;
 
         /* Constructors */
         /*! Create a new TinORM model instance, default constructor. */
@@ -272,6 +274,17 @@ namespace Orm::Tiny
         inline Derived &setConnection(QString &&name);
         /*! Set the table associated with the model. */
         inline Derived &setTable(const QString &value);
+
+        /* Sharding */
+        /*! Determine whether the model is sharded (the u_shardKey is defined). */
+        inline static bool isSharded();
+        /*! Get the shard key column. */
+        inline static const QString &getShardKey();
+        /*! Get the connection names of all shards. */
+        inline static const QStringList &getShards();
+        /*! Get the connection name of the shard for the given shard key value. */
+        static QString resolveShard(const QVariant &shardKey);
+
         /*! Get the table associated with the model. */
         const QString &getTable() const;
         /*! Get the primary key for the model. */
@@ -348,6 +361,16 @@ namespace Orm::Tiny
         // TODO detect (best at compile time) circular eager relation problem, the exception which happens during this problem is stackoverflow in QRegularExpression silverqx
         /*! The relations to eager load on every query. */
         QVector<QString> u_with;
+
+        /* Sharding */
+        /*! The shard key column, if defined then queries and new models are routed
+            to the shard returned by the u_shardResolver for the shard key value. */
+        inline static const QString u_shardKey;
+        /*! Map the shard key value to the connection name of the shard. */
+        inline static const ShardResolver u_shardResolver;
+        /*! Connection names of all shards, queries without the shard key are
+            executed on all of them. */
+        inline static const QStringList u_shards;
         /*! The relationship counts that should be eager loaded on every query. */
 //        QVector<WithItem> u_withCount;
 
@@ -700,6 +723,11 @@ namespace Orm::Tiny
     {
 //        mergeAttributesFromClassCasts();
 
+        /* The new sharded model is inserted into the shard of its shard key value,
+           existing models already have the connection of the shard they come from. */
+        if (!exists && isSharded() && getConnectionName().isEmpty())
+            setConnection(resolveShard(this->getAttribute(getShardKey())));
+
         // Ownership of a unique_ptr()
         auto query = newModelQuery();
 
@@ -1332,6 +1360,59 @@ namespace Orm::Tiny
         return table;
     }
 
+    /* Sharding */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    bool Model<Derived, AllRelations...>::isSharded()
+    {
+        return !Derived::u_shardKey.isEmpty();
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    const QString &
+    Model<Derived, AllRelations...>::getShardKey()
+    {
+        return Derived::u_shardKey;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    const QStringList &
+    Model<Derived, AllRelations...>::getShards()
+    {
+        return Derived::u_shards;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    QString
+    Model<Derived, AllRelations...>::resolveShard(const QVariant &shardKey)
+    {
+        const auto &resolver = Derived::u_shardResolver;
+
+        if (!resolver)
+            throw Orm::Exceptions::RuntimeError(
+                    QStringLiteral("The u_shardResolver is not defined on the '%1' "
+                                   "model in %2().")
+                    .arg(TypeUtils::classPureBasename<Derived>(), __tiny_func__));
+
+        if (!shardKey.isValid() || shardKey.isNull())
+            throw Orm::Exceptions::InvalidArgumentError(
+                    QStringLiteral("The '%1' shard key can't be null on the '%2' "
+                                   "model in %3().")
+                    .arg(Derived::u_shardKey, TypeUtils::classPureBasename<Derived>(),
+                         __tiny_func__));
+
+        auto connection = std::invoke(resolver, shardKey);
+
+        if (connection.isEmpty())
+            throw Orm::Exceptions::InvalidArgumentError(
+                    QStringLiteral("No shard for the '%1' shard key value on the '%2' "
+                                   "model in %3().")
+                    .arg(shardKey.value<QString>(),
+                         TypeUtils::classPureBasename<Derived>(), __tiny_func__));
+
+        return connection;
+    }
+
     template<typename Derived, AllRelationsConcept ...AllRelations>
     const QString &
     Model<Derived, AllRelations...>::getKeyName() const
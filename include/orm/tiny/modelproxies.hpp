@@ -522,6 +522,22 @@ namespace Tiny
         static std::unique_ptr<TinyBuilder<Derived>>
         orWhereNotIn(const Column &column, const QVector<QVariant> &values);
 
+        /* where IN raw */
+        /*! Add a "where in raw" clause for integer values to the query. */
+        static std::unique_ptr<TinyBuilder<Derived>>
+        whereIntegerInRaw(const Column &column, const QVector<QVariant> &values,
+                          const QString &condition = AND, bool nope = false);
+        /*! Add an "or where in raw" clause for integer values to the query. */
+        static std::unique_ptr<TinyBuilder<Derived>>
+        orWhereIntegerInRaw(const Column &column, const QVector<QVariant> &values);
+        /*! Add a "where not in raw" clause for integer values to the query. */
+        static std::unique_ptr<TinyBuilder<Derived>>
+        whereIntegerNotInRaw(const Column &column, const QVector<QVariant> &values,
+                             const QString &condition = AND);
+        /*! Add an "or where not in raw" clause for integer values to the query. */
+        static std::unique_ptr<TinyBuilder<Derived>>
+        orWhereIntegerNotInRaw(const Column &column, const QVector<QVariant> &values);
+
         /* where null */
         /*! Add a "where null" clause to the query. */
         static std::unique_ptr<TinyBuilder<Derived>>
@@ -2317,6 +2333,58 @@ namespace Tiny
         return builder;
     }
 
+    /* where IN raw */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    std::unique_ptr<TinyBuilder<Derived>>
+    ModelProxies<Derived, AllRelations...>::whereIntegerInRaw(
+            const Column &column, const QVector<QVariant> &values,
+            const QString &condition, const bool nope)
+    {
+        auto builder = query();
+
+        builder->whereIntegerInRaw(column, values, condition, nope);
+
+        return builder;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    std::unique_ptr<TinyBuilder<Derived>>
+    ModelProxies<Derived, AllRelations...>::orWhereIntegerInRaw(
+            const Column &column, const QVector<QVariant> &values)
+    {
+        auto builder = query();
+
+        builder->orWhereIntegerInRaw(column, values);
+
+        return builder;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    std::unique_ptr<TinyBuilder<Derived>>
+    ModelProxies<Derived, AllRelations...>::whereIntegerNotInRaw(
+            const Column &column, const QVector<QVariant> &values,
+            const QString &condition)
+    {
+        auto builder = query();
+
+        builder->whereIntegerNotInRaw(column, values, condition);
+
+        return builder;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    std::unique_ptr<TinyBuilder<Derived>>
+    ModelProxies<Derived, AllRelations...>::orWhereIntegerNotInRaw(
+            const Column &column, const QVector<QVariant> &values)
+    {
+        auto builder = query();
+
+        builder->orWhereIntegerNotInRaw(column, values);
+
+        return builder;
+    }
+
     /* where null */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
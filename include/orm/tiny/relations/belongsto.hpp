@@ -198,7 +198,8 @@ namespace Orm::Tiny::Relations
            a non-standard name and not "id". We will then construct the constraint for
            our eagerly loading query so it returns the proper models from execution. */
         this->whereInEager(DOT_IN.arg(this->m_related->getTable(), m_ownerKey),
-                           getEagerModelKeys(models));
+                           getEagerModelKeys(models),
+                           this->shouldInlineEagerKeys(*this->m_related, m_ownerKey));
     }
 
     template<class Model, class Related>
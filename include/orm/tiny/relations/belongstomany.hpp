@@ -424,7 +424,8 @@ namespace Orm::Tiny::Relations
             const QVector<Model> &models)
     {
         this->whereInEager(getQualifiedForeignPivotKeyName(),
-                           this->getKeys(models, m_parentKey));
+                           this->getKeys(models, m_parentKey),
+                           this->shouldInlineEagerKeys(*this->m_parent, m_parentKey));
     }
 
     template<class Model, class Related, class PivotType>
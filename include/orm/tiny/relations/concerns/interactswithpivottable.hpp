@@ -823,7 +823,7 @@ namespace Concerns
         auto query = newPivotQuery()->get();
 
         QVector<PivotType> pivots;
-        pivots.reserve(QueryUtils::queryResultSize(query));
+        pivots.reserve(QueryUtils::queryResultSizeHint(query));
 
         while (query.next())
             // std::move() is really needed here
@@ -165,7 +165,8 @@ namespace Orm::Tiny::Relations
     void
     HasOneOrMany<Model, Related>::addEagerConstraints(const QVector<Model> &models)
     {
-        this->whereInEager(m_foreignKey, this->getKeys(models, m_localKey));
+        this->whereInEager(m_foreignKey, this->getKeys(models, m_localKey),
+                           this->shouldInlineEagerKeys(*this->m_parent, m_localKey));
     }
 
     /* Getters / Setters */
@@ -137,7 +137,12 @@ namespace Relations
         inline void init() const;
 
         /*! Add a whereIn eager constraint for a given set of model keys to be loaded. */
-        void whereInEager(const QString &key, const QVector<QVariant> &modelKeys);
+        void whereInEager(const QString &key, const QVector<QVariant> &modelKeys,
+                          bool inlineKeys = false);
+        /*! Determine whether the keys of the given model can be inlined into the eager
+            constraint (incrementing integral primary key). */
+        template<typename KeyModel>
+        static bool shouldInlineEagerKeys(const KeyModel &model, const QString &key);
 
         /*! Get all of the primary keys for the vector of models. */
         QVector<QVariant>
@@ -338,13 +343,28 @@ namespace Relations
 
     template<class Model, class Related>
     void Relation<Model, Related>::whereInEager(const QString &key,
-                                                const QVector<QVariant> &modelKeys)
+                                                const QVector<QVariant> &modelKeys,
+                                                const bool inlineKeys)
     {
-        getBaseQuery().whereIn(key, modelKeys);
+        /* Integer keys are inlined into the query string, binding thousands of keys
+           one by one is much slower and the driver doesn't have to convert them. */
+        if (inlineKeys)
+            getBaseQuery().whereIntegerInRaw(key, modelKeys);
+        else
+            getBaseQuery().whereIn(key, modelKeys);
+
+        // Set empty keys flag (also reset, eager loads can be added in chunks)
+        m_eagerKeysWereEmpty = modelKeys.isEmpty();
+    }
 
-        // Set empty keys flag
-        if (modelKeys.isEmpty())
-            m_eagerKeysWereEmpty = true;
+    template<class Model, class Related>
+    template<typename KeyModel>
+    bool Relation<Model, Related>::shouldInlineEagerKeys(const KeyModel &model,
+                                                         const QString &key)
+    {
+        return std::is_integral_v<typename KeyModel::KeyType> &&
+               model.getIncrementing() &&
+               (key.isEmpty() || key == model.getKeyName());
     }
 
     template<class Model, class Related>
@@ -516,6 +516,22 @@ namespace Tiny::Relations
         const Relation<Model, Related> &orWhereNotIn(
                 const Column &column, const QVector<QVariant> &values) const;
 
+        /* where IN raw */
+        /*! Add a "where in raw" clause for integer values to the query. */
+        const Relation<Model, Related> &whereIntegerInRaw(
+                const Column &column, const QVector<QVariant> &values,
+                const QString &condition = AND, bool nope = false) const;
+        /*! Add an "or where in raw" clause for integer values to the query. */
+        const Relation<Model, Related> &orWhereIntegerInRaw(
+                const Column &column, const QVector<QVariant> &values) const;
+        /*! Add a "where not in raw" clause for integer values to the query. */
+        const Relation<Model, Related> &whereIntegerNotInRaw(
+                const Column &column, const QVector<QVariant> &values,
+                const QString &condition = AND) const;
+        /*! Add an "or where not in raw" clause for integer values to the query. */
+        const Relation<Model, Related> &orWhereIntegerNotInRaw(
+                const Column &column, const QVector<QVariant> &values) const;
+
         /* where null */
         /*! Add a "where null" clause to the query. */
         const Relation<Model, Related> &whereNull(
@@ -2205,6 +2221,50 @@ namespace Tiny::Relations
         return relation();
     }
 
+    /* where IN raw */
+
+    template<class Model, class Related>
+    const Relation<Model, Related> &
+    RelationProxies<Model, Related>::whereIntegerInRaw(
+            const Column &column, const QVector<QVariant> &values,
+            const QString &condition, const bool nope) const
+    {
+        getQuery().whereIntegerInRaw(column, values, condition, nope);
+
+        return relation();
+    }
+
+    template<class Model, class Related>
+    const Relation<Model, Related> &
+    RelationProxies<Model, Related>::orWhereIntegerInRaw(
+            const Column &column, const QVector<QVariant> &values) const
+    {
+        getQuery().orWhereIntegerInRaw(column, values);
+
+        return relation();
+    }
+
+    template<class Model, class Related>
+    const Relation<Model, Related> &
+    RelationProxies<Model, Related>::whereIntegerNotInRaw(
+            const Column &column, const QVector<QVariant> &values,
+            const QString &condition) const
+    {
+        getQuery().whereIntegerNotInRaw(column, values, condition);
+
+        return relation();
+    }
+
+    template<class Model, class Related>
+    const Relation<Model, Related> &
+    RelationProxies<Model, Related>::orWhereIntegerNotInRaw(
+            const Column &column, const QVector<QVariant> &values) const
+    {
+        getQuery().orWhereIntegerNotInRaw(column, values);
+
+        return relation();
+    }
+
     /* where null */
 
     template<class Model, class Related>
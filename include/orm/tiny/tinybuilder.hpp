@@ -11,6 +11,7 @@ TINY_SYSTEM_HEADER
 #include <range/v3/algorithm/contains.hpp>
 
 #include "orm/databaseconnection.hpp"
+#include "orm/exceptions/logicerror.hpp"
 #include "orm/tiny/concerns/buildsqueries.hpp"
 #include "orm/tiny/concerns/buildssoftdeletes.hpp"
 #include "orm/tiny/concerns/queriesrelationships.hpp"
@@ -68,6 +69,16 @@ namespace Orm::Tiny
         /* Retrieving results */
         /*! Execute the query as a "select" statement. */
         QVector<Model> get(const QVector<Column> &columns = {ASTERISK});
+        /*! Execute a callback over each model of the forward-only result, models are
+            hydrated one at a time (constant memory usage, the eager loading throws). */
+        bool cursor(const std::function<bool(Model &&model)> &callback,
+                    const QVector<Column> &columns = {ASTERISK});
+#ifdef T_COROUTINES
+        /*! Execute the query as a "select" statement in the async thread pool
+            (awaitable), models are hydrated and relations are eager loaded
+            in the awaiting thread. */
+        AsyncQuery<QVector<Model>> getAsync(const QVector<Column> &columns = {ASTERISK});
+#endif
 
         /*! Get a single column's value from the first result of a query. */
         QVariant value(const Column &column);
@@ -243,6 +254,8 @@ namespace Orm::Tiny
                                       const WithItem &relationItem) const;
         /*! Create a vector of models from the SqlQuery. */
         QVector<Model> hydrate(SqlQuery &&result);
+        /*! Create a vector of models from the fetched records. */
+        QVector<Model> hydrate(const QVector<QSqlRecord> &records);
 
         /*! Get the model instance being queried. */
         inline Model &getModel() noexcept;
@@ -250,6 +263,8 @@ namespace Orm::Tiny
         inline QueryBuilder &getQuery() const noexcept;
         /*! Get the underlying query builder instance as a std::shared_ptr. */
         inline const std::shared_ptr<QueryBuilder> &getQueryShared() const noexcept;
+        /*! Set the underlying query builder instance. */
+        inline Builder &setQuery(std::shared_ptr<QueryBuilder> query) noexcept;
 
         /*! Get a database connection. */
         inline DatabaseConnection &getConnection();
@@ -279,6 +294,13 @@ namespace Orm::Tiny
         /*! Get the default key name of the table. */
         inline const QString &defaultKeyName() const;
 
+        /*! Create a model from the current row of the SqlQuery. */
+        static Model hydrateRow(Model &instance, const SqlQuery &result);
+        /*! Create a model from the record, values are obtained by the callback. */
+        template<typename ValueCallback>
+        static Model hydrateRow(Model &instance, const QSqlRecord &record,
+                                ValueCallback &&value);
+
         /*! Parse a list of relations into individuals. */
         QVector<WithItem> parseWithRelations(const QVector<WithItem> &relations);
         /*! Create a constraint to select the given columns for the relation. */
@@ -290,6 +312,14 @@ namespace Orm::Tiny
         static QVector<WithItem>::size_type
         guessParseWithRelationsSize(const QVector<WithItem> &relations);
 
+        /*! Eagerly load the relationship on a set of models in chunks, every chunk
+            starts from the given relation query without the eager constraints. */
+        template<typename Relation>
+        void eagerLoadRelationChunked(
+                const Relation &relation, QVector<Model> &models,
+                const WithItem &relationItem, const QueryBuilder &baseQuery,
+                typename QVector<Model>::size_type chunkSize) const;
+
         /*! Get the deeply nested relations for a given top-level relation. */
         QVector<WithItem>
         relationsNestedUnder(const QString &topRelationName) const;
@@ -313,6 +343,24 @@ namespace Orm::Tiny
         /*! Add a generic "order by" clause if the query doesn't already have one. */
         void enforceOrderBy();
 
+        /* Sharding */
+        /*! Determine whether the query isn't routed to a shard yet. */
+        inline bool isUnroutedShardQuery() const;
+        /*! Get the shard for the equality condition on the shard key (std::nullopt
+            if the query can't be routed). */
+        std::optional<QString> resolveQueryShard() const;
+        /*! Route the query and the model to the shard, return false if the query
+            can't be routed. */
+        bool routeToShard();
+        /*! Get the base query builder routed to the shard, throw if the query
+            can't be routed (only the get() is executed on all shards). */
+        QueryBuilder &getRoutedQuery() const;
+        /*! Get the base query builder with applied SoftDeletes routed to the shard. */
+        QueryBuilder &toRoutedBase();
+        /*! Execute the query on all shards, models are hydrated and eager loaded
+            on the shard they come from. */
+        QVector<Model> getOnShards(const QVector<Column> &columns);
+
         /*! Apply the given scope on the current builder instance. */
 //        template<typename ...Args>
 //        Builder &callScope(const std::function<void(Builder &, Args ...)> &scope,
@@ -372,6 +420,10 @@ namespace Orm::Tiny
     {
         applySoftDeletes();
 
+        // Queries that can't be routed by the shard key are scattered to all shards
+        if (!routeToShard())
+            return getOnShards(columns);
+
         auto models = getModels(columns);
 
         /* If we actually found models we will also eager load any relationships that
@@ -387,6 +439,63 @@ namespace Orm::Tiny
 //        return getModel().newCollection(models);
     }
 
+    template<typename Model>
+    bool Builder<Model>::cursor(const std::function<bool(Model &&model)> &callback,
+                                const QVector<Column> &columns)
+    {
+        /* The eager loading needs all models at once, loading relations for every
+           model would be one query per model. */
+        if (!m_eagerLoad.isEmpty())
+            throw Orm::Exceptions::LogicError(
+                    QStringLiteral("The cursor() doesn't support the eager loading, use "
+                                   "the chunk() or get() methods for the '%1' model "
+                                   "with relations in %2().")
+                    .arg(TypeUtils::classPureBasename<Model>(), __tiny_func__));
+
+        applySoftDeletes();
+
+        // Rows are hydrated one at a time, so they can't be merged from all shards
+        routeToShard();
+
+        auto query = getRoutedQuery().cursor(columns);
+
+        auto instance = newModelInstance();
+
+        // Models are hydrated one at a time, rows are not buffered
+        while (query.next())
+            if (const auto result = std::invoke(callback, hydrateRow(instance, query));
+                !result
+            )
+                return false;
+
+        return true;
+    }
+
+#ifdef T_COROUTINES
+    template<typename Model>
+    AsyncQuery<QVector<Model>>
+    Builder<Model>::getAsync(const QVector<Column> &columns)
+    {
+        applySoftDeletes();
+
+        routeToShard();
+
+        /* The builder is copied because it doesn't have to be alive until the query is
+           done, the copy shares the underlying query builder. */
+        return getRoutedQuery().getAsync(columns)
+                .then([builder = *this](QVector<QSqlRecord> &&records) mutable
+        {
+            auto models = builder.hydrate(records);
+
+            // Eager loading runs synchronously in the awaiting thread
+            if (models.size() > 0)
+                builder.eagerLoadRelations(models);
+
+            return models;
+        });
+    }
+#endif
+
     template<typename Model>
     QVariant Builder<Model>::value(const Column &column)
     {
@@ -439,7 +548,7 @@ namespace Orm::Tiny
     template<typename Model>
     QVector<QVariant> Builder<Model>::pluck(const Column &column)
     {
-        auto result = toBase().pluck(column);
+        auto result = toRoutedBase().pluck(column);
 
         // Nothing to pluck-ing 😎
         if (result.empty())
@@ -470,7 +579,7 @@ namespace Orm::Tiny
     std::map<T, QVariant>
     Builder<Model>::pluck(const Column &column, const Column &key)
     {
-        auto result = toBase().template pluck<T>(column, key);
+        auto result = toRoutedBase().template pluck<T>(column, key);
 
         // Nothing to pluck-ing 😎
         if (result.empty())
@@ -878,14 +987,14 @@ namespace Orm::Tiny
         auto time = m_model.freshTimestamp();
 
         if (!column.isEmpty())
-            return toBase().update({{column, std::move(time)}});
+            return toRoutedBase().update({{column, std::move(time)}});
 
         const auto &updatedAtColumn = m_model.getUpdatedAtColumn();
 
         if (!m_model.usesTimestamps() || updatedAtColumn.isEmpty())
             return {0, std::nullopt};
 
-        return toBase().update({{updatedAtColumn, std::move(time)}});
+        return toRoutedBase().update({{updatedAtColumn, std::move(time)}});
     }
 
     /* QueryBuilder proxy methods that need modifications */
@@ -894,7 +1003,7 @@ namespace Orm::Tiny
     std::tuple<int, QSqlQuery>
     Builder<Model>::update(const QVector<UpdateItem> &values)
     {
-        return toBase().update(addUpdatedAtColumn(values));
+        return toRoutedBase().update(addUpdatedAtColumn(values));
     }
 
     template<typename Model>
@@ -904,7 +1013,7 @@ namespace Orm::Tiny
         if (m_onDelete)
             return std::invoke(m_onDelete, *this);
 
-        return toBase().deleteRow();
+        return toRoutedBase().deleteRow();
     }
 
     template<typename Model>
@@ -930,8 +1039,8 @@ namespace Orm::Tiny
                     "The upsert method doesn't support an empty update argument, please "
                     "use the insert method instead.");
 
-        return toBase().upsert(addTimestampsToUpsertValues(values), uniqueBy,
-                               addUpdatedAtToUpsertColumns(update));
+        return toRoutedBase().upsert(addTimestampsToUpsertValues(values), uniqueBy,
+                                     addUpdatedAtToUpsertColumns(update));
     }
 
     template<typename Model>
@@ -1086,13 +1195,68 @@ namespace Orm::Tiny
         if (nested.size() > 0)
             relation->getQuery().with(std::move(nested));
 
-        relation->addEagerConstraints(models);
+        /* Keys of many models can exceed the bound parameters limit if they are bound
+           one by one (not inlined or bound as the array), back up the relation query
+           so the eager constraints can be added again for every chunk of models. */
+        const auto maxBindings = relation->getBaseQuery().getGrammar().getMaxBindings();
+        const auto modelsSize = static_cast<std::size_t>(models.size());
+        std::optional<QueryBuilder> baseQuery;
+
+        if (modelsSize > maxBindings / 2)
+            baseQuery.emplace(relation->getBaseQuery());
+
+        /* The whereIn() throws if the keys of all models can't be bound, so only keys
+           of the first models are added to find out whether keys are bound or inlined,
+           models are loaded in chunks then. */
+        const auto probe = modelsSize > maxBindings;
+
+        if (probe)
+            relation->addEagerConstraints(
+                        models.mid(0, static_cast<typename QVector<Model>::size_type>(
+                                          maxBindings / 2)));
+        else
+            relation->addEagerConstraints(models);
+
+        const auto eagerBindingsSize = baseQuery
+                                       ? relation->getBaseQuery().getBindings().size()
+                                       : 0;
 
         // Add relation constraints defined in the user callback
         // NOTE api different, Eloquent is passing the Relation reference into the lambda, it would be almost impossible to do it silverqx
         if (relationItem.constraints)
             std::invoke(relationItem.constraints, relation->getBaseQuery());
 
+        if (const auto bindingsSize = baseQuery
+                                      ? relation->getBaseQuery().getBindings().size()
+                                      : 0;
+            static_cast<std::size_t>(bindingsSize) > maxBindings ||
+            (probe && eagerBindingsSize > baseQuery->getBindings().size())
+        ) {
+            // Bindings of the base query and the user constraints (without the keys)
+            const auto otherBindingsSize = static_cast<std::size_t>(
+                                               baseQuery->getBindings().size() +
+                                               bindingsSize - eagerBindingsSize);
+            // Every model has at most one key, at least one model per chunk
+            const auto available = otherBindingsSize < maxBindings
+                                   ? maxBindings - otherBindingsSize
+                                   : 1;
+            // Chunks of the same size
+            const auto chunksCount = (modelsSize + available - 1) / available;
+
+            eagerLoadRelationChunked(
+                        relation, models, relationItem, *baseQuery,
+                        static_cast<typename QVector<Model>::size_type>(
+                            (modelsSize + chunksCount - 1) / chunksCount));
+            return;
+        }
+
+        // The keys are inlined, all models fit into one chunk
+        if (probe) {
+            eagerLoadRelationChunked(relation, models, relationItem, *baseQuery,
+                                     models.size());
+            return;
+        }
+
         /* Once we have the results, we just match those back up to their parent models
            using the relationship instance. Then we just return the finished vector
            of models which have been eagerly hydrated and are readied for return. */
@@ -1100,6 +1264,32 @@ namespace Orm::Tiny
                         relation->getEager(), relationItem.name);
     }
 
+    template<typename Model>
+    template<typename Relation>
+    void Builder<Model>::eagerLoadRelationChunked(
+            const Relation &relation, QVector<Model> &models,
+            const WithItem &relationItem, const QueryBuilder &baseQuery,
+            const typename QVector<Model>::size_type chunkSize) const
+    {
+        decltype (relation->getEager()) results;
+
+        for (typename QVector<Model>::size_type offset = 0; offset < models.size();
+             offset += chunkSize
+        ) {
+            relation->getQuery().setQuery(std::make_shared<QueryBuilder>(baseQuery));
+
+            relation->addEagerConstraints(models.mid(offset, chunkSize));
+
+            if (relationItem.constraints)
+                std::invoke(relationItem.constraints, relation->getBaseQuery());
+
+            results << relation->getEager();
+        }
+
+        relation->match(relation->initRelation(models, relationItem.name),
+                        std::move(results), relationItem.name);
+    }
+
     template<typename Model>
     QVector<Model>
     Builder<Model>::hydrate(SqlQuery &&result)
@@ -1107,22 +1297,34 @@ namespace Orm::Tiny
         auto instance = newModelInstance();
 
         QVector<Model> models;
-        models.reserve(QueryUtils::queryResultSize(result));
+        /* The result is never scanned only to count rows (SQLite doesn't report
+           the size), the size hint set by the user has a priority. */
+        if (const auto sizeHint = m_query->getSizeHint(); sizeHint > 0)
+            models.reserve(sizeHint);
+        else
+            models.reserve(QueryUtils::queryResultSizeHint(result));
 
-        const auto fieldsCount = result.record().count();
+        while (result.next())
+            models << hydrateRow(instance, result);
 
-        while (result.next()) {
-            QVector<AttributeItem> row;
-            row.reserve(fieldsCount);
+        return models;
+    }
 
-            // Populate model attributes with data from the database (one table row)
-            const auto record = result.record();
-            for (int i = 0; i < record.count(); ++i)
-                row.append({record.fieldName(i), result.value(i)});
+    template<typename Model>
+    QVector<Model>
+    Builder<Model>::hydrate(const QVector<QSqlRecord> &records)
+    {
+        auto instance = newModelInstance();
 
-            // Create a new model instance from the table row
-            models << instance.newFromBuilder(std::move(row));
-        }
+        QVector<Model> models;
+        models.reserve(records.size());
+
+        // Values were already converted by the SqlQuery when the records were fetched
+        for (const auto &record : records)
+            models << hydrateRow(instance, record, [&record](const int index)
+            {
+                return record.value(index);
+            });
 
         return models;
     }
@@ -1146,6 +1348,15 @@ namespace Orm::Tiny
         return m_query;
     }
 
+    template<typename Model>
+    Builder<Model> &
+    Builder<Model>::setQuery(std::shared_ptr<QueryBuilder> query) noexcept
+    {
+        m_query = std::move(query);
+
+        return *this;
+    }
+
     template<typename Model>
     DatabaseConnection &
     Builder<Model>::getConnection()
@@ -1207,6 +1418,34 @@ namespace Orm::Tiny
         return m_model.getKeyName();
     }
 
+    template<typename Model>
+    Model Builder<Model>::hydrateRow(Model &instance, const SqlQuery &result)
+    {
+        // The SqlQuery::value() correctly handles QDateTime's time zone
+        return hydrateRow(instance, result.record(), [&result](const int index)
+        {
+            return result.value(index);
+        });
+    }
+
+    template<typename Model>
+    template<typename ValueCallback>
+    Model Builder<Model>::hydrateRow(Model &instance, const QSqlRecord &record,
+                                     ValueCallback &&value)
+    {
+        const auto fieldsCount = record.count();
+
+        QVector<AttributeItem> row;
+        row.reserve(fieldsCount);
+
+        // Populate model attributes with data from the database (one table row)
+        for (int i = 0; i < fieldsCount; ++i)
+            row.append({record.fieldName(i), std::invoke(value, i)});
+
+        // Create a new model instance from the table row
+        return instance.newFromBuilder(std::move(row));
+    }
+
     template<typename Model>
     QVector<WithItem>
     Builder<Model>::parseWithRelations(const QVector<WithItem> &relations)
@@ -1512,6 +1751,152 @@ namespace Orm::Tiny
         this->orderBy(m_model.getQualifiedKeyName(), ASC);
     }
 
+    /* Sharding */
+
+    template<typename Model>
+    bool Builder<Model>::isUnroutedShardQuery() const
+    {
+        return Model::isSharded() && m_model.getConnectionName().isEmpty();
+    }
+
+    template<typename Model>
+    std::optional<QString> Builder<Model>::resolveQueryShard() const
+    {
+        const auto &wheres = m_query->getWheres();
+
+        /* All where clauses have to be joined by the AND, otherwise the shard key
+           condition doesn't constrain all rows, eg. the orWhere() on the shard key. */
+        if (std::ranges::any_of(wheres, [](const WhereConditionItem &where)
+        {
+            return where.condition != AND;
+        }))
+            return std::nullopt;
+
+        const auto &shardKey = Model::getShardKey();
+        const auto qualifiedShardKey = m_model.qualifyColumn(shardKey);
+
+        // Only the equality routes, eg. the whereIn() on the shard key is scattered
+        const auto where = std::ranges::find_if(wheres,
+                                                [&shardKey, &qualifiedShardKey]
+                                                (const WhereConditionItem &where_)
+        {
+            return where_.type == WhereType::BASIC && where_.comparison == EQ &&
+                   !where_.value.canConvert<Expression>() &&
+                   std::holds_alternative<QString>(where_.column) &&
+                   (std::get<QString>(where_.column) == shardKey ||
+                    std::get<QString>(where_.column) == qualifiedShardKey);
+        });
+
+        if (where == wheres.cend())
+            return std::nullopt;
+
+        return Model::resolveShard(where->value);
+    }
+
+    template<typename Model>
+    bool Builder<Model>::routeToShard()
+    {
+        if (!isUnroutedShardQuery())
+            return true;
+
+        const auto shard = resolveQueryShard();
+
+        if (!shard)
+            return false;
+
+        // Models are hydrated with the shard connection
+        m_model.setConnection(*shard);
+
+        m_query->setConnection(m_model.getConnection());
+
+        return true;
+    }
+
+    template<typename Model>
+    QueryBuilder &Builder<Model>::getRoutedQuery() const
+    {
+        if (!isUnroutedShardQuery())
+            return *m_query;
+
+        const auto shard = resolveQueryShard();
+
+        /* Aggregates, updates, deletes, and others can't be executed on the default
+           connection, it doesn't contain all rows. */
+        if (!shard)
+            throw Orm::Exceptions::RuntimeError(
+                    QStringLiteral("The query on the sharded '%1' model without "
+                                   "the equality condition on the '%2' shard key can't "
+                                   "be routed to the shard, only the get() method is "
+                                   "executed on all shards, in %3().")
+                    .arg(TypeUtils::classPureBasename<Model>(),
+                         Model::getShardKey(), __tiny_func__));
+
+        return m_query->setConnection(
+                    Model::getConnectionResolver()->connection(*shard));
+    }
+
+    template<typename Model>
+    QueryBuilder &Builder<Model>::toRoutedBase()
+    {
+        applySoftDeletes();
+
+        return getRoutedQuery();
+    }
+
+    template<typename Model>
+    QVector<Model>
+    Builder<Model>::getOnShards(const QVector<Column> &columns)
+    {
+        const auto &shards = Model::getShards();
+
+        if (shards.isEmpty())
+            throw Orm::Exceptions::RuntimeError(
+                    QStringLiteral("The u_shards are not defined on the '%1' model, "
+                                   "the query without the '%2' shard key can't be "
+                                   "executed in %3().")
+                    .arg(TypeUtils::classPureBasename<Model>(),
+                         Model::getShardKey(), __tiny_func__));
+
+        auto records = m_query->onConnectionsIndexed(shards, columns);
+
+        /* Group records by the shard, the position of every record in its group is
+           saved so the merged order can be restored after the eager loading. */
+        QVector<QVector<QSqlRecord>> shardRecords(shards.size());
+        std::vector<std::pair<QVector<QSqlRecord>::size_type,
+                              QVector<QSqlRecord>::size_type>> positions;
+        positions.reserve(static_cast<std::size_t>(records.size()));
+
+        for (auto &&[shard, record] : records) {
+            positions.emplace_back(shard, shardRecords[shard].size());
+            shardRecords[shard] << std::move(record);
+        }
+
+        QVector<QVector<Model>> shardModels(shards.size());
+
+        for (QVector<QSqlRecord>::size_type shard = 0; shard < shards.size(); ++shard) {
+            if (shardRecords.at(shard).isEmpty())
+                continue;
+
+            // The shard builder has its own query so the shard connection can be set
+            auto shardBuilder = *this;
+            shardBuilder.m_model.setConnection(shards.at(shard));
+            shardBuilder.setQuery(std::make_shared<QueryBuilder>(*m_query))
+                    .getQuery().setConnection(shardBuilder.m_model.getConnection());
+
+            shardModels[shard] = shardBuilder.hydrate(shardRecords.at(shard));
+
+            shardBuilder.eagerLoadRelations(shardModels[shard]);
+        }
+
+        QVector<Model> models;
+        models.reserve(records.size());
+
+        for (const auto &[shard, position] : positions)
+            models << std::move(shardModels[shard][position]);
+
+        return models;
+    }
+
     // FEATURE scopes, anyway std::apply() do the same, will have to investigate it silverqx
 //    template<typename Model>
 //    template<typename ...Args>
@@ -380,6 +380,23 @@ namespace Tiny
         TinyBuilder<Model> &orWhereNotIn(const Column &column,
                                          const QVector<QVariant> &values);
 
+        /* where IN raw */
+        /*! Add a "where in raw" clause for integer values to the query. */
+        TinyBuilder<Model> &whereIntegerInRaw(const Column &column,
+                                              const QVector<QVariant> &values,
+                                              const QString &condition = AND,
+                                              bool nope = false);
+        /*! Add an "or where in raw" clause for integer values to the query. */
+        TinyBuilder<Model> &orWhereIntegerInRaw(const Column &column,
+                                                const QVector<QVariant> &values);
+        /*! Add a "where not in raw" clause for integer values to the query. */
+        TinyBuilder<Model> &whereIntegerNotInRaw(const Column &column,
+                                                 const QVector<QVariant> &values,
+                                                 const QString &condition = AND);
+        /*! Add an "or where not in raw" clause for integer values to the query. */
+        TinyBuilder<Model> &orWhereIntegerNotInRaw(const Column &column,
+                                                   const QVector<QVariant> &values);
+
         /* where null */
         /*! Add a "where null" clause to the query. */
         TinyBuilder<Model> &whereNull(const QVector<Column> &columns = {ASTERISK},
@@ -673,6 +690,15 @@ namespace Tiny
         TinyBuilder<Model> &lock(QString &&value);
 
         /* Others proxy methods, not added to the Model and Relation */
+        /*! Use the write connection for the select query (read/write connections). */
+        TinyBuilder<Model> &useWriteConnection();
+        /*! Set the expected number of rows, used to reserve the hydrated models. */
+        TinyBuilder<Model> &sizeHint(int rows);
+        /*! Set the statement timeout for the select query. */
+        TinyBuilder<Model> &timeout(std::chrono::milliseconds timeout);
+        /*! Set the maximum replication lag of the read connection for the select
+            query. */
+        TinyBuilder<Model> &maxStaleness(std::chrono::milliseconds staleness);
         /*! Add an "exists" clause to the query. */
         TinyBuilder<Model> &
         addWhereExistsQuery(const std::shared_ptr<QueryBuilder> &query,
@@ -694,6 +720,13 @@ namespace Tiny
         QueryBuilder &toBase();
         /*! Get a base query builder instance with applied SoftDeletes. */
         QueryBuilder &getQuery() const noexcept;
+
+        /*! Get a base query builder instance with applied SoftDeletes routed
+            to the shard (throws for the sharded model if it can't be routed). */
+        QueryBuilder &toRoutedBase();
+        /*! Get a base query builder instance routed to the shard (throws for
+            the sharded model if it can't be routed). */
+        QueryBuilder &getRoutedQuery() const;
     };
 
     /* public */
@@ -712,7 +745,7 @@ namespace Tiny
     QString
     BuilderProxies<Model>::implode(const QString &column, const QString &glue)
     {
-        return toBase().implode(column, glue);
+        return toRoutedBase().implode(column, glue);
     }
 
     /* Aggregates */
@@ -720,44 +753,44 @@ namespace Tiny
     template<typename Model>
     quint64 BuilderProxies<Model>::count(const QVector<Column> &columns)
     {
-        return toBase().count(columns);
+        return toRoutedBase().count(columns);
     }
 
     template<typename Model>
     template<typename>
     quint64 BuilderProxies<Model>::count(const Column &column)
     {
-        return toBase().count(QVector<Column> {column});
+        return toRoutedBase().count(QVector<Column> {column});
     }
 
     template<typename Model>
     QVariant BuilderProxies<Model>::min(const Column &column)
     {
-        return toBase().min(column);
+        return toRoutedBase().min(column);
     }
 
     template<typename Model>
     QVariant BuilderProxies<Model>::max(const Column &column)
     {
-        return toBase().max(column);
+        return toRoutedBase().max(column);
     }
 
     template<typename Model>
     QVariant BuilderProxies<Model>::sum(const Column &column)
     {
-        return toBase().sum(column);
+        return toRoutedBase().sum(column);
     }
 
     template<typename Model>
     QVariant BuilderProxies<Model>::avg(const Column &column)
     {
-        return toBase().avg(column);
+        return toRoutedBase().avg(column);
     }
 
     template<typename Model>
     QVariant BuilderProxies<Model>::average(const Column &column)
     {
-        return toBase().avg(column);
+        return toRoutedBase().avg(column);
     }
 
     template<typename Model>
@@ -765,7 +798,7 @@ namespace Tiny
     BuilderProxies<Model>::aggregate(const QString &function,
                                      const QVector<Column> &columns)
     {
-        return toBase().aggregate(function, columns);
+        return toRoutedBase().aggregate(function, columns);
     }
 
     /* Records exist */
@@ -773,26 +806,26 @@ namespace Tiny
     template<typename Model>
     bool BuilderProxies<Model>::exists()
     {
-        return toBase().exists();
+        return toRoutedBase().exists();
     }
 
     template<typename Model>
     bool BuilderProxies<Model>::doesntExist()
     {
-        return toBase().doesntExist();
+        return toRoutedBase().doesntExist();
     }
 
     template<typename Model>
     bool BuilderProxies<Model>::existsOr(const std::function<void()> &callback)
     {
-        return toBase().existsOr(callback);
+        return toRoutedBase().existsOr(callback);
     }
 
     template<typename Model>
     bool
     BuilderProxies<Model>::doesntExistOr(const std::function<void()> &callback)
     {
-        return toBase().doesntExistOr(callback);
+        return toRoutedBase().doesntExistOr(callback);
     }
 
     template<typename Model>
@@ -800,7 +833,7 @@ namespace Tiny
     std::pair<bool, R>
     BuilderProxies<Model>::existsOr(const std::function<R()> &callback)
     {
-        return toBase().template existsOr<R>(callback);
+        return toRoutedBase().template existsOr<R>(callback);
     }
 
     template<typename Model>
@@ -808,7 +841,7 @@ namespace Tiny
     std::pair<bool, R>
     BuilderProxies<Model>::doesntExistOr(const std::function<R()> &callback)
     {
-        return toBase().template doesntExistOr<R>(callback);
+        return toRoutedBase().template doesntExistOr<R>(callback);
     }
 
     /* Debugging */
@@ -834,7 +867,8 @@ namespace Tiny
     BuilderProxies<Model>::increment(
             const QString &column, const T amount, const QVector<UpdateItem> &extra)
     {
-        return toBase().increment(column, amount, builder().addUpdatedAtColumn(extra));
+        return toRoutedBase().increment(column, amount,
+                                        builder().addUpdatedAtColumn(extra));
     }
 
     template<typename Model>
@@ -843,7 +877,8 @@ namespace Tiny
     BuilderProxies<Model>::decrement(
             const QString &column, const T amount, const QVector<UpdateItem> &extra)
     {
-        return toBase().decrement(column, amount, builder().addUpdatedAtColumn(extra));
+        return toRoutedBase().decrement(column, amount,
+                                        builder().addUpdatedAtColumn(extra));
     }
 
     /* Insert, Update, Delete */
@@ -854,14 +889,14 @@ namespace Tiny
     std::optional<SqlQuery>
     BuilderProxies<Model>::insert(const QVector<AttributeItem> &values) const
     {
-        return getQuery().insert(AttributeUtils::convertVectorToMap(values));
+        return getRoutedQuery().insert(AttributeUtils::convertVectorToMap(values));
     }
 
     template<typename Model>
     std::optional<SqlQuery>
     BuilderProxies<Model>::insert(const QVector<QVector<AttributeItem>> &values) const
     {
-        return getQuery().insert(AttributeUtils::convertVectorsToMaps(values));
+        return getRoutedQuery().insert(AttributeUtils::convertVectorsToMaps(values));
     }
 
     template<typename Model>
@@ -869,7 +904,7 @@ namespace Tiny
     BuilderProxies<Model>::insert(
             const QVector<QString> &columns, QVector<QVector<QVariant>> values) const
     {
-        return getQuery().insert(columns, std::move(values));
+        return getRoutedQuery().insert(columns, std::move(values));
     }
 
     // FEATURE dilemma primarykey, Model::KeyType vs QVariant silverqx
@@ -878,15 +913,16 @@ namespace Tiny
     BuilderProxies<Model>::insertGetId(const QVector<AttributeItem> &values,
                                        const QString &sequence) const
     {
-        return getQuery().insertGetId(AttributeUtils::convertVectorToMap(values),
-                                      sequence);
+        return getRoutedQuery().insertGetId(AttributeUtils::convertVectorToMap(values),
+                                            sequence);
     }
 
     template<typename Model>
     std::tuple<int, std::optional<QSqlQuery>>
     BuilderProxies<Model>::insertOrIgnore(const QVector<AttributeItem> &values) const
     {
-        return getQuery().insertOrIgnore(AttributeUtils::convertVectorToMap(values));
+        return getRoutedQuery().insertOrIgnore(
+                    AttributeUtils::convertVectorToMap(values));
     }
 
     template<typename Model>
@@ -894,7 +930,8 @@ namespace Tiny
     BuilderProxies<Model>::insertOrIgnore(
             const QVector<QVector<AttributeItem>> &values) const
     {
-        return getQuery().insertOrIgnore(AttributeUtils::convertVectorsToMaps(values));
+        return getRoutedQuery().insertOrIgnore(
+                    AttributeUtils::convertVectorsToMaps(values));
     }
 
     template<typename Model>
@@ -902,27 +939,27 @@ namespace Tiny
     BuilderProxies<Model>::insertOrIgnore(
             const QVector<QString> &columns, QVector<QVector<QVariant>> values) const
     {
-        return getQuery().insertOrIgnore(columns, std::move(values));
+        return getRoutedQuery().insertOrIgnore(columns, std::move(values));
     }
 
     template<typename Model>
     std::tuple<int, QSqlQuery> BuilderProxies<Model>::forceDelete() const
     {
         // Skip applying SoftDeletes (getQuery()) to actually delete
-        return getQuery().remove();
+        return getRoutedQuery().remove();
     }
 
     template<typename Model>
     std::tuple<int, QSqlQuery> BuilderProxies<Model>::forceRemove() const
     {
         // Skip applying SoftDeletes (getQuery()) to actually delete
-        return getQuery().remove();
+        return getRoutedQuery().remove();
     }
 
     template<typename Model>
     void BuilderProxies<Model>::truncate() const
     {
-        getQuery().truncate();
+        getRoutedQuery().truncate();
     }
 
     /* Select */
@@ -1507,6 +1544,46 @@ namespace Tiny
         return builder();
     }
 
+    /* where IN raw */
+
+    template<typename Model>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::whereIntegerInRaw(
+            const Column &column, const QVector<QVariant> &values,
+            const QString &condition, const bool nope)
+    {
+        getQuery().whereIntegerInRaw(column, values, condition, nope);
+        return builder();
+    }
+
+    template<typename Model>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::orWhereIntegerInRaw(
+            const Column &column, const QVector<QVariant> &values)
+    {
+        getQuery().orWhereIntegerInRaw(column, values);
+        return builder();
+    }
+
+    template<typename Model>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::whereIntegerNotInRaw(
+            const Column &column, const QVector<QVariant> &values,
+            const QString &condition)
+    {
+        getQuery().whereIntegerNotInRaw(column, values, condition);
+        return builder();
+    }
+
+    template<typename Model>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::orWhereIntegerNotInRaw(
+            const Column &column, const QVector<QVariant> &values)
+    {
+        getQuery().orWhereIntegerNotInRaw(column, values);
+        return builder();
+    }
+
     /* where null */
 
     template<typename Model>
@@ -2247,6 +2324,36 @@ namespace Tiny
 
     /* Others proxy methods, not added to the Model and Relation */
 
+    template<typename Model>
+    TinyBuilder<Model> &BuilderProxies<Model>::useWriteConnection()
+    {
+        getQuery().useWriteConnection();
+        return builder();
+    }
+
+    template<typename Model>
+    TinyBuilder<Model> &BuilderProxies<Model>::sizeHint(const int rows)
+    {
+        getQuery().sizeHint(rows);
+        return builder();
+    }
+
+    template<typename Model>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::timeout(const std::chrono::milliseconds timeout)
+    {
+        getQuery().timeout(timeout);
+        return builder();
+    }
+
+    template<typename Model>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::maxStaleness(const std::chrono::milliseconds staleness)
+    {
+        getQuery().maxStaleness(staleness);
+        return builder();
+    }
+
     template<typename Model>
     TinyBuilder<Model> &
     BuilderProxies<Model>::addWhereExistsQuery(
@@ -2306,6 +2413,18 @@ namespace Tiny
         return builder().getQuery();
     }
 
+    template<typename Model>
+    QueryBuilder &BuilderProxies<Model>::toRoutedBase()
+    {
+        return builder().toRoutedBase();
+    }
+
+    template<typename Model>
+    QueryBuilder &BuilderProxies<Model>::getRoutedQuery() const
+    {
+        return builder().getRoutedQuery();
+    }
+
 } // namespace Tiny
 } // namespace Orm
 
@@ -0,0 +1,56 @@
+#pragma once
+#ifndef ORM_TYPES_CONNECTIONPOOLSTATS_HPP
+#define ORM_TYPES_CONNECTIONPOOLSTATS_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QtGlobal>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Connection pool statistics. */
+    struct ConnectionPoolStats
+    {
+        /*! Number of connections created by the pool (idle + borrowed). */
+        std::size_t size = 0;
+        /*! Number of idle connections. */
+        std::size_t idle = 0;
+        /*! Number of currently borrowed connections. */
+        std::size_t borrowed = 0;
+        /*! Total number of successful acquires. */
+        std::size_t acquired = 0;
+        /*! Number of acquires that had to wait for a released connection. */
+        std::size_t waited = 0;
+        /*! Number of acquires that failed because the acquire timeout expired. */
+        std::size_t timeouts = 0;
+        /*! Total time spent waiting for a connection (in milliseconds). */
+        qint64 totalWaitTime = 0;
+        /*! The longest time spent waiting for a connection (in milliseconds). */
+        qint64 maxWaitTime = 0;
+        /*! Number of keepalive pings sent on the idle connections. */
+        std::size_t pings = 0;
+        /*! Number of idle connections closed after the pool_max_idle_time. */
+        std::size_t reaped = 0;
+        /*! Number of idle connections reconnected after a failed ping. */
+        std::size_t revived = 0;
+        /*! Number of idle connections closed after a failed ping and reconnect. */
+        std::size_t failed = 0;
+    };
+
+} // namespace Types
+
+    using ConnectionPoolStats = Types::ConnectionPoolStats;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_CONNECTIONPOOLSTATS_HPP
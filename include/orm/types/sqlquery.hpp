@@ -7,6 +7,7 @@ TINY_SYSTEM_HEADER
 
 #include <QtSql/QSqlQuery>
 
+#include <functional>
 #include <optional>
 
 #include "orm/macros/export.hpp"
@@ -31,24 +32,28 @@ namespace Types
         using QueryGrammar = Query::Grammars::Grammar;
 
     public:
+        /*! Check-in handler type, returns the prepared statement to the cache. */
+        using CheckInType = std::function<void(QSqlQuery &&)>;
+
         /*! Deleted default constructor (not needed). */
         inline SqlQuery() = delete;
-        /*! Default destructor. */
-        inline ~SqlQuery() = default;
+        /*! Destructor, checks in the cached prepared statement. */
+        ~SqlQuery();
 
         /*! Deleted copy constructor (follow the base class). */
         SqlQuery(const SqlQuery &other) = delete;
         /*! Deleted copy assignment operator (follow the base class). */
         SqlQuery &operator=(const SqlQuery &other) = delete;
         /*! Move constructor. */
-        SqlQuery(SqlQuery &&other) noexcept = default;
+        SqlQuery(SqlQuery &&other) noexcept;
         /*! Move assignment operator. */
-        SqlQuery &operator=(SqlQuery &&other) noexcept = default;
+        SqlQuery &operator=(SqlQuery &&other) noexcept;
 
         /*! Constructor from the QSqlQuery type and time zone from the configuration. */
         SqlQuery(QSqlQuery &&other, const QtTimeZoneConfig &qtTimeZone,
                  const QueryGrammar &queryGrammar,
-                 std::optional<bool> returnQDateTime);
+                 std::optional<bool> returnQDateTime,
+                 CheckInType &&checkIn = nullptr);
 
         /*! Return the value of field index in the current record. */
         inline QVariant value(int index) const;
@@ -70,6 +75,10 @@ namespace Types
         /*! Return a value as QDateTime object. */
         std::optional<QDateTime> asDateTime(const QString &value) const;
 
+        /*! Return the prepared statement to the statement cache (it's checked out
+            while this result is alive). */
+        void checkIn() noexcept;
+
         /*! Determine how the QDateTime time zone will be converted. */
         QtTimeZoneConfig m_qtTimeZone;
         /*! Determine whether the QDateTime time zone should be converted. */
@@ -81,6 +90,8 @@ namespace Types
         std::optional<QString> m_dateFormat;
         /*! Determine whether to return the QDateTime or QString (SQLite only). */
         std::optional<bool> m_returnQDateTime;
+        /*! Check-in handler of the cached prepared statement. */
+        CheckInType m_checkIn;
     };
 
     /* public */
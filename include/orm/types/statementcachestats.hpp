@@ -0,0 +1,40 @@
+#pragma once
+#ifndef ORM_TYPES_STATEMENTCACHESTATS_HPP
+#define ORM_TYPES_STATEMENTCACHESTATS_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <cstddef>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Prepared statement cache statistics. */
+    struct StatementCacheStats
+    {
+        /*! Number of cached prepared statements. */
+        std::size_t size = 0;
+        /*! Number of prepared statements served from the cache. */
+        std::size_t hits = 0;
+        /*! Number of statements that had to be prepared. */
+        std::size_t misses = 0;
+        /*! Number of the least recently used statements removed from the cache. */
+        std::size_t evictions = 0;
+    };
+
+} // namespace Types
+
+    using StatementCacheStats = Types::StatementCacheStats;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_STATEMENTCACHESTATS_HPP
@@ -24,6 +24,8 @@ namespace Types
         int affecting = -1;
         /*! Transactional statements (START TRANSACTION, ROLLBACK, COMMIT, SAVEPOINT). */
         int transactional = -1;
+        /*! Transactions re-run after a deadlock or serialization failure. */
+        int retried = -1;
     };
 
 } // namespace Types
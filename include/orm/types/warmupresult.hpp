@@ -0,0 +1,42 @@
+#pragma once
+#ifndef ORM_TYPES_WARMUPRESULT_HPP
+#define ORM_TYPES_WARMUPRESULT_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QString>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Result of the connection warm-up. */
+    struct WarmUpResult
+    {
+        /*! Connection name. */
+        QString connection;
+        /*! Determine whether the physical connection was established. */
+        bool connected = false;
+        /*! Time spent connecting and preparing statements (in milliseconds). */
+        qint64 elapsed = 0;
+        /*! Number of statements prepared into the prepared statement cache. */
+        std::size_t preparedStatements = 0;
+        /*! Error message if the warm-up failed. */
+        QString error;
+    };
+
+} // namespace Types
+
+    using WarmUpResult = Types::WarmUpResult;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_WARMUPRESULT_HPP
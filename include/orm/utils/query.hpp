@@ -6,6 +6,7 @@
 TINY_SYSTEM_HEADER
 
 #include <QVariant>
+#include <QtSql/QSqlRecord>
 
 #include "orm/constants.hpp"
 #include "orm/macros/commonnamespace.hpp"
@@ -16,7 +17,14 @@ class QSqlQuery;
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
-namespace Orm::Utils
+namespace Orm
+{
+namespace Types
+{
+    class SqlQuery;
+}
+
+namespace Utils
 {
 
     /*! Concept for a bindings type used in the replaceBindingsInSql(). */
@@ -35,6 +43,8 @@ namespace Orm::Utils
 
         /*! Alias for the helper utils. */
         using Helpers = Orm::Utils::Helpers;
+        /*! Alias for the SqlQuery. */
+        using SqlQuery = Orm::Types::SqlQuery;
 
     public:
         /*! Deleted default constructor, this is a pure library class. */
@@ -64,8 +74,16 @@ namespace Orm::Utils
         zipForInsert(const QVector<QString> &columns,
                      const QVector<QVector<QVariant>> &values);
 
-        /*! Returns the size of the result (number of rows returned). */
+        /*! Returns the size of the result (number of rows returned), counts the rows
+            if the driver doesn't report the size (eg. SQLite). */
         static int queryResultSize(QSqlQuery &query);
+        /*! Returns the size of the result if the driver reports it, otherwise
+            0 (never counts the rows), use it only to reserve containers. */
+        static int queryResultSizeHint(const QSqlQuery &query);
+
+        /*! Read all rows of the executed query (QDateTime time zones are applied),
+            the records can be passed to another thread unlike the QSqlQuery. */
+        static QVector<QSqlRecord> fetchRecords(SqlQuery &query);
     };
 
     /* public */
@@ -115,7 +133,8 @@ namespace Orm::Utils
         return {std::move(queryString), std::move(simpleBindingsList)};
     }
 
-} // namespace Orm::Utils
+} // namespace Utils
+} // namespace Orm
 
 TINYORM_END_COMMON_NAMESPACE
 
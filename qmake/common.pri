@@ -65,6 +65,12 @@ CONFIG(debug, debug|release): DEFINES *= TINYORM_DEBUG
 # Enable MySQL ping on Orm::MySqlConnection
 mysql_ping: DEFINES *= TINYORM_MYSQL_PING
 
+# Build the native PostgreSQL driver using the libpq (Orm::Drivers::LibPqDriver)
+libpq_driver: DEFINES *= TINYORM_LIBPQ_DRIVER
+
+# Build the native SQLite driver using the sqlite3 (Orm::Drivers::SQLite3Driver)
+sqlite3_driver: DEFINES *= TINYORM_SQLITE3_DRIVER
+
 # Log queries with a time measurement
 CONFIG(release, debug|release): DEFINES += TINYORM_NO_DEBUG_SQL
 CONFIG(debug, debug|release): DEFINES *= TINYORM_DEBUG_SQL
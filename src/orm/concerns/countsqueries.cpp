@@ -66,6 +66,7 @@ DatabaseConnection &CountsQueries::enableStatementsCounter()
     m_statementsCounter.normal        = 0;
     m_statementsCounter.affecting     = 0;
     m_statementsCounter.transactional = 0;
+    m_statementsCounter.retried       = 0;
 
     return databaseConnection();
 }
@@ -77,6 +78,7 @@ DatabaseConnection &CountsQueries::disableStatementsCounter()
     m_statementsCounter.normal        = -1;
     m_statementsCounter.affecting     = -1;
     m_statementsCounter.transactional = -1;
+    m_statementsCounter.retried       = -1;
 
     return databaseConnection();
 }
@@ -96,6 +98,7 @@ StatementsCounter CountsQueries::takeStatementsCounter()
     m_statementsCounter.normal        = 0;
     m_statementsCounter.affecting     = 0;
     m_statementsCounter.transactional = 0;
+    m_statementsCounter.retried       = 0;
 
     return counter;
 }
@@ -105,6 +108,7 @@ DatabaseConnection &CountsQueries::resetStatementsCounter()
     m_statementsCounter.normal        = 0;
     m_statementsCounter.affecting     = 0;
     m_statementsCounter.transactional = 0;
+    m_statementsCounter.retried       = 0;
 
     return databaseConnection();
 }
@@ -132,6 +136,13 @@ CountsQueries::hitTransactionalCounters(const QElapsedTimer timer,
     return elapsed;
 }
 
+void CountsQueries::hitRetriedCounter()
+{
+    // Query statements counter
+    if (m_countingStatements)
+        ++m_statementsCounter.retried;
+}
+
 DatabaseConnection &CountsQueries::databaseConnection()
 {
     return dynamic_cast<DatabaseConnection &>(*this);
@@ -0,0 +1,52 @@
+#include "orm/concerns/detectsconcurrencyerrors.hpp"
+
+#include <QVector>
+
+#include "orm/exceptions/sqlerror.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Concerns
+{
+
+bool DetectsConcurrencyErrors::causedByConcurrencyError(const Exceptions::SqlError &e)
+{
+    return causedByConcurrencyError(e.getSqlError());
+}
+
+bool DetectsConcurrencyErrors::causedByConcurrencyError(const QSqlError &e)
+{
+    /* MySQL error numbers - ER_LOCK_DEADLOCK and ER_LOCK_WAIT_TIMEOUT,
+       PostgreSQL SQLSTATE codes - serialization_failure and deadlock_detected. */
+    static const QVector<QString> concurrencyCodesCache {
+        QStringLiteral("1213"),
+        QStringLiteral("1205"),
+        QStringLiteral("40001"),
+        QStringLiteral("40P01"),
+    };
+
+    if (concurrencyCodesCache.contains(e.nativeErrorCode()))
+        return true;
+
+    // Fallback for drivers that don't report the native error code
+    static const QVector<QString> concurrencyMessagesCache {
+        QLatin1String("Deadlock found when trying to get lock"),
+        QLatin1String("deadlock detected"),
+        QLatin1String("Lock wait timeout exceeded"),
+        QLatin1String("could not serialize access"),
+        QLatin1String("database is locked"),
+        QLatin1String("database table is locked"),
+    };
+
+    return std::ranges::any_of(concurrencyMessagesCache,
+                               [databaseError = e.databaseText()]
+                               (const auto &concurrencyMessage)
+    {
+        // found
+        return databaseError.indexOf(concurrencyMessage, 0, Qt::CaseInsensitive) >= 0;
+    });
+}
+
+} // namespace Orm::Concerns
+
+TINYORM_END_COMMON_NAMESPACE
@@ -49,6 +49,32 @@ void LogsQueries::logQueryForPretend(
 #endif
 }
 
+void LogsQueries::logDirectQuery(
+        const QString &query, const QVector<QVariant> &preparedBindings,
+        const std::optional<qint64> elapsed, const int affected) const
+{
+    if (m_loggingQueries && m_queryLog)
+        m_queryLog->append({query, preparedBindings, Log::Type::NORMAL, ++m_queryLogId,
+                            elapsed ? *elapsed : -1, -1, affected});
+
+#ifdef TINYORM_DEBUG_SQL
+    // Debugging SQL queries is disabled
+    if (!m_debugSql)
+        return;
+
+    const auto &connectionName = databaseConnection().getName();
+
+    qDebug("Executed direct query (%llims, %i affected%s) : %s",
+           elapsed ? *elapsed : -1,
+           affected,
+           connectionName.isEmpty() ? ""
+                                    : QStringLiteral(", %1").arg(connectionName)
+                                      .toUtf8().constData(),
+           QueryUtils::parseExecutedQueryForPretend(query, preparedBindings)
+           .toUtf8().constData());
+#endif
+}
+
 void LogsQueries::logTransactionQuery(
         const QString &query, const std::optional<qint64> elapsed) const
 {
@@ -1,6 +1,11 @@
 #include "orm/concerns/managestransactions.hpp"
 
+#include <QRandomGenerator>
+
+#include <thread>
+
 #include "orm/concerns/countsqueries.hpp"
+#include "orm/concerns/detectsconcurrencyerrors.hpp"
 #include "orm/databaseconnection.hpp"
 #include "orm/exceptions/sqltransactionerror.hpp"
 #include "orm/support/databaseconfiguration.hpp"
@@ -11,12 +16,53 @@ TINYORM_BEGIN_COMMON_NAMESPACE
 namespace Orm::Concerns
 {
 
+namespace
+{
+    /*! The maximum delay between two transaction attempts. */
+    constexpr std::chrono::milliseconds MaxRetryDelay {5000};
+} // namespace
+
 /* public */
 
 ManagesTransactions::ManagesTransactions()
     : m_savepointNamespace(Support::DatabaseConfiguration::defaultSavepointNamespace)
 {}
 
+void ManagesTransactions::transaction(
+        const std::function<void(DatabaseConnection &)> &callback, const int attempts,
+        const std::chrono::milliseconds backoff)
+{
+    /* The deadlock or serialization failure aborts the whole outer transaction, so
+       only the outermost transaction() re-runs the callback. */
+    if (m_inTransaction)
+        return transactionInSavepoint(callback);
+
+    for (auto currentAttempt = 1; ; ++currentAttempt) {
+        beginTransaction();
+
+        try {
+            std::invoke(callback, databaseConnection());
+
+            // The callback can commit or roll back the transaction itself
+            if (m_inTransaction)
+                commit();
+
+        } catch (...) {
+            if (!rollBackAndShouldRetry(std::current_exception(), currentAttempt,
+                                        attempts))
+                throw;
+
+            countsQueries().hitRetriedCounter();
+
+            sleepBeforeRetry(backoff, currentAttempt);
+
+            continue;
+        }
+
+        return;
+    }
+}
+
 bool ManagesTransactions::beginTransaction()
 {
     Q_ASSERT(m_inTransaction == false);
@@ -124,6 +170,9 @@ bool ManagesTransactions::rollBack()
 
     resetTransactions();
 
+    // The rollback reverts the statement timeout set inside the transaction
+    databaseConnection().invalidateStatementTimeout();
+
     // Queries execution time counter / Query statements counter
     const auto elapsed = countsQueries().hitTransactionalCounters(timer, countElapsed);
 
@@ -210,6 +259,9 @@ bool ManagesTransactions::rollbackToSavepoint(const QString &id)
 
     m_savepoints = std::max<std::size_t>(0, m_savepoints - 1);
 
+    // The rollback reverts the statement timeout set after the savepoint
+    databaseConnection().invalidateStatementTimeout();
+
     // Queries execution time counter / Query statements counter
     const auto elapsed = countsQueries().hitTransactionalCounters(timer, countElapsed);
 
@@ -239,6 +291,64 @@ ManagesTransactions::setSavepointNamespace(const QString &savepointNamespace)
 
 /* private */
 
+void ManagesTransactions::transactionInSavepoint(
+        const std::function<void(DatabaseConnection &)> &callback)
+{
+    const auto savepointId = m_savepoints + 1;
+
+    savepoint(savepointId);
+
+    try {
+        std::invoke(callback, databaseConnection());
+
+    } catch (...) {
+        // The savepoint is already gone if the database rolled back the transaction
+        if (m_inTransaction && m_savepoints >= savepointId)
+            rollbackToSavepoint(savepointId);
+
+        throw;
+    }
+}
+
+bool ManagesTransactions::rollBackAndShouldRetry(
+        const std::exception_ptr &ePtr, const int currentAttempt, const int attempts)
+{
+    if (m_inTransaction)
+        rollBack();
+
+    if (currentAttempt >= attempts)
+        return false;
+
+    try {
+        std::rethrow_exception(ePtr);
+
+    } catch (const Exceptions::SqlError &e) {
+        return DetectsConcurrencyErrors::causedByConcurrencyError(e);
+
+    } catch (...) {
+        return false;
+    }
+}
+
+void ManagesTransactions::sleepBeforeRetry(const std::chrono::milliseconds backoff,
+                                           const int currentAttempt)
+{
+    if (backoff.count() <= 0)
+        return;
+
+    // Exponential backoff with the equal jitter, half of the delay is random
+    const auto delay = std::min<qint64>(
+                           backoff.count() << std::min(currentAttempt - 1, 16),
+                           MaxRetryDelay.count());
+    const auto half = delay / 2;
+
+    const auto jitter = static_cast<qint64>(
+                            QRandomGenerator::global()->bounded(
+                                static_cast<double>(half + 1)));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(half + jitter));
+}
+
 DatabaseConnection &ManagesTransactions::resetTransactions()
 {
     m_savepoints = 0;
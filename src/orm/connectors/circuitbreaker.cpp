@@ -0,0 +1,280 @@
+#include "orm/connectors/circuitbreaker.hpp"
+
+#include <QDebug>
+
+#include <unordered_map>
+
+#include "orm/constants.hpp"
+#include "orm/exceptions/circuitbreakeropenerror.hpp"
+#include "orm/utils/type.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using Orm::Constants::circuit_open_time;
+using Orm::Constants::circuit_threshold;
+
+namespace Orm::Connectors
+{
+
+/*!
+    \class CircuitBreaker
+    \brief The CircuitBreaker class protects the database from reconnect storms.
+
+    \ingroup database
+    \inmodule Export
+
+    When the database restarts, all threads detect the lost connection at once and all
+    of them reconnect and re-run their queries. The circuit breaker is shared by all
+    connections with the same name, so after a few failures the circuit opens and
+    all threads fail fast with the CircuitBreakerOpenError, only one probe query per
+    circuit_open_time period touches the database until it recovers. Every query is
+    wrapped in the CircuitBreakerGuard, so the probe that never records its result
+    doesn't keep the circuit half-open.
+*/
+
+namespace
+{
+    /*! Default time the circuit stays open before the probe. */
+    constexpr std::chrono::milliseconds DefaultOpenTime {5000};
+
+    /*! Process-wide registry of circuit breakers. */
+    struct CircuitBreakerRegistry
+    {
+        /*! Mutex that guards the registry. */
+        std::mutex mutex;
+        /*! Circuit breakers, the key is the connection name. */
+        std::unordered_map<QString, std::shared_ptr<CircuitBreaker>> breakers;
+    };
+
+    /*! Get the process-wide registry of circuit breakers. */
+    CircuitBreakerRegistry &registry()
+    {
+        static CircuitBreakerRegistry instance;
+
+        return instance;
+    }
+
+    /*! Get the state name for log messages. */
+    const char *stateName(const CircuitState state)
+    {
+        switch (state) {
+        case CircuitState::Closed:
+            return "closed";
+
+        case CircuitState::Open:
+            return "open";
+
+        case CircuitState::HalfOpen:
+            return "half-open";
+
+        default:
+            Q_UNREACHABLE();
+        }
+    }
+} // namespace
+
+/* public */
+
+CircuitBreaker::CircuitBreaker(QString connection, const std::size_t threshold,
+                               const std::chrono::milliseconds openTime)
+    : m_connection(std::move(connection))
+    , m_threshold(threshold)
+    , m_openTime(openTime)
+{}
+
+std::shared_ptr<CircuitBreaker>
+CircuitBreaker::forConnection(const QString &connection, const QVariantHash &config)
+{
+    const auto threshold_ = threshold(config);
+
+    // Disabled
+    if (threshold_ == 0)
+        return nullptr;
+
+    auto &registry_ = registry();
+
+    std::scoped_lock lock(registry_.mutex);
+
+    auto &breaker = registry_.breakers[connection];
+
+    if (!breaker)
+        breaker = std::make_shared<CircuitBreaker>(connection, threshold_,
+                                                   openTime(config));
+
+    return breaker;
+}
+
+std::optional<CircuitBreakerStats> CircuitBreaker::stats(const QString &connection)
+{
+    auto &registry_ = registry();
+
+    std::scoped_lock lock(registry_.mutex);
+
+    const auto it = registry_.breakers.find(connection);
+
+    if (it == registry_.breakers.cend())
+        return std::nullopt;
+
+    return it->second->stats();
+}
+
+void CircuitBreaker::remove(const QString &connection)
+{
+    auto &registry_ = registry();
+
+    std::scoped_lock lock(registry_.mutex);
+
+    registry_.breakers.erase(connection);
+}
+
+bool CircuitBreaker::acquire()
+{
+    // Hot path
+    if (m_state.load(std::memory_order_acquire) == CircuitState::Closed)
+        return false;
+
+    std::scoped_lock lock(m_mutex);
+
+    const auto now = std::chrono::steady_clock::now();
+
+    switch (m_state.load(std::memory_order_relaxed)) {
+    case CircuitState::Closed:
+        return false;
+
+    case CircuitState::Open:
+        // Let this query through as the probe
+        if (now >= m_openUntil) {
+            transitionTo(CircuitState::HalfOpen);
+            m_probing = true;
+            m_probeUntil = now + m_openTime;
+            return true;
+        }
+        break;
+
+    case CircuitState::HalfOpen:
+        /* The previous probe has finished without the result or it hasn't reported
+           the result for the circuit_open_time, let this query probe again. */
+        if (!m_probing || now >= m_probeUntil) {
+            m_probing = true;
+            m_probeUntil = now + m_openTime;
+            return true;
+        }
+        break;
+
+    default:
+        Q_UNREACHABLE();
+    }
+
+    ++m_stats.rejected;
+
+    throw Exceptions::CircuitBreakerOpenError(
+                QStringLiteral("The circuit breaker for the '%1' connection is open "
+                               "after %2 consecutive connection failures, the query "
+                               "was not executed in %3().")
+                .arg(m_connection).arg(m_stats.consecutiveFailures)
+                .arg(__tiny_func__));
+}
+
+void CircuitBreaker::release()
+{
+    std::scoped_lock lock(m_mutex);
+
+    if (m_state.load(std::memory_order_relaxed) == CircuitState::HalfOpen)
+        m_probing = false;
+}
+
+void CircuitBreaker::recordSuccess()
+{
+    // Hot path
+    if (m_state.load(std::memory_order_acquire) == CircuitState::Closed &&
+        !m_hasFailures.load(std::memory_order_acquire)
+    )
+        return;
+
+    std::scoped_lock lock(m_mutex);
+
+    m_stats.consecutiveFailures = 0;
+    m_hasFailures.store(false, std::memory_order_release);
+    m_probing = false;
+
+    if (m_state.load(std::memory_order_relaxed) != CircuitState::Closed)
+        transitionTo(CircuitState::Closed);
+}
+
+void CircuitBreaker::recordFailure()
+{
+    std::scoped_lock lock(m_mutex);
+
+    ++m_stats.consecutiveFailures;
+    m_hasFailures.store(true, std::memory_order_release);
+
+    const auto state = m_state.load(std::memory_order_relaxed);
+
+    // The probe failed or too many failures, (re-)open the circuit
+    if ((state == CircuitState::HalfOpen && m_probing) ||
+        (state == CircuitState::Closed && m_stats.consecutiveFailures >= m_threshold)
+    ) {
+        m_probing = false;
+        m_openUntil = std::chrono::steady_clock::now() + m_openTime;
+
+        transitionTo(CircuitState::Open);
+    }
+}
+
+CircuitBreakerStats CircuitBreaker::stats() const
+{
+    std::scoped_lock lock(m_mutex);
+
+    auto stats = m_stats;
+    stats.state = m_state.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+std::size_t CircuitBreaker::threshold(const QVariantHash &config)
+{
+    if (!config.contains(circuit_threshold))
+        return 0;
+
+    return config[circuit_threshold].value<std::size_t>();
+}
+
+std::chrono::milliseconds CircuitBreaker::openTime(const QVariantHash &config)
+{
+    if (!config.contains(circuit_open_time))
+        return DefaultOpenTime;
+
+    return std::chrono::milliseconds(config[circuit_open_time].value<qint64>());
+}
+
+/* private */
+
+void CircuitBreaker::transitionTo(const CircuitState state)
+{
+    const auto previous = m_state.exchange(state, std::memory_order_acq_rel);
+
+    switch (state) {
+    case CircuitState::Closed:
+        ++m_stats.closed;
+        break;
+
+    case CircuitState::Open:
+        ++m_stats.opened;
+        break;
+
+    case CircuitState::HalfOpen:
+        ++m_stats.halfOpened;
+        break;
+
+    default:
+        Q_UNREACHABLE();
+    }
+
+    qWarning().noquote()
+            << QStringLiteral("Circuit breaker for the '%1' connection: %2 -> %3")
+               .arg(m_connection, stateName(previous), stateName(state));
+}
+
+} // namespace Orm::Connectors
+
+TINYORM_END_COMMON_NAMESPACE
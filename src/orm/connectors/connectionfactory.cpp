@@ -1,6 +1,9 @@
 #include "orm/connectors/connectionfactory.hpp"
 
+#include <QElapsedTimer>
+
 #include "orm/configurations/configurationparserfactory.hpp"
+#include "orm/connectors/hostselector.hpp"
 #include "orm/connectors/mysqlconnector.hpp"
 #include "orm/connectors/postgresconnector.hpp"
 #include "orm/connectors/sqliteconnector.hpp"
@@ -26,6 +29,9 @@ ConnectionFactory::make(QVariantHash &config, const ConnectionName &connection)
     // Parse and prepare the database configuration
     auto configCopy = parseConfiguration(config, connection);
 
+    if (configCopy.contains(read_))
+        return createReadWriteConnection(std::move(configCopy));
+
     return createSingleConnection(std::move(configCopy));
 }
 
@@ -58,6 +64,11 @@ ConnectionFactory::createConnector(const QVariantHash &config)
                 .arg(driver, __tiny_func__));
 }
 
+QString ConnectionFactory::readConnectionName(const QString &connection)
+{
+    return QStringLiteral("%1-read").arg(connection);
+}
+
 /* protected */
 
 QVariantHash
@@ -85,6 +96,71 @@ ConnectionFactory::createSingleConnection(QVariantHash &&config)
                 std::move(config), returnQDateTime);
 }
 
+std::shared_ptr<DatabaseConnection>
+ConnectionFactory::createReadWriteConnection(QVariantHash &&config)
+{
+    /* The write connection is the main DatabaseConnection, it's used for all
+       the statements, transactions, and the schema builder, the read connection is
+       only a second QSqlDatabase connection resolver used by the select queries. */
+    auto readConfig = getReadConfig(config);
+
+    auto connection = createSingleConnection(getWriteConfig(config));
+
+    connection->setReadQtConnectionResolver(createQSqlDatabaseResolver(readConfig));
+
+    return connection;
+}
+
+QVariantHash ConnectionFactory::getReadConfig(const QVariantHash &config)
+{
+    auto readConfig = mergeReadWriteConfig(config, getReadWriteConfig(config, read_));
+
+    /* Every QSqlDatabase connection must have its own name, the NAME is also
+       the QSqlDatabase connection name. */
+    readConfig[NAME] = readConnectionName(config[NAME].value<QString>());
+
+    return readConfig;
+}
+
+QVariantHash ConnectionFactory::getWriteConfig(const QVariantHash &config)
+{
+    // The write configuration is optional, the top-level configuration is used if missing
+    if (!config.contains(write_))
+        return mergeReadWriteConfig(config, {});
+
+    return mergeReadWriteConfig(config, getReadWriteConfig(config, write_));
+}
+
+QVariantHash
+ConnectionFactory::getReadWriteConfig(const QVariantHash &config, const QString &type)
+{
+    const auto &readWriteConfig = config[type];
+
+    if (readWriteConfig.canConvert<QVariantHash>())
+        return readWriteConfig.value<QVariantHash>();
+
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The '%1' configuration option must be of the QVariantHash "
+                               "type for the '%2' connection in %3().")
+                .arg(type, config[NAME].value<QString>(), __tiny_func__));
+}
+
+QVariantHash
+ConnectionFactory::mergeReadWriteConfig(const QVariantHash &config,
+                                        const QVariantHash &merge)
+{
+    auto merged = config;
+
+    // The read/write configuration overrides the top-level configuration options
+    for (auto it = merge.constBegin(); it != merge.constEnd(); ++it)
+        merged.insert(it.key(), it.value());
+
+    merged.remove(read_);
+    merged.remove(write_);
+
+    return merged;
+}
+
 std::function<ConnectionName()>
 ConnectionFactory::createQSqlDatabaseResolver(const QVariantHash &config)
 {
@@ -96,23 +172,35 @@ ConnectionFactory::createQSqlDatabaseResolver(const QVariantHash &config)
 std::function<ConnectionName()>
 ConnectionFactory::createQSqlDatabaseResolverWithHosts(const QVariantHash &config)
 {
+    // Validate the host_strategy configuration option early
+    std::ignore = HostSelector::strategy(config);
+
     // Pass the config by value because it will be destroyed in the parseConfig()
     return [config = config]() mutable -> ConnectionName
     {
-        const auto hosts = parseHosts(config);
+        /* Order hosts by the host_strategy configuration option and try to connect
+           to them one by one, until the connection will be successful. Hosts that
+           failed recently (in the host_cooldown period) are tried as the last ones,
+           so a dead host doesn't cost the connect timeout on every reconnect. */
+        const auto hosts = HostSelector::orderHosts(parseHosts(config), config);
         std::exception_ptr lastException;
 
-        // FUTURE add support for multiple hosts and connect randomly to one of them, in this step have to take into account also the sticky config paramater silverqx
-        /* This for statement do nothing for now, it purpose is to randomly
-           shuffle hosts and try to connect to them one be one, until the connection
-           will be successful. */
         for (const auto &host : hosts)
             try {
                 config[host_] = host;
 
-                return createConnector(config)->connect(config);
+                QElapsedTimer timer;
+                timer.start();
+
+                auto connectionName = createConnector(config)->connect(config);
+
+                HostSelector::markSuccess(config, host, timer.elapsed());
+
+                return connectionName;
 
             }  catch (const std::exception &) {
+                HostSelector::markFailure(config, host);
+
                 // Save last exception to be able to re-throw
                 lastException = std::current_exception();
                 continue;
@@ -66,6 +66,11 @@ Connector::createQSqlDatabaseConnection(const QString &name, const QVariantHash
                       ? QSqlDatabase::database(name, false)
                       : addQSqlDatabaseConnection(name, config, options);
 
+    /* The host can change between connects if multiple hosts are configured,
+       the connection resolver tries them one by one. */
+    if (const auto host = config[host_].value<QString>(); db.hostName() != host)
+        db.setHostName(host);
+
     if (!db.open())
         throw Exceptions::SqlError(
                 QStringLiteral("Failed to open database connection in %1().")
@@ -0,0 +1,257 @@
+#include "orm/connectors/hostselector.hpp"
+
+#include <QRandomGenerator>
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+#include "orm/constants.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/utils/type.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using Orm::Constants::COMMA;
+using Orm::Constants::driver_;
+using Orm::Constants::host_cooldown;
+using Orm::Constants::host_strategy;
+using Orm::Constants::port_;
+
+namespace Orm::Connectors
+{
+
+/*!
+    \class HostSelector
+    \brief The HostSelector class orders the configured hosts and tracks their health.
+
+    \ingroup database
+    \inmodule Export
+
+    The health registry is process-wide and it's shared by all connections and threads,
+    so when one thread detects a dead host, all other threads skip it for
+    the host_cooldown period instead of paying the connect timeout again.
+*/
+
+namespace
+{
+    /*! Default host cool-down after a failed connect. */
+    constexpr std::chrono::milliseconds DefaultCooldown {30000};
+
+    /*! Weight of the last connect time in the latency moving average (1/4). */
+    constexpr qint64 LatencyWeight = 4;
+
+    /*! Host health state. */
+    struct HostState
+    {
+        /*! Public health information. */
+        HostHealth health {};
+        /*! The host is skipped until this time point. */
+        std::chrono::steady_clock::time_point cooldownUntil {};
+    };
+
+    /*! Process-wide registry of hosts health. */
+    struct HostRegistry
+    {
+        /*! Mutex that guards the registry. */
+        std::mutex mutex;
+        /*! Hosts health state, the key is driver/host:port. */
+        std::unordered_map<QString, HostState> hosts;
+        /*! Next round-robin offset for the hosts list. */
+        std::unordered_map<QString, std::size_t> roundRobin;
+    };
+
+    /*! Get the process-wide registry of hosts health. */
+    HostRegistry &registry()
+    {
+        static HostRegistry instance;
+
+        return instance;
+    }
+
+    /*! Determine whether the host is in the cool-down. */
+    bool isCoolingDown(const HostRegistry &registry, const QString &key,
+                       const std::chrono::steady_clock::time_point now)
+    {
+        const auto it = registry.hosts.find(key);
+
+        return it != registry.hosts.cend() && it->second.cooldownUntil > now;
+    }
+} // namespace
+
+/* public */
+
+QStringList HostSelector::orderHosts(const QStringList &hosts, const QVariantHash &config)
+{
+    // Nothing to order
+    if (hosts.size() <= 1)
+        return hosts;
+
+    auto ordered = hosts;
+    auto &registry_ = registry();
+
+    std::scoped_lock lock(registry_.mutex);
+
+    switch (strategy(config)) {
+    case HostStrategy::Sequential:
+        break;
+
+    case HostStrategy::Random:
+        std::shuffle(ordered.begin(), ordered.end(), *QRandomGenerator::global());
+        break;
+
+    case HostStrategy::RoundRobin: {
+        auto &offset = registry_.roundRobin[hostsKey(hosts, config)];
+
+        std::rotate(ordered.begin(),
+                    ordered.begin() + static_cast<QStringList::size_type>(
+                                          offset % static_cast<std::size_t>(
+                                              ordered.size())),
+                    ordered.end());
+        ++offset;
+        break;
+    }
+    case HostStrategy::LowestLatency:
+        /* Hosts without any successful connect are tried first, so their latency
+           will be measured. */
+        std::ranges::stable_sort(ordered, {}, [&config, &registry_](const QString &host)
+        {
+            const auto it = registry_.hosts.find(hostKey(config, host));
+
+            return it == registry_.hosts.cend() ? -1 : it->second.health.latency;
+        });
+        break;
+
+    default:
+        Q_UNREACHABLE();
+    }
+
+    // Hosts that failed recently will be tried as the last ones
+    const auto now = std::chrono::steady_clock::now();
+
+    std::ranges::stable_partition(ordered, [&config, &registry_, now]
+                                           (const QString &host)
+    {
+        return !isCoolingDown(registry_, hostKey(config, host), now);
+    });
+
+    return ordered;
+}
+
+void HostSelector::markSuccess(const QVariantHash &config, const QString &host,
+                               const qint64 elapsed)
+{
+    auto &registry_ = registry();
+
+    std::scoped_lock lock(registry_.mutex);
+
+    auto &state = registry_.hosts[hostKey(config, host)];
+    auto &health = state.health;
+
+    ++health.successes;
+    health.consecutiveFailures = 0;
+    health.latency = health.latency < 0
+                     ? elapsed
+                     : health.latency + (elapsed - health.latency) / LatencyWeight;
+
+    state.cooldownUntil = {};
+}
+
+void HostSelector::markFailure(const QVariantHash &config, const QString &host)
+{
+    const auto cooldown_ = cooldown(config);
+
+    auto &registry_ = registry();
+
+    std::scoped_lock lock(registry_.mutex);
+
+    auto &state = registry_.hosts[hostKey(config, host)];
+
+    ++state.health.failures;
+    ++state.health.consecutiveFailures;
+
+    state.cooldownUntil = std::chrono::steady_clock::now() + cooldown_;
+}
+
+std::optional<HostHealth>
+HostSelector::health(const QVariantHash &config, const QString &host)
+{
+    auto &registry_ = registry();
+
+    std::scoped_lock lock(registry_.mutex);
+
+    const auto key = hostKey(config, host);
+    const auto it = registry_.hosts.find(key);
+
+    if (it == registry_.hosts.cend())
+        return std::nullopt;
+
+    auto health = it->second.health;
+    health.coolingDown = isCoolingDown(registry_, key,
+                                       std::chrono::steady_clock::now());
+
+    return health;
+}
+
+void HostSelector::resetHealth()
+{
+    auto &registry_ = registry();
+
+    std::scoped_lock lock(registry_.mutex);
+
+    registry_.hosts.clear();
+    registry_.roundRobin.clear();
+}
+
+HostStrategy HostSelector::strategy(const QVariantHash &config)
+{
+    if (!config.contains(host_strategy))
+        return HostStrategy::Sequential;
+
+    const auto strategy = config[host_strategy].value<QString>().toLower();
+
+    if (strategy == QStringLiteral("sequential"))
+        return HostStrategy::Sequential;
+
+    if (strategy == QStringLiteral("random"))
+        return HostStrategy::Random;
+
+    if (strategy == QStringLiteral("round_robin"))
+        return HostStrategy::RoundRobin;
+
+    if (strategy == QStringLiteral("latency"))
+        return HostStrategy::LowestLatency;
+
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The '%1' value for the 'host_strategy' configuration "
+                               "option is not valid, allowed values are: sequential, "
+                               "random, round_robin, latency in %2().")
+                .arg(strategy, __tiny_func__));
+}
+
+std::chrono::milliseconds HostSelector::cooldown(const QVariantHash &config)
+{
+    if (!config.contains(host_cooldown))
+        return DefaultCooldown;
+
+    return std::chrono::milliseconds(config[host_cooldown].value<qint64>());
+}
+
+/* private */
+
+QString HostSelector::hostKey(const QVariantHash &config, const QString &host)
+{
+    return QStringLiteral("%1/%2:%3").arg(config[driver_].value<QString>(), host,
+                                          config[port_].value<QString>());
+}
+
+QString HostSelector::hostsKey(const QStringList &hosts, const QVariantHash &config)
+{
+    return QStringLiteral("%1/%2:%3").arg(config[driver_].value<QString>(),
+                                          hosts.join(COMMA),
+                                          config[port_].value<QString>());
+}
+
+} // namespace Orm::Connectors
+
+TINYORM_END_COMMON_NAMESPACE
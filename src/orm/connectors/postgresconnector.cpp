@@ -2,6 +2,10 @@
 
 #include <QtSql/QSqlQuery>
 
+#ifdef TINYORM_LIBPQ_DRIVER
+#  include "orm/drivers/libpqdriver.hpp"
+#endif
+#include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/exceptions/queryerror.hpp"
 #include "orm/utils/container.hpp"
 #include "orm/utils/type.hpp"
@@ -11,9 +15,12 @@ TINYORM_BEGIN_COMMON_NAMESPACE
 using Orm::Constants::DEFAULT;
 using Orm::Constants::LOCAL;
 using Orm::Constants::NAME;
+using Orm::Constants::QPSQL_LIBPQ;
 using Orm::Constants::TMPL_DQUOTES;
 using Orm::Constants::charset_;
+using Orm::Constants::driver_;
 using Orm::Constants::isolation_level;
+using Orm::Constants::libpq_native;
 using Orm::Constants::search_path;
 using Orm::Constants::synchronous_commit;
 using Orm::Constants::timezone_;
@@ -36,7 +43,7 @@ PostgresConnector::connect(const QVariantHash &config) const
     const auto options = getOptions(config);
 
     // Create and open new database connection
-    const auto connection = createConnection(name, config, options);
+    const auto connection = createConnection(name, nativeDriverConfig(config), options);
 
     // Transaction isolation level
     configureIsolationLevel(connection, config);
@@ -72,6 +79,28 @@ PostgresConnector::getConnectorOptions() const
 
 /* protected */
 
+QVariantHash PostgresConnector::nativeDriverConfig(const QVariantHash &config)
+{
+    // Nothing to do, use the QPSQL driver
+    if (!config.value(libpq_native).value<bool>())
+        return config;
+
+#ifdef TINYORM_LIBPQ_DRIVER
+    Drivers::LibPqDriver::registerDriver();
+
+    auto nativeConfig = config;
+    nativeConfig[driver_] = QPSQL_LIBPQ;
+
+    return nativeConfig;
+#else
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The 'libpq_native' configuration option needs TinyORM "
+                               "built with the libpq driver (the LIBPQ_DRIVER CMake "
+                               "option or the libpq_driver qmake CONFIG) in %1().")
+                .arg(__tiny_func__));
+#endif
+}
+
 void PostgresConnector::configureIsolationLevel(const QSqlDatabase &connection,
                                                 const QVariantHash &config)
 {
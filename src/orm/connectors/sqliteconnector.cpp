@@ -3,7 +3,13 @@
 #include <QFile>
 #include <QtSql/QSqlQuery>
 
+#include <unordered_map>
+
 #include "orm/constants.hpp"
+#ifdef TINYORM_SQLITE3_DRIVER
+#  include "orm/drivers/sqlite3driver.hpp"
+#endif
+#include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/exceptions/queryerror.hpp"
 #include "orm/exceptions/sqlitedatabasedoesnotexisterror.hpp"
 #include "orm/utils/type.hpp"
@@ -11,9 +17,20 @@
 TINYORM_BEGIN_COMMON_NAMESPACE
 
 using Orm::Constants::NAME;
+using Orm::Constants::QSQLITE_LIB;
+using Orm::Constants::busy_timeout;
+using Orm::Constants::cache_size;
 using Orm::Constants::check_database_exists;
 using Orm::Constants::database_;
+using Orm::Constants::driver_;
 using Orm::Constants::foreign_key_constraints;
+using Orm::Constants::journal_mode;
+using Orm::Constants::mmap_size;
+using Orm::Constants::query_only;
+using Orm::Constants::sqlite3_native;
+using Orm::Constants::synchronous;
+using Orm::Constants::temp_store;
+using Orm::Constants::wal_readers;
 
 using TypeUtils = Orm::Utils::Type;
 
@@ -29,12 +46,22 @@ SQLiteConnector::connect(const QVariantHash &config) const
 
     const auto options = getOptions(config);
 
+    const auto isMemory = config[database_].value<QString>() ==
+                          QStringLiteral(":memory:");
+
+    // Validate the PRAGMA configuration options early, before connecting
+    const auto pragmas = getPragmas(config, isMemory);
+
     /* SQLite supports "in-memory" databases that only last as long as the owning
        connection does. These are useful for tests or for short lifetime store
        querying. In-memory databases may only have a single open connection. */
-    if (config[database_].value<QString>() == QStringLiteral(":memory:")) {
+    if (isMemory) {
         // sqlite :memory: driver
-        createConnection(name, config, options);
+        const auto connection = createConnection(name, nativeDriverConfig(config),
+                                                 options);
+
+        // PRAGMA tuning options
+        configurePragmas(connection, pragmas, isMemory);
 
         return name;
     }
@@ -45,11 +72,14 @@ SQLiteConnector::connect(const QVariantHash &config) const
     checkDatabaseExists(config);
 
     // Create and open new database connection
-    const auto connection = createConnection(name, config, options);
+    const auto connection = createConnection(name, nativeDriverConfig(config), options);
 
     // Foreign key constraints
     configureForeignKeyConstraints(connection, config);
 
+    // PRAGMA tuning options
+    configurePragmas(connection, pragmas, isMemory);
+
     /* Return only connection name, because QSqlDatabase documentation doesn't
        recommend to store QSqlDatabase instance as a class data member, we can
        simply obtain the connection by QSqlDatabase::connection() when needed. */
@@ -64,6 +94,29 @@ SQLiteConnector::getConnectorOptions() const
 
 /* protected */
 
+QVariantHash SQLiteConnector::nativeDriverConfig(const QVariantHash &config)
+{
+    // Nothing to do, use the QSQLITE driver
+    if (!config.value(sqlite3_native).value<bool>())
+        return config;
+
+#ifdef TINYORM_SQLITE3_DRIVER
+    Drivers::SQLite3Driver::registerDriver();
+
+    auto nativeConfig = config;
+    nativeConfig[driver_] = QSQLITE_LIB;
+
+    return nativeConfig;
+#else
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The 'sqlite3_native' configuration option needs "
+                               "TinyORM built with the sqlite3 driver (the "
+                               "SQLITE3_DRIVER CMake option or the sqlite3_driver "
+                               "qmake CONFIG) in %1().")
+                .arg(__tiny_func__));
+#endif
+}
+
 void SQLiteConnector::configureForeignKeyConstraints(const QSqlDatabase &connection,
                                                      const QVariantHash &config)
 {
@@ -85,8 +138,131 @@ void SQLiteConnector::configureForeignKeyConstraints(const QSqlDatabase &connect
                                  m_configureErrorMessage.arg(__tiny_func__), query);
 }
 
+QVector<std::pair<QString, QString>>
+SQLiteConnector::getPragmas(const QVariantHash &config, const bool isMemory)
+{
+    /* The wal_readers option means one writer connection and the pool of read-only
+       reader connections, the readers don't block the writer and the writer doesn't
+       block the readers only in the WAL journal mode. */
+    auto journalMode = config.value(journal_mode);
+
+    if (config.contains(wal_readers)) {
+        if (isMemory)
+            throw Exceptions::InvalidArgumentError(
+                    QStringLiteral("The 'wal_readers' configuration option can't be "
+                                   "used with the in-memory database, every "
+                                   "connection has its own in-memory database "
+                                   "in %1().")
+                    .arg(__tiny_func__));
+
+        if (!journalMode.isValid())
+            journalMode = QStringLiteral("WAL");
+
+        else if (pragmaValue(journal_mode, journalMode) != QStringLiteral("WAL"))
+            throw Exceptions::InvalidArgumentError(
+                    QStringLiteral("The 'wal_readers' configuration option needs "
+                                   "the 'journal_mode' configuration option to be "
+                                   "'WAL' in %1().")
+                    .arg(__tiny_func__));
+    }
+
+    /* The busy_timeout is first so the following pragmas wait for the locks,
+       the order of others doesn't matter. */
+    const std::initializer_list<std::pair<QString, QVariant>> options {
+        {busy_timeout, config.value(busy_timeout)},
+        {journal_mode, journalMode},
+        {synchronous,  config.value(synchronous)},
+        {cache_size,   config.value(cache_size)},
+        {mmap_size,    config.value(mmap_size)},
+        {temp_store,   config.value(temp_store)},
+        {query_only,   config.value(query_only)},
+    };
+
+    QVector<std::pair<QString, QString>> pragmas;
+
+    for (const auto &[option, value] : options) {
+        // This ensures default SQLite behavior
+        if (!value.isValid() || value.isNull())
+            continue;
+
+        pragmas.append({option, pragmaValue(option, value)});
+    }
+
+    return pragmas;
+}
+
+void SQLiteConnector::configurePragmas(
+        const QSqlDatabase &connection,
+        const QVector<std::pair<QString, QString>> &pragmas, const bool isMemory)
+{
+    QSqlQuery query(connection);
+
+    for (const auto &[option, value] : pragmas) {
+        if (!query.exec(QStringLiteral("PRAGMA %1 = %2;").arg(option, value)))
+            throw Exceptions::QueryError(connection.connectionName(),
+                                         m_configureErrorMessage.arg(__tiny_func__),
+                                         query);
+
+        /* The journal_mode pragma returns the new journal mode, it silently stays
+           unchanged if it can't be changed (eg. the WAL on a read-only database),
+           the in-memory database always uses the MEMORY or OFF mode. */
+        if (option != journal_mode || isMemory)
+            continue;
+
+        if (query.next() && query.value(0).value<QString>().toUpper() == value)
+            continue;
+
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("Unable to set the 'journal_mode = %1' for the '%2' "
+                               "SQLite connection in %3().")
+                .arg(value, connection.connectionName(), __tiny_func__));
+    }
+}
+
 /* private */
 
+QString SQLiteConnector::pragmaValue(const QString &option, const QVariant &value)
+{
+    // Pragmas with the keyword values (numeric values are also allowed by SQLite)
+    static const std::unordered_map<QString, QStringList> keywordsCache {
+        {journal_mode, {QStringLiteral("DELETE"), QStringLiteral("TRUNCATE"),
+                        QStringLiteral("PERSIST"), QStringLiteral("MEMORY"),
+                        QStringLiteral("WAL"), QStringLiteral("OFF")}},
+        {synchronous,  {QStringLiteral("OFF"), QStringLiteral("NORMAL"),
+                        QStringLiteral("FULL"), QStringLiteral("EXTRA"),
+                        QStringLiteral("0"), QStringLiteral("1"), QStringLiteral("2"),
+                        QStringLiteral("3")}},
+        {temp_store,   {QStringLiteral("DEFAULT"), QStringLiteral("FILE"),
+                        QStringLiteral("MEMORY"), QStringLiteral("0"),
+                        QStringLiteral("1"), QStringLiteral("2")}},
+    };
+
+    if (option == query_only)
+        return TypeUtils::isTrue(value) ? QStringLiteral("ON") : QStringLiteral("OFF");
+
+    // The values are interpolated into the query, so they have to be validated
+    if (const auto keywords = keywordsCache.find(option);
+        keywords != keywordsCache.cend()
+    ) {
+        if (auto keyword = value.value<QString>().trimmed().toUpper();
+            keywords->second.contains(keyword)
+        )
+            return keyword;
+    }
+    else {
+        auto ok = false;
+        const auto number = value.value<QString>().trimmed().toLongLong(&ok);
+
+        if (ok)
+            return QString::number(number);
+    }
+
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral("Invalid value '%1' for the '%2' SQLite configuration "
+                               "option in %3().")
+                .arg(value.value<QString>(), option, __tiny_func__));
+}
+
 void SQLiteConnector::checkDatabaseExists(const QVariantHash &config)
 {
     const auto path = config[database_].value<QString>();
@@ -60,7 +60,9 @@ namespace Orm::Constants
     // Database related
     const QString QMYSQL       = QStringLiteral("QMYSQL");
     const QString QPSQL        = QStringLiteral("QPSQL");
+    const QString QPSQL_LIBPQ  = QStringLiteral("QPSQL_LIBPQ");
     const QString QSQLITE      = QStringLiteral("QSQLITE");
+    const QString QSQLITE_LIB  = QStringLiteral("QSQLITE_LIB");
     const QString MYSQL_       = QStringLiteral("MySQL");
     const QString POSTGRESQL   = QStringLiteral("PostgreSQL");
     const QString SQLITE       = QStringLiteral("SQLite");
@@ -102,11 +104,40 @@ namespace Orm::Constants
     const QString isolation_level         = QStringLiteral("isolation_level");
     const QString foreign_key_constraints = QStringLiteral("foreign_key_constraints");
     const QString check_database_exists   = QStringLiteral("check_database_exists");
+    const QString journal_mode            = QStringLiteral("journal_mode");
+    const QString synchronous             = QStringLiteral("synchronous");
+    const QString cache_size              = QStringLiteral("cache_size");
+    const QString mmap_size               = QStringLiteral("mmap_size");
+    const QString temp_store              = QStringLiteral("temp_store");
+    const QString busy_timeout            = QStringLiteral("busy_timeout");
+    const QString query_only              = QStringLiteral("query_only");
+    const QString wal_readers             = QStringLiteral("wal_readers");
+    const QString in_array_threshold      = QStringLiteral("in_array_threshold");
+    const QString max_bindings            = QStringLiteral("max_bindings");
     const QString prefix_indexes          = QStringLiteral("prefix_indexes");
     const QString return_qdatetime        = QStringLiteral("return_qdatetime");
     const QString application_name        = QStringLiteral("application_name");
     const QString synchronous_commit      = QStringLiteral("synchronous_commit");
     const QString spatial_ref_sys         = QStringLiteral("spatial_ref_sys");
+    const QString pool_min_size           = QStringLiteral("pool_min_size");
+    const QString pool_max_size           = QStringLiteral("pool_max_size");
+    const QString pool_acquire_timeout    = QStringLiteral("pool_acquire_timeout");
+    const QString pool_keepalive_interval = QStringLiteral("pool_keepalive_interval");
+    const QString pool_max_idle_time      = QStringLiteral("pool_max_idle_time");
+    const QString statement_cache_size    = QStringLiteral("statement_cache_size");
+    const QString statement_timeout       = QStringLiteral("statement_timeout");
+    const QString read_                   = QStringLiteral("read");
+    const QString write_                  = QStringLiteral("write");
+    const QString sticky                  = QStringLiteral("sticky");
+    const QString max_replica_lag         = QStringLiteral("max_replica_lag");
+    const QString replica_lag_interval    = QStringLiteral("replica_lag_interval");
+    const QString host_strategy           = QStringLiteral("host_strategy");
+    const QString host_cooldown           = QStringLiteral("host_cooldown");
+    const QString circuit_threshold       = QStringLiteral("circuit_threshold");
+    const QString circuit_open_time       = QStringLiteral("circuit_open_time");
+    const QString libpq_native            = QStringLiteral("libpq_native");
+    const QString sqlite3_native          = QStringLiteral("sqlite3_native");
+    const QString warm_up_statements      = QStringLiteral("warm_up_statements");
 
     const QString H127001   = QStringLiteral("127.0.0.1");
     const QString LOCALHOST = QStringLiteral("localhost");
@@ -4,10 +4,19 @@
 #  include <QDebug>
 #endif
 
+#include <QThread>
+
+#include <QtSql/QSqlDriver>
+#include <QtSql/QSqlField>
 #include <QtSql/QSqlRecord>
 
+#include <algorithm>
+
+#include "orm/connectors/connectionfactory.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/exceptions/lostconnectionerror.hpp"
 #include "orm/exceptions/multiplecolumnsselectederror.hpp"
+#include "orm/exceptions/querytimeouterror.hpp"
 #include "orm/query/querybuilder.hpp"
 #include "orm/utils/configuration.hpp"
 #include "orm/utils/type.hpp"
@@ -39,6 +48,138 @@ namespace Orm
     for savepoint. This makes it clear at a glance what is happening.
 */
 
+namespace
+{
+    /*! Get the duration in milliseconds from the given config. option (eg.
+        statement_timeout). */
+    std::optional<std::chrono::milliseconds>
+    millisecondsFromConfig(const QVariantHash &config, const QString &option)
+    {
+        const auto milliseconds = config.value(option);
+
+        if (!milliseconds.isValid() || milliseconds.isNull())
+            return std::nullopt;
+
+        return std::chrono::milliseconds(milliseconds.value<qint64>());
+    }
+
+    /*! Get the "where in" array binding threshold from the in_array_threshold
+        config. option (0 if disabled, it's opt-in). */
+    std::size_t inArrayThresholdFromConfig(const QVariantHash &config)
+    {
+        const auto threshold = config.value(in_array_threshold);
+
+        if (!threshold.isValid() || threshold.isNull())
+            return 0;
+
+        return static_cast<std::size_t>(threshold.value<qulonglong>());
+    }
+
+    /*! Get the maximum number of bound parameters from the max_bindings config.
+        option (0 for the grammar default). */
+    std::size_t maxBindingsFromConfig(const QVariantHash &config)
+    {
+        const auto maxBindings = config.value(max_bindings);
+
+        if (!maxBindings.isValid() || maxBindings.isNull())
+            return 0;
+
+        return static_cast<std::size_t>(maxBindings.value<qulonglong>());
+    }
+
+    /*! Throw if the number of placeholders doesn't match the number of bindings. */
+    [[noreturn]] void throwBindingsMismatch(const QString &queryString)
+    {
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The number of placeholders in the '%1' batch statement "
+                               "doesn't match the number of bindings in %2().")
+                .arg(queryString, __tiny_func__));
+    }
+
+    /*! Determine whether the given character can be a part of the identifier. */
+    bool isIdentifierCharacter(const QChar character)
+    {
+        return character.isLetterOrNumber() || character == QLatin1Char('_');
+    }
+
+    /*! Get the length of the comment or the dollar-quoted string that starts at
+        the given index, 0 if there is none (the PostgreSQL comments can be nested). */
+    QString::size_type
+    skippedLength(const QString &queryString, const QString::size_type index,
+                  const bool isMySql, const bool isPostgres)
+    {
+        const auto size = queryString.size();
+        const auto character = queryString[index];
+        const auto next = index + 1 < size ? queryString[index + 1] : QChar();
+
+        const auto lineLength = [&queryString, index, size]
+        {
+            const auto end = queryString.indexOf(QLatin1Char('\n'), index);
+            return end == -1 ? size - index : end - index;
+        };
+
+        // MySQL requires the whitespace after the double-dash
+        if (character == QLatin1Char('-') && next == QLatin1Char('-') &&
+            (!isMySql || index + 2 == size || queryString[index + 2].isSpace())
+        )
+            return lineLength();
+
+        if (isMySql && character == QLatin1Char('#'))
+            return lineLength();
+
+        if (character == QLatin1Char('/') && next == QLatin1Char('*')) {
+            auto depth = 0;
+            auto end = index;
+
+            while (end < size) {
+                if (queryString[end] == QLatin1Char('/') && end + 1 < size &&
+                    queryString[end + 1] == QLatin1Char('*') &&
+                    (isPostgres || depth == 0)
+                ) {
+                    ++depth;
+                    end += 2;
+                }
+                else if (queryString[end] == QLatin1Char('*') && end + 1 < size &&
+                         queryString[end + 1] == QLatin1Char('/')
+                ) {
+                    end += 2;
+
+                    if (--depth == 0)
+                        break;
+                }
+                else
+                    ++end;
+            }
+
+            return end - index;
+        }
+
+        /* PostgreSQL dollar-quoted string $tag$...$tag$, the tag can't start with
+           a digit ($1 is the positional parameter). */
+        if (!isPostgres || character != QLatin1Char('$') ||
+            (index > 0 && (isIdentifierCharacter(queryString[index - 1]) ||
+                           queryString[index - 1] == QLatin1Char('$')))
+        )
+            return 0;
+
+        auto tagEnd = index + 1;
+
+        if (tagEnd < size && (queryString[tagEnd].isLetter() ||
+                              queryString[tagEnd] == QLatin1Char('_'))
+        )
+            while (tagEnd < size && isIdentifierCharacter(queryString[tagEnd]))
+                ++tagEnd;
+
+        if (tagEnd >= size || queryString[tagEnd] != QLatin1Char('$'))
+            return 0;
+
+        const auto tag = queryString.mid(index, tagEnd - index + 1);
+        const auto end = queryString.indexOf(tag, tagEnd + 1);
+
+        return end == -1 ? size - index : end + tag.size() - index;
+    }
+} // namespace
+
 /* public */
 
 DatabaseConnection::DatabaseConnection(
@@ -54,6 +195,15 @@ DatabaseConnection::DatabaseConnection(
     , m_config(std::move(config))
     , m_connectionName(getConfig(NAME).value<QString>())
     , m_hostName(getConfig(host_).value<QString>())
+    , m_sticky(getConfig(sticky).value<bool>())
+    , m_statementCache(std::make_shared<Support::StatementCache>(
+                           getConfig(statement_cache_size).value<std::size_t>()))
+    , m_readStatementCache(std::make_shared<Support::StatementCache>(
+                               m_statementCache->capacity()))
+    , m_statementTimeout(millisecondsFromConfig(m_config, statement_timeout))
+    , m_maxReplicaLag(millisecondsFromConfig(m_config, max_replica_lag))
+    , m_replicaLagInterval(millisecondsFromConfig(m_config, replica_lag_interval)
+                           .value_or(DefaultReplicaLagInterval))
 {}
 
 DatabaseConnection::DatabaseConnection(
@@ -70,6 +220,15 @@ DatabaseConnection::DatabaseConnection(
     , m_config(std::move(config))
     , m_connectionName(getConfig(NAME).value<QString>())
     , m_hostName(getConfig(host_).value<QString>())
+    , m_sticky(getConfig(sticky).value<bool>())
+    , m_statementCache(std::make_shared<Support::StatementCache>(
+                           getConfig(statement_cache_size).value<std::size_t>()))
+    , m_readStatementCache(std::make_shared<Support::StatementCache>(
+                               m_statementCache->capacity()))
+    , m_statementTimeout(millisecondsFromConfig(m_config, statement_timeout))
+    , m_maxReplicaLag(millisecondsFromConfig(m_config, max_replica_lag))
+    , m_replicaLagInterval(millisecondsFromConfig(m_config, replica_lag_interval)
+                           .value_or(DefaultReplicaLagInterval))
 {}
 
 std::shared_ptr<QueryBuilder>
@@ -110,47 +269,24 @@ std::shared_ptr<QueryBuilder> DatabaseConnection::query()
 /* Running SQL Queries */
 
 SqlQuery
-DatabaseConnection::select(const QString &queryString, QVector<QVariant> bindings)
+DatabaseConnection::select(const QString &queryString, QVector<QVariant> bindings,
+                           const bool useReadConnection)
 {
-    auto queryResult = run<QSqlQuery>(
-                           queryString, std::move(bindings), Prepared,
-                           [this](const QString &queryString_,
-                                  const QVector<QVariant> &preparedBindings)
-                           -> QSqlQuery
-    {
-        if (m_pretending)
-            return getQtQueryForPretend();
-
-        // Prepare QSqlQuery
-        auto query = prepareQuery(queryString_);
-
-        bindValues(query, preparedBindings);
-
-        if (query.exec()) {
-            // Query statements counter
-            if (m_countingStatements)
-                ++m_statementsCounter.normal;
-
-            return query;
-        }
-
-        /* If an error occurs when attempting to run a query, we'll transform it
-           to the exception QueryError(), which formats the error message to
-           include the bindings with SQL, which will make this exception a lot
-           more helpful to the developer instead of just the database's errors. */
-        throw Exceptions::QueryError(
-                    m_connectionName,
-                    "Select statement in DatabaseConnection::select() failed.",
-                    query, preparedBindings);
-    });
+    return selectInternal(queryString, std::move(bindings), useReadConnection, false);
+}
 
-    return {std::move(queryResult), m_qtTimeZone, *m_queryGrammar, m_returnQDateTime};
+SqlQuery
+DatabaseConnection::cursor(const QString &queryString, QVector<QVariant> bindings,
+                           const bool useReadConnection)
+{
+    return selectInternal(queryString, std::move(bindings), useReadConnection, true);
 }
 
 SqlQuery
-DatabaseConnection::selectOne(const QString &queryString, QVector<QVariant> bindings)
+DatabaseConnection::selectOne(const QString &queryString, QVector<QVariant> bindings,
+                              const bool useReadConnection)
 {
-    auto query = select(queryString, std::move(bindings));
+    auto query = select(queryString, std::move(bindings), useReadConnection);
 
     query.first();
 
@@ -158,9 +294,10 @@ DatabaseConnection::selectOne(const QString &queryString, QVector<QVariant> bind
 }
 
 QVariant
-DatabaseConnection::scalar(const QString &queryString, QVector<QVariant> bindings)
+DatabaseConnection::scalar(const QString &queryString, QVector<QVariant> bindings,
+                           const bool useReadConnection)
 {
-    const auto query = selectOne(queryString, std::move(bindings));
+    const auto query = selectOne(queryString, std::move(bindings), useReadConnection);
 
     // Nothing to do, the query should be positioned on the first row/record
     if (!query.isValid())
@@ -177,17 +314,20 @@ DatabaseConnection::scalar(const QString &queryString, QVector<QVariant> binding
 SqlQuery
 DatabaseConnection::statement(const QString &queryString, QVector<QVariant> bindings)
 {
+    // Returns the cached prepared statement after the SqlQuery is destroyed
+    Support::StatementCache::CheckInType checkIn;
+
     auto queryResult = run<QSqlQuery>(
                            queryString, std::move(bindings), Prepared,
-                           [this](const QString &queryString_,
-                                  const QVector<QVariant> &preparedBindings)
+                           [this, &checkIn](const QString &queryString_,
+                                            const QVector<QVariant> &preparedBindings)
                            -> QSqlQuery
     {
         if (m_pretending)
             return getQtQueryForPretend();
 
         // Prepare QSqlQuery
-        auto query = prepareQuery(queryString_);
+        auto query = prepareQuery(queryString_, false, false, &checkIn);
 
         bindValues(query, preparedBindings);
 
@@ -206,13 +346,17 @@ DatabaseConnection::statement(const QString &queryString, QVector<QVariant> bind
            to the exception QueryError(), which formats the error message to
            include the bindings with SQL, which will make this exception a lot
            more helpful to the developer instead of just the database's errors. */
+        // Don't reuse the failed prepared statement (eg. invalidated cached plan)
+        forgetPreparedStatement(queryString_);
+
         throw Exceptions::QueryError(
                     m_connectionName,
                     "Statement in DatabaseConnection::statement() failed.",
                     query, preparedBindings);
     });
 
-    return {std::move(queryResult), m_qtTimeZone, *m_queryGrammar, m_returnQDateTime};
+    return {std::move(queryResult), m_qtTimeZone, *m_queryGrammar, m_returnQDateTime,
+            std::move(checkIn)};
 }
 
 std::tuple<int, QSqlQuery>
@@ -249,6 +393,9 @@ DatabaseConnection::affectingStatement(const QString &queryString,
            to the exception QueryError(), which formats the error message to
            include the bindings with SQL, which will make this exception a lot
            more helpful to the developer instead of just the database's errors. */
+        // Don't reuse the failed prepared statement (eg. invalidated cached plan)
+        forgetPreparedStatement(queryString_);
+
         throw Exceptions::QueryError(
                     m_connectionName,
                     "Affecting statement in DatabaseConnection::affectingStatement() "
@@ -268,6 +415,8 @@ SqlQuery DatabaseConnection::unprepared(const QString &queryString)
         if (m_pretending)
             return getQtQueryForPretend();
 
+        applyStatementTimeout(false);
+
         // Prepare unprepared QSqlQuery 🙂
         auto query = getQtQuery();
 
@@ -294,6 +443,26 @@ SqlQuery DatabaseConnection::unprepared(const QString &queryString)
     return {std::move(queryResult), m_qtTimeZone, *m_queryGrammar, m_returnQDateTime};
 }
 
+QVector<int> DatabaseConnection::batch(const QVector<BatchStatement> &statements)
+{
+    if (statements.isEmpty())
+        return {};
+
+    // One round trip for the whole batch
+    if (!m_pretending && statements.size() > 1 && supportsMultiStatementBatch())
+        return runMultiStatementBatch(statements);
+
+    /* Execute the statements back to back, it's the fastest way for the in-process
+       databases (SQLite) and for drivers without the multi-statement support. */
+    QVector<int> affected;
+    affected.reserve(statements.size());
+
+    for (const auto &[queryString, bindings] : statements)
+        affected << std::get<0>(affectingStatement(queryString, bindings));
+
+    return affected;
+}
+
 /* Obtain connection instance */
 
 QSqlDatabase DatabaseConnection::getQtConnection()
@@ -304,6 +473,7 @@ QSqlDatabase DatabaseConnection::getQtConnection()
 
         // Reconnect if missing
         m_qtConnection = std::invoke(m_qtConnectionResolver);
+        m_qtConnectionHandle = {};
 
         /* This should never happen 🤔, do this check only when the QSqlDatabase
            connection was resolved by connection resolver. */
@@ -314,7 +484,7 @@ QSqlDatabase DatabaseConnection::getQtConnection()
     }
 
     // Return the connection from QSqlDatabase connection manager
-    return QSqlDatabase::database(*m_qtConnection, true);
+    return cachedQtConnection(m_qtConnectionHandle, *m_qtConnection);
 }
 
 QSqlDatabase DatabaseConnection::getRawQtConnection() const
@@ -324,6 +494,10 @@ QSqlDatabase DatabaseConnection::getRawQtConnection() const
                 "Can not obtain a connection from the QSqlDatabase instance because "
                 "the connection has not yet been established.");
 
+    // Don't open the connection, so the closed cached handle is also ok
+    if (m_qtConnectionHandle.thread == QThread::currentThread())
+        return m_qtConnectionHandle.database;
+
     return QSqlDatabase::database(*m_qtConnection);
 }
 
@@ -336,6 +510,10 @@ DatabaseConnection::setQtConnectionResolver(
        reset because it indicates whether the underlying connection is active. */
     resetTransactions();
 
+    // Prepared statements are bound to the old connection
+    m_statementCache->clear();
+    m_readStatementCache->clear();
+
     /* m_qtConnection.reset() is called also in DatabaseConnection::disconnect(),
        because both methods are public apis.
        m_qtConnection can also be understood as m_qtConnectionWasResolved,
@@ -347,11 +525,38 @@ DatabaseConnection::setQtConnectionResolver(
        This ensures, that a database connection will be resolved lazily, only
        when actually needed. */
     m_qtConnection.reset();
+    m_qtConnectionHandle = {};
     m_qtConnectionResolver = resolver;
 
     return *this;
 }
 
+QSqlDatabase DatabaseConnection::getReadQtConnection()
+{
+    if (!shouldUseReadConnection())
+        return getQtConnection();
+
+    return getRawReadQtConnection();
+}
+
+DatabaseConnection &
+DatabaseConnection::setReadQtConnectionResolver(
+        const std::function<Connectors::ConnectionName()> &resolver)
+{
+    // The same logic as in the setQtConnectionResolver()
+    m_readStatementCache->clear();
+
+    m_readQtConnection.reset();
+    m_readQtConnectionHandle = {};
+    m_readQtConnectionResolver = resolver;
+
+    // The new replica has to be measured
+    m_replicaLag.reset();
+    m_replicaLagMeasuredAt.reset();
+
+    return *this;
+}
+
 QSqlQuery DatabaseConnection::getQtQuery()
 {
     return QSqlQuery(getQtConnection());
@@ -444,7 +649,7 @@ void DatabaseConnection::reconnect() const
 void DatabaseConnection::disconnect()
 {
     // Nothing to disconnect
-    if (!m_qtConnection)
+    if (!m_qtConnection && !m_readQtConnection)
         return;
 
     /* Closes the database connection, freeing any resources acquired,
@@ -453,11 +658,69 @@ void DatabaseConnection::disconnect()
        Only close the QSqlDatabase database connection and don't remove it
        from QSqlDatabase connection repository, so it can be reused, it's
        better for performance.
-       Revisited, it's ok and will not cause any leaks or dangling connection. */
-    getRawQtConnection().close();
+       Revisited, it's ok and will not cause any leaks or dangling connection.
+       Cached prepared statements have to be destroyed before the connection
+       is closed. */
+    m_statementCache->clear();
+    m_readStatementCache->clear();
+
+    if (m_qtConnection)
+        getRawQtConnection().close();
 
+    // The read connection of the read/write connection
+    if (m_readQtConnection)
+        QSqlDatabase::database(*m_readQtConnection, false).close();
+
+    /* The cached handles have to be released, the QSqlDatabase::removeDatabase()
+       warns about connections that are still in use. */
     m_qtConnection.reset();
+    m_qtConnectionHandle = {};
     m_qtConnectionResolver = nullptr;
+
+    m_readQtConnection.reset();
+    m_readQtConnectionHandle = {};
+    m_readQtConnectionResolver = nullptr;
+}
+
+void DatabaseConnection::releaseThreadAffinity()
+{
+    /* The QSqlDatabase::database() refuses to return a connection whose driver
+       belongs to another thread, so the driver is pushed out of the current thread
+       and it will be pulled by the acquireThreadAffinity() in the borrowing thread.
+       Only a QObject without the thread affinity can be pulled from another thread.
+       Nothing to detach if the connection wasn't resolved yet, the physical connection
+       will be created lazily in the thread that borrows this connection. The driver
+       is also detached if the connect failed, the QSqlDatabase connection was already
+       added to the connection repository by the current thread. */
+    if (m_detachedDriver == nullptr && QSqlDatabase::contains(m_connectionName)) {
+        m_detachedDriver = QSqlDatabase::database(m_connectionName, false).driver();
+
+        m_detachedDriver->moveToThread(nullptr);
+    }
+
+    // The read connection of the read/write connection
+    if (m_detachedReadDriver != nullptr || !hasReadConnection())
+        return;
+
+    if (const auto readName = Connectors::ConnectionFactory::readConnectionName(
+                                  m_connectionName);
+        QSqlDatabase::contains(readName)
+    ) {
+        m_detachedReadDriver = QSqlDatabase::database(readName, false).driver();
+
+        m_detachedReadDriver->moveToThread(nullptr);
+    }
+}
+
+void DatabaseConnection::acquireThreadAffinity()
+{
+    if (m_detachedDriver != nullptr)
+        std::exchange(m_detachedDriver, nullptr)
+                ->moveToThread(QThread::currentThread());
+
+    if (m_detachedReadDriver != nullptr)
+        std::exchange(m_detachedReadDriver, nullptr)
+                ->moveToThread(QThread::currentThread());
 }
 
 SchemaBuilder &DatabaseConnection::getSchemaBuilder()
@@ -487,6 +750,209 @@ DatabaseConnection::setReconnector(const ReconnectorType &reconnector)
     return *this;
 }
 
+/* Prepared statement cache */
+
+DatabaseConnection &DatabaseConnection::setStatementCacheSize(const std::size_t size)
+{
+    m_statementCache->setCapacity(size);
+    m_readStatementCache->setCapacity(size);
+
+    return *this;
+}
+
+void DatabaseConnection::clearStatementCache()
+{
+    m_statementCache->clear();
+    m_readStatementCache->clear();
+}
+
+std::size_t DatabaseConnection::prepareStatements(const QStringList &queryStrings)
+{
+    // Nothing to do, prepared statements are kept only in the cache
+    if (!m_statementCache->isEnabled() || m_pretending)
+        return 0;
+
+    std::size_t prepared = 0;
+
+    const auto prepare = [&queryStrings, &prepared]
+                         (Support::StatementCache &statementCache,
+                          const QSqlDatabase &connection)
+    {
+        for (const auto &queryString : queryStrings)
+            if (auto query = std::make_unique<QSqlQuery>(connection);
+                query->prepare(queryString)
+            ) {
+                statementCache.checkIn(queryString, std::move(query));
+                ++prepared;
+            }
+    };
+
+    prepare(*m_statementCache, getQtConnection());
+
+    // Select queries are prepared on the read connection of the read/write connection
+    if (shouldUseReadConnection())
+        prepare(*m_readStatementCache, getReadQtConnection());
+
+    return prepared;
+}
+
+StatementCacheStats DatabaseConnection::statementCacheStats() const
+{
+    auto stats = m_statementCache->stats();
+
+    // Nothing to merge
+    if (!hasReadConnection())
+        return stats;
+
+    const auto readStats = m_readStatementCache->stats();
+
+    stats.size      += readStats.size;
+    stats.hits      += readStats.hits;
+    stats.misses    += readStats.misses;
+    stats.evictions += readStats.evictions;
+
+    return stats;
+}
+
+void DatabaseConnection::resetStatementCacheStats() noexcept
+{
+    m_statementCache->resetStats();
+    m_readStatementCache->resetStats();
+}
+
+/* Statement timeout and cancellation */
+
+DatabaseConnection &
+DatabaseConnection::setStatementTimeout(
+        const std::optional<std::chrono::milliseconds> timeout) noexcept
+{
+    // Applied lazily before the next query
+    m_statementTimeout = timeout;
+
+    return *this;
+}
+
+SqlQuery
+DatabaseConnection::withStatementTimeout(const std::chrono::milliseconds timeout,
+                                         const std::function<SqlQuery()> &callback)
+{
+    /* The session timeout is restored lazily before the next query, so it doesn't
+       cost any additional round-trip if the next query uses the same timeout. */
+    const auto previous = std::exchange(m_statementTimeoutOverride, timeout);
+
+    try {
+        auto result = std::invoke(callback);
+
+        m_statementTimeoutOverride = previous;
+
+        return result;
+
+    } catch (...) {
+        m_statementTimeoutOverride = previous;
+
+        throw;
+    }
+}
+
+QueryCancelHandle DatabaseConnection::cancelHandle(const bool useReadConnection)
+{
+    if (m_pretending)
+        return {};
+
+    reconnectIfMissingConnection();
+
+    const auto readConnection = useReadConnection && shouldUseReadConnection() &&
+                                isReplicaLagAcceptable();
+
+    const auto connection = readConnection ? getReadQtConnection() : getQtConnection();
+
+    auto cancelQuery = compileCancelQuery(connection);
+
+    // Not supported by the driver
+    if (cancelQuery.isEmpty())
+        return {};
+
+    /* The handles only reference the password, it's shared by all handles of
+       the connection and re-created if the password has changed. */
+    auto &password = readConnection ? m_readCancelPassword : m_cancelPassword;
+
+    if (!password || *password != connection.password())
+        password = QueryCancelHandle::makePassword(connection);
+
+    return {connection, std::move(cancelQuery), password};
+}
+
+void DatabaseConnection::invalidateStatementTimeout() noexcept
+{
+    m_qtConnectionHandle.statementTimeoutStale = true;
+}
+
+/* Replication lag */
+
+DatabaseConnection &
+DatabaseConnection::setMaxReplicaLag(
+        const std::optional<std::chrono::milliseconds> lag) noexcept
+{
+    m_maxReplicaLag = lag;
+
+    return *this;
+}
+
+SqlQuery
+DatabaseConnection::withMaxStaleness(const std::chrono::milliseconds staleness,
+                                     const std::function<SqlQuery()> &callback)
+{
+    const auto previous = std::exchange(m_maxStalenessOverride, staleness);
+
+    try {
+        auto result = std::invoke(callback);
+
+        m_maxStalenessOverride = previous;
+
+        return result;
+
+    } catch (...) {
+        m_maxStalenessOverride = previous;
+
+        throw;
+    }
+}
+
+std::optional<std::chrono::milliseconds> DatabaseConnection::replicaLag()
+{
+    // Only the read connection of the read/write connection can lag
+    if (m_pretending || !hasReadConnection())
+        return std::chrono::milliseconds::zero();
+
+    const auto now = std::chrono::steady_clock::now();
+
+    // Measured recently, the lag query costs a round-trip to the replica
+    if (m_replicaLagMeasuredAt && now - *m_replicaLagMeasuredAt < m_replicaLagInterval)
+        return m_replicaLag;
+
+    m_replicaLagMeasuredAt = now;
+
+    /* The unreachable replica is treated the same way as the lagging replica, reads
+       are sent to the write connection until the next measurement. */
+    try {
+        m_replicaLag = queryReplicaLag(getRawReadQtConnection());
+
+    } catch (const Exceptions::SqlError &/*unused*/) {
+        m_replicaLag = std::nullopt;
+    }
+
+    return m_replicaLag;
+}
+
+DatabaseConnection &
+DatabaseConnection::setCircuitBreaker(
+        std::shared_ptr<Connectors::CircuitBreaker> circuitBreaker)
+{
+    m_circuitBreaker = std::move(circuitBreaker);
+
+    return *this;
+}
+
 /* Connection configuration */
 
 QVariant DatabaseConnection::getConfig(const QString &option) const
@@ -503,7 +969,17 @@ bool DatabaseConnection::hasConfig(const QString &option) const
 
 QString DatabaseConnection::driverName()
 {
-    return getQtConnection().driverName();
+    auto driverName = getQtConnection().driverName();
+
+    // The native libpq driver is the drop-in replacement for the QPSQL driver
+    if (driverName == QPSQL_LIBPQ)
+        return QPSQL;
+
+    // The same for the native SQLite driver
+    if (driverName == QSQLITE_LIB)
+        return QSQLITE;
+
+    return driverName;
 }
 
 /*! Printable driver name hash type. */
@@ -527,6 +1003,13 @@ const QString &DatabaseConnection::driverNamePrintable()
     return *m_driverNamePrintable;
 }
 
+DatabaseConnection &DatabaseConnection::setPoolName(const QString &name)
+{
+    m_poolName = name;
+
+    return *this;
+}
+
 DatabaseConnection &
 DatabaseConnection::setQtTimeZone(const QVariant &qtTimeZone)
 {
@@ -588,6 +1071,9 @@ DatabaseConnection::pretend(const std::function<void(DatabaseConnection &)> &cal
 void DatabaseConnection::useDefaultQueryGrammar()
 {
     m_queryGrammar = getDefaultQueryGrammar();
+
+    m_queryGrammar->setInArrayThreshold(inArrayThresholdFromConfig(m_config))
+                   .setMaxBindings(maxBindingsFromConfig(m_config));
 }
 
 void DatabaseConnection::useDefaultSchemaGrammar()
@@ -605,21 +1091,540 @@ void DatabaseConnection::useDefaultPostProcessor()
     m_postProcessor = getDefaultPostProcessor();
 }
 
+QString DatabaseConnection::compileStatementTimeout(
+        const std::optional<std::chrono::milliseconds> &/*unused*/)
+{
+    return {};
+}
+
+QString DatabaseConnection::compileCancelQuery(const QSqlDatabase &/*unused*/)
+{
+    return {};
+}
+
+bool DatabaseConnection::supportsMultiStatementBatch()
+{
+    return false;
+}
+
+std::optional<std::chrono::milliseconds>
+DatabaseConnection::queryReplicaLag(const QSqlDatabase &/*unused*/)
+{
+    return std::chrono::milliseconds::zero();
+}
+
+QString DatabaseConnection::inlineBindings(
+        const QString &queryString, const QVector<QVariant> &bindings,
+        const QSqlDriver &driver, const QString &driverName)
+{
+    QString result;
+    result.reserve(queryString.size() + (bindings.size() * 8));
+
+    const auto isMySql = driverName == QMYSQL;
+    const auto isPostgres = driverName == QPSQL;
+
+    QVector<QVariant>::size_type bindingIndex = 0;
+    QChar quote;
+    auto backslashEscapes = false;
+
+    for (QString::size_type index = 0; index < queryString.size(); ++index) {
+        const auto character = queryString[index];
+
+        // Inside the quoted string or identifier
+        if (!quote.isNull()) {
+            result += character;
+
+            // Backslash escape sequence (MySQL strings and PostgreSQL E'' strings)
+            if (backslashEscapes && character == QLatin1Char('\\') &&
+                index + 1 < queryString.size()
+            )
+                result += queryString[++index];
+            else if (character == quote)
+                quote = QChar();
+
+            continue;
+        }
+
+        // Quotes and placeholders inside comments and dollar-quoted strings are skipped
+        if (const auto length = skippedLength(queryString, index, isMySql, isPostgres);
+            length > 0
+        ) {
+            result += queryString.mid(index, length);
+            index += length - 1;
+            continue;
+        }
+
+        if (character == SQUOTE || character == QUOTE ||
+            (isMySql && character == QLatin1Char('`'))
+        ) {
+            quote = character;
+            /* PostgreSQL with the standard_conforming_strings (the default) uses
+               the backslash escapes in the E'' strings only. */
+            backslashEscapes =
+                    isMySql ? character != QLatin1Char('`')
+                            : isPostgres && character == SQUOTE && index > 0 &&
+                              queryString[index - 1].toLower() == QLatin1Char('e') &&
+                              (index == 1 ||
+                               !isIdentifierCharacter(queryString[index - 2]));
+            result += character;
+            continue;
+        }
+
+        if (character != QLatin1Char('?')) {
+            result += character;
+            continue;
+        }
+
+        if (bindingIndex >= bindings.size())
+            throwBindingsMismatch(queryString);
+
+        const auto &binding = bindings.at(bindingIndex++);
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        QSqlField field({}, binding.metaType());
+#else
+        QSqlField field({}, binding.type());
+#endif
+        field.setValue(binding);
+
+        result += driver.formatValue(field);
+    }
+
+    if (bindingIndex != bindings.size())
+        throwBindingsMismatch(queryString);
+
+    return result;
+}
+
+quint64 DatabaseConnection::runDirect(
+        const QString &queryString, const bool affecting,
+        const std::function<quint64()> &callback)
+{
+    reconnectIfMissingConnection();
+
+    if (m_pretending) {
+        logQueryForPretend(queryString, {}, Unprepared);
+        return 0;
+    }
+
+    // Elapsed timer needed
+    const auto countElapsed = shouldCountElapsed();
+
+    QElapsedTimer timer;
+    if (countElapsed)
+        timer.start();
+
+    // Fail fast while the database is unreachable (the circuit is open)
+    Connectors::CircuitBreakerGuard circuitBreaker(m_circuitBreaker.get());
+
+    quint64 affected = 0;
+
+    /* The query is never re-run after a lost connection, the data can't be streamed
+       again. The statement timeout is applied inside the try, so the half-open probe
+       always records its result. */
+    try {
+        applyStatementTimeout(false);
+
+        affected = std::invoke(callback);
+
+    } catch (...) {
+        recordCircuitBreakerFailure(circuitBreaker, std::current_exception());
+
+        throw;
+    }
+
+    circuitBreaker.recordSuccess();
+
+    // Statements counter
+    if (m_countingStatements) {
+        if (affecting)
+            ++m_statementsCounter.affecting;
+        else
+            ++m_statementsCounter.normal;
+    }
+
+    if (affecting)
+        recordsHaveBeenModified(affected > 0);
+
+    std::optional<qint64> elapsed;
+    if (countElapsed) {
+        // Hit elapsed timer
+        elapsed = timer.elapsed();
+
+        // Queries execution time counter
+        m_elapsedCounter += *elapsed;
+    }
+
+    logDirectQuery(queryString, {}, elapsed, static_cast<int>(affected));
+
+    return affected;
+}
+
 /* private */
 
-QSqlQuery DatabaseConnection::prepareQuery(const QString &queryString)
+QSqlDatabase
+DatabaseConnection::cachedQtConnection(QtConnectionHandle &handle,
+                                       const Connectors::ConnectionName &connection)
+{
+    auto *const currentThread = QThread::currentThread();
+
+    /* Hot path, the QSqlDatabase::database() locks the process-wide connection
+       repository and looks up the connection by its name for every query. The handle
+       is revalidated after it was handed over to another thread (ConnectionPool) or
+       after the connection was closed, reconnects reset the handle. */
+    if (handle.thread == currentThread && handle.database.isOpen())
+        return handle.database;
+
+    handle.database = QSqlDatabase::database(connection, true);
+    handle.thread = currentThread;
+
+    return handle.database;
+}
+
+SqlQuery
+DatabaseConnection::selectInternal(
+        const QString &queryString, QVector<QVariant> &&bindings,
+        const bool useReadConnection, const bool forwardOnly)
+{
+    // Returns the cached prepared statement after the SqlQuery is destroyed
+    Support::StatementCache::CheckInType checkIn;
+
+    auto queryResult = run<QSqlQuery>(
+                           queryString, std::move(bindings), Prepared,
+                           [this, useReadConnection, forwardOnly, &checkIn]
+                           (const QString &queryString_,
+                            const QVector<QVariant> &preparedBindings)
+                           -> QSqlQuery
+    {
+        if (m_pretending)
+            return getQtQueryForPretend();
+
+        // Prepare QSqlQuery
+        auto query = prepareQuery(queryString_, useReadConnection, forwardOnly,
+                                  &checkIn);
+
+        bindValues(query, preparedBindings);
+
+        if (query.exec()) {
+            // Query statements counter
+            if (m_countingStatements)
+                ++m_statementsCounter.normal;
+
+            return query;
+        }
+
+        /* If an error occurs when attempting to run a query, we'll transform it
+           to the exception QueryError(), which formats the error message to
+           include the bindings with SQL, which will make this exception a lot
+           more helpful to the developer instead of just the database's errors. */
+        // Don't reuse the failed prepared statement (eg. invalidated cached plan)
+        forgetPreparedStatement(queryString_);
+
+        throw Exceptions::QueryError(
+                    m_connectionName,
+                    "Select statement in DatabaseConnection::select() failed.",
+                    query, preparedBindings);
+    });
+
+    return {std::move(queryResult), m_qtTimeZone, *m_queryGrammar, m_returnQDateTime,
+            std::move(checkIn)};
+}
+
+QVector<int>
+DatabaseConnection::runMultiStatementBatch(const QVector<BatchStatement> &statements)
 {
+    reconnectIfMissingConnection();
+
+    // Elapsed timer needed
+    const auto countElapsed = shouldCountElapsed();
+
+    QElapsedTimer timer;
+    if (countElapsed)
+        timer.start();
+
+    /* Multi-statement queries can't be prepared, the bindings are formatted and escaped
+       by the driver and all statements are sent in one unprepared query. */
+    QVector<QVector<QVariant>> preparedBindings;
+    preparedBindings.reserve(statements.size());
+
+    // Every statement has its own result, they are read one by one
+    QVector<int> affected;
+    affected.reserve(statements.size());
+
+    // Fail fast while the database is unreachable (the circuit is open)
+    Connectors::CircuitBreakerGuard circuitBreaker(m_circuitBreaker.get());
+
+    /* The batch is never re-run after a lost connection, some statements may be
+       already executed. */
+    try {
+        applyStatementTimeout(false);
+
+        auto query = getQtQuery();
+        const auto &driver = *query.driver();
+        const auto driverName_ = driverName();
+
+        QStringList queries;
+        queries.reserve(statements.size());
+
+        for (const auto &[queryString, bindings] : statements) {
+            auto bindings_ = bindings;
+            preparedBindings << std::move(prepareBindings(bindings_));
+
+            queries << inlineBindings(queryString, preparedBindings.constLast(),
+                                      driver, driverName_);
+        }
+
+        if (query.exec(queries.join(QStringLiteral("; ")))) {
+            affected << query.numRowsAffected();
+
+            while (affected.size() < statements.size() && query.nextResult())
+                affected << query.numRowsAffected();
+        }
+
+        if (affected.size() != statements.size()) {
+            Exceptions::QueryError e(m_connectionName,
+                                     "Batch in DatabaseConnection::batch() failed.",
+                                     query);
+
+            throwIfQueryCanceled(e);
+
+            throw e;
+        }
+
+    } catch (...) {
+        recordCircuitBreakerFailure(circuitBreaker, std::current_exception());
+
+        throw;
+    }
+
+    circuitBreaker.recordSuccess();
+
+    // Affecting statements counter
+    if (m_countingStatements)
+        m_statementsCounter.affecting += static_cast<int>(statements.size());
+
+    recordsHaveBeenModified(std::ranges::any_of(affected, [](const int numRowsAffected)
+    {
+        return numRowsAffected > 0;
+    }));
+
+    std::optional<qint64> elapsed;
+    if (countElapsed) {
+        // Hit elapsed timer
+        elapsed = timer.elapsed();
+
+        // Queries execution time counter
+        m_elapsedCounter += *elapsed;
+    }
+
+    // Log every statement separately, the elapsed time is the time of the whole batch
+    for (QVector<BatchStatement>::size_type index = 0; index < statements.size();
+         ++index
+    )
+        logDirectQuery(statements.at(index).query, preparedBindings.at(index), elapsed,
+                      affected.at(index));
+
+    return affected;
+}
+
+QSqlQuery DatabaseConnection::prepareQuery(
+        const QString &queryString, const bool useReadConnection,
+        const bool forwardOnly, Support::StatementCache::CheckInType *const checkIn)
+{
+    /* The replication lag is checked only here, so one query uses the same connection
+       from the prepare to the execution. */
+    const auto readConnection = useReadConnection && shouldUseReadConnection() &&
+                                isReplicaLagAcceptable();
+
+    // Every physical connection has its own session
+    applyStatementTimeout(readConnection);
+
+    // Every QSqlDatabase connection has its own prepared statements
+    auto &statementCache = readConnection ? m_readStatementCache : m_statementCache;
+
+    /* Only the callers returning the SqlQuery use the cache, the SqlQuery checks in
+       the statement when its result isn't used anymore. */
+    const auto useCache = checkIn != nullptr && statementCache->isEnabled();
+
+    // The previous attempt could set it (reconnect after the lost connection)
+    if (checkIn != nullptr)
+        *checkIn = nullptr;
+
+    // Reuse the idle prepared statement, it's checked out until it's checked in again
+    if (useCache)
+        if (auto cachedQuery = statementCache->checkOut(queryString); cachedQuery) {
+            // Scrollable and forward-only queries can share the cached statement
+            cachedQuery->setForwardOnly(forwardOnly);
+
+            *checkIn = statementCache->checkInHandler(queryString);
+
+            return std::move(*cachedQuery);
+        }
+
     // Prepare query string
-    auto query = getQtQuery();
+    auto query = readConnection ? QSqlQuery(getReadQtConnection()) : getQtQuery();
 
-    // TODO solve setForwardOnly() in DatabaseConnection class, again this problem 🤔 silverqx
-//    query.setForwardOnly(m_forwardOnly);
+    /* Forward-only queries don't buffer the whole result set (if supported by
+       the driver), it must be set before the exec(). */
+    query.setForwardOnly(forwardOnly);
 
-    query.prepare(queryString);
+    // The prepare error will be reported by the exec() in the caller
+    if (query.prepare(queryString) && useCache)
+        *checkIn = statementCache->checkInHandler(queryString);
 
     return query;
 }
 
+void DatabaseConnection::forgetPreparedStatement(const QString &queryString)
+{
+    m_statementCache->remove(queryString);
+    m_readStatementCache->remove(queryString);
+}
+
+bool DatabaseConnection::shouldUseReadConnection() const
+{
+    // Not a read/write connection
+    if (!hasReadConnection())
+        return false;
+
+    // The transaction must see its own changes and it also can lock rows
+    if (inTransaction())
+        return false;
+
+    /* If the sticky option is enabled and a record has been modified (written) during
+       the current unit of work, then the write connection will be used for reads,
+       so the application can immediately read records it has just written. */
+    return !(m_sticky && m_recordsModified);
+}
+
+QSqlDatabase DatabaseConnection::getRawReadQtConnection()
+{
+    if (!m_readQtConnection) {
+        // Reconnect if missing
+        m_readQtConnection = std::invoke(m_readQtConnectionResolver);
+        m_readQtConnectionHandle = {};
+
+        // This should never happen 🤔
+        if (!QSqlDatabase::contains(*m_readQtConnection))
+            throw Exceptions::RuntimeError(
+                    QStringLiteral("QSqlDatabase does not contain '%1' connection.")
+                    .arg(*m_readQtConnection));
+    }
+
+    // Return the connection from QSqlDatabase connection manager
+    return cachedQtConnection(m_readQtConnectionHandle, *m_readQtConnection);
+}
+
+bool DatabaseConnection::isReplicaLagAcceptable()
+{
+    const auto &maxLag = m_maxStalenessOverride ? m_maxStalenessOverride
+                                                : m_maxReplicaLag;
+
+    // Hot path, the replication lag isn't bounded
+    if (!maxLag)
+        return true;
+
+    // The unknown lag is never acceptable, the write connection is always up to date
+    const auto lag = replicaLag();
+
+    return lag && *lag <= *maxLag;
+}
+
+void DatabaseConnection::applyStatementTimeout(const bool readConnection)
+{
+    const auto &timeout = m_statementTimeoutOverride ? m_statementTimeoutOverride
+                                                     : m_statementTimeout;
+
+    // Hot path, the timeout isn't used at all
+    if (const auto &handle = readConnection ? m_readQtConnectionHandle
+                                            : m_qtConnectionHandle;
+        !timeout && !handle.statementTimeout && !handle.statementTimeoutStale
+    )
+        return;
+
+    // The handle is reset if the connection was re-created
+    const auto connection = readConnection ? getReadQtConnection() : getQtConnection();
+
+    auto &handle = readConnection ? m_readQtConnectionHandle : m_qtConnectionHandle;
+
+    if (!handle.statementTimeoutStale && handle.statementTimeout == timeout)
+        return;
+
+    /* Set it before compiling because the compileStatementTimeout() can execute
+       a query (eg. MySqlConnection::isMaria()), so it would recurse. */
+    const auto previous = std::exchange(handle.statementTimeout, timeout);
+    const auto previousStale = std::exchange(handle.statementTimeoutStale, false);
+
+    const auto sql = compileStatementTimeout(timeout);
+
+    // Not supported by the driver
+    if (sql.isEmpty())
+        return;
+
+    QSqlQuery query(connection);
+
+    if (query.exec(sql))
+        return;
+
+    handle.statementTimeout = previous;
+    handle.statementTimeoutStale = previousStale;
+
+    throw Exceptions::QueryError(
+                m_connectionName,
+                "Setting the statement timeout in "
+                "DatabaseConnection::applyStatementTimeout() failed.",
+                query);
+}
+
+void DatabaseConnection::throwIfQueryCanceled(const Exceptions::QueryError &e)
+{
+    const auto &sqlError = e.getSqlError();
+    const auto code = sqlError.nativeErrorCode();
+
+    /* PostgreSQL uses the same query_canceled SQLSTATE for the statement_timeout
+       and for the pg_cancel_backend(). */
+    if (code == QStringLiteral("57014")) {
+        if (sqlError.databaseText().contains(QStringLiteral("statement timeout")))
+            throw Exceptions::QueryTimeoutError(e);
+
+        throw Exceptions::QueryCanceledError(e);
+    }
+
+    // MySQL ER_QUERY_TIMEOUT and MariaDB ER_STATEMENT_TIMEOUT
+    if (code == QStringLiteral("3024") || code == QStringLiteral("1969"))
+        throw Exceptions::QueryTimeoutError(e);
+
+    // MySQL ER_QUERY_INTERRUPTED (KILL QUERY)
+    if (code == QStringLiteral("1317"))
+        throw Exceptions::QueryCanceledError(e);
+}
+
+void DatabaseConnection::recordCircuitBreakerFailure(
+        Connectors::CircuitBreakerGuard &circuitBreaker,
+        const std::exception_ptr &ePtr) const
+{
+    try {
+        std::rethrow_exception(ePtr);
+
+    } catch (const Exceptions::SqlError &e) {
+        // Failed connect or lost connection
+        if (e.getSqlError().type() == QSqlError::ConnectionError ||
+            causedByLostConnection(e)
+        )
+            return circuitBreaker.recordFailure();
+
+        // The database has responded (eg. syntax error)
+        circuitBreaker.recordSuccess();
+
+    } catch (const Exceptions::LostConnectionError &/*unused*/) {
+        circuitBreaker.recordFailure();
+
+    } catch (...) {
+        // Not caused by the database, counted as a success so the probe can finish
+        circuitBreaker.recordSuccess();
+    }
+}
+
 QDateTime DatabaseConnection::prepareBinding(const QDateTime &binding) const
 {
     /* Nothing to convert, the qt_timezone config. option is not valid or was not defined
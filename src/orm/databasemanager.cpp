@@ -1,13 +1,22 @@
 #include "orm/databasemanager.hpp"
 
+#include <QElapsedTimer>
+#include <QThreadPool>
+
 #include <range/v3/view/map.hpp>
 
 #include "orm/concerns/hasconnectionresolver.hpp"
+#include "orm/constants.hpp"
 #include "orm/connectors/connectionfactory.hpp"
 #include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/support/scattergather.hpp"
+#include "orm/utils/query.hpp"
+#include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
+using Orm::Constants::warm_up_statements;
+
 namespace Orm
 {
 
@@ -140,6 +149,13 @@ DatabaseManager::selectFromWriteConnection(
                 .selectFromWriteConnection(query, std::move(bindings));
 }
 
+SqlQuery
+DatabaseManager::cursor(const QString &query, QVector<QVariant> bindings,
+                        const QString &connection)
+{
+    return this->connection(connection).cursor(query, std::move(bindings));
+}
+
 SqlQuery
 DatabaseManager::selectOne(const QString &query, QVector<QVariant> bindings,
                            const QString &connection)
@@ -195,6 +211,19 @@ SqlQuery DatabaseManager::unprepared(const QString &query,
     return this->connection(connection).unprepared(query);
 }
 
+QVector<int> DatabaseManager::batch(const QVector<BatchStatement> &statements,
+                                    const QString &connection)
+{
+    return this->connection(connection).batch(statements);
+}
+
+void DatabaseManager::transaction(
+        const std::function<void(DatabaseConnection &)> &callback, const int attempts,
+        const std::chrono::milliseconds backoff, const QString &connection)
+{
+    this->connection(connection).transaction(callback, attempts, backoff);
+}
+
 bool DatabaseManager::beginTransaction(const QString &connection)
 {
     return this->connection(connection).beginTransaction();
@@ -338,6 +367,12 @@ bool DatabaseManager::removeConnection(const QString &name)
             resetDefaultConnection();
     };
 
+    // The connection pool is independent of the thread-affine connections
+    removeConnectionPool(name_);
+
+    // The re-added connection with the same name starts with the closed circuit
+    Connectors::CircuitBreaker::remove(name_);
+
     // Not connected
     if (!m_connections->contains(name_)) {
         m_configuration->erase(name_);
@@ -358,6 +393,12 @@ bool DatabaseManager::removeConnection(const QString &name)
     // Remove Qt's database connection, ~QSqlDatabase() internally also calls close()
     QSqlDatabase::removeDatabase(name_);
 
+    // Also the read connection of the read/write connection
+    if (const auto readName = Connectors::ConnectionFactory::readConnectionName(name_);
+        QSqlDatabase::contains(readName)
+    )
+        QSqlDatabase::removeDatabase(readName);
+
     resetDefaultConnection_();
 
     return true;
@@ -395,6 +436,340 @@ void DatabaseManager::connectEagerly(const QString &name)
     connection(name).connectEagerly();
 }
 
+QVector<WarmUpResult>
+DatabaseManager::warmUp(const QStringList &connections, const int threads)
+{
+    /* The same connection can't be handed over to two threads, the empty name is
+       the default connection. */
+    const auto connections_ = connections.isEmpty() ? connectionNames() : connections;
+
+    QStringList names;
+    names.reserve(connections_.size());
+
+    for (const auto &name : connections_)
+        names << parseConnectionName(name);
+
+    names.removeDuplicates();
+
+    const auto size = static_cast<std::size_t>(names.size());
+
+    /* Connections and configurations are thread_local, so the connections have to be
+       obtained in the current thread. Connections are handed over to the workers
+       the same way as the ConnectionPool does it, the driver of the already opened
+       connection is pushed out of the current thread and pulled back at the end. */
+    std::vector<DatabaseConnection *> databaseConnections;
+    databaseConnections.reserve(size);
+
+    /* Obtain all connections first, an unknown connection name throws before any
+       connection was handed over, so no connection stays without a thread. */
+    for (const auto &name : names)
+        databaseConnections.push_back(std::addressof(connection(name)));
+
+    for (auto *const databaseConnection : databaseConnections)
+        databaseConnection->releaseThreadAffinity();
+
+    // Every worker writes only to its own element
+    std::vector<WarmUpResult> results(size);
+
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(
+                threads > 0 ? threads
+                            : static_cast<int>(std::max<QStringList::size_type>(
+                                                   names.size(), 1)));
+
+    for (std::size_t index = 0; index < size; ++index)
+        threadPool.start([&databaseConnections, &results, &names, index]
+        {
+            auto &connection = *databaseConnections[index];
+            auto &result = results[index];
+
+            result.connection = names.at(static_cast<QStringList::size_type>(index));
+
+            QElapsedTimer timer;
+            timer.start();
+
+            connection.acquireThreadAffinity();
+
+            try {
+                connection.connectEagerly();
+                result.connected = true;
+
+                result.preparedStatements = connection.prepareStatements(
+                                                connection.getConfig(warm_up_statements)
+                                                .value<QStringList>());
+
+            } catch (const std::exception &e) {
+                result.error = QString::fromUtf8(e.what());
+            }
+
+            result.elapsed = timer.elapsed();
+
+            // Hand the connection over back to the thread that called the warmUp()
+            connection.releaseThreadAffinity();
+        });
+
+    threadPool.waitForDone();
+
+    QVector<WarmUpResult> warmedUp;
+    warmedUp.reserve(static_cast<QVector<WarmUpResult>::size_type>(size));
+
+    for (std::size_t index = 0; index < size; ++index) {
+        databaseConnections[index]->acquireThreadAffinity();
+
+        warmedUp << std::move(results[index]);
+    }
+
+    return warmedUp;
+}
+
+/* Connection pools */
+
+Support::ConnectionPool &DatabaseManager::connectionPool(const QString &name)
+{
+    return *connectionPoolShared(name);
+}
+
+std::shared_ptr<Support::ConnectionPool>
+DatabaseManager::connectionPoolShared(const QString &name)
+{
+    const auto &name_ = parseConnectionName(name);
+
+    std::scoped_lock lock(m_connectionPoolsMutex);
+
+    if (const auto it = m_connectionPools.find(name_);
+        it != m_connectionPools.end()
+    )
+        return it->second;
+
+    /* Configurations are thread_local, so the pool has to be created from the thread
+       where the connection was registered, after that it's available from all threads
+       because the pool holds its own copy of the configuration. */
+    auto pool = std::make_shared<Support::ConnectionPool>(name_, configuration(name_));
+
+    return m_connectionPools.emplace(name_, std::move(pool)).first->second;
+}
+
+Support::ConnectionPool &DatabaseManager::readerPool(const QString &name)
+{
+    return *readerPoolShared(name);
+}
+
+std::shared_ptr<Support::ConnectionPool>
+DatabaseManager::readerPoolShared(const QString &name)
+{
+    const auto &name_ = parseConnectionName(name);
+
+    std::scoped_lock lock(m_connectionPoolsMutex);
+
+    if (const auto it = m_readerPools.find(name_);
+        it != m_readerPools.end()
+    )
+        return it->second;
+
+    // The same as for the connection pool, the configuration is thread_local
+    const auto &config = configuration(name_);
+
+    std::shared_ptr<Support::ConnectionPool> pool;
+
+    if (Support::ConnectionPool::hasReaderPool(config))
+        pool = std::make_shared<Support::ConnectionPool>(name_, config, true);
+
+    // Reads without the wal_readers are served by the connection pool
+    else {
+        auto &connectionPool = m_connectionPools[name_];
+
+        if (!connectionPool)
+            connectionPool = std::make_shared<Support::ConnectionPool>(name_, config);
+
+        pool = connectionPool;
+    }
+
+    return m_readerPools.emplace(name_, std::move(pool)).first->second;
+}
+
+bool DatabaseManager::hasConnectionPool(const QString &name) const
+{
+    std::scoped_lock lock(m_connectionPoolsMutex);
+
+    return m_connectionPools.contains(parseConnectionName(name));
+}
+
+Support::PooledConnection DatabaseManager::acquire(const QString &name)
+{
+    // The pool can be removed by another thread meanwhile
+    return connectionPoolShared(name)->acquire();
+}
+
+Support::PooledConnection
+DatabaseManager::acquire(const std::chrono::milliseconds timeout, const QString &name)
+{
+    return connectionPoolShared(name)->acquire(timeout);
+}
+
+ConnectionPoolStats DatabaseManager::connectionPoolStats(const QString &name) const
+{
+    const auto &name_ = parseConnectionName(name);
+
+    std::scoped_lock lock(m_connectionPoolsMutex);
+
+    if (const auto it = m_connectionPools.find(name_);
+        it != m_connectionPools.end()
+    )
+        return it->second->stats();
+
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The connection pool for the '%1' connection doesn't "
+                               "exist in %2().")
+                .arg(name_, __tiny_func__));
+}
+
+/* Keepalive */
+
+void DatabaseManager::startKeepAlive(const std::chrono::milliseconds interval)
+{
+    if (interval.count() <= 0)
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The keepalive interval must be greater than zero "
+                               "in %1().")
+                .arg(__tiny_func__));
+
+    std::scoped_lock lock(m_keepAliveMutex);
+
+    // Restart with the new interval, the old thread is joined first
+    m_keepAlive.reset();
+
+    m_keepAlive = std::make_unique<Support::KeepAliveScheduler>(
+                      interval, [this] { maintainConnectionPools(); });
+}
+
+void DatabaseManager::stopKeepAlive()
+{
+    std::scoped_lock lock(m_keepAliveMutex);
+
+    m_keepAlive.reset();
+}
+
+bool DatabaseManager::isKeepAliveRunning() const
+{
+    std::scoped_lock lock(m_keepAliveMutex);
+
+    return static_cast<bool>(m_keepAlive);
+}
+
+void DatabaseManager::maintainConnectionPools()
+{
+    /* Copy the pools under the lock and maintain them without it, so the slow pings
+       and reconnects don't block the connectionPool() and removeConnection() calls,
+       the shared ownership keeps a meanwhile removed pool alive. */
+    std::vector<std::shared_ptr<Support::ConnectionPool>> pools;
+    {
+        std::scoped_lock lock(m_connectionPoolsMutex);
+
+        pools.reserve(m_connectionPools.size() + m_readerPools.size());
+
+        for (const auto &pool : m_connectionPools | ranges::views::values)
+            pools.push_back(pool);
+
+        // Others are the connection pools that are already in the list
+        for (const auto &pool : m_readerPools | ranges::views::values)
+            if (pool->isReaderPool())
+                pools.push_back(pool);
+    }
+
+    for (const auto &pool : pools)
+        pool->maintain();
+}
+
+/* Circuit breaker */
+
+std::optional<Connectors::CircuitBreakerStats>
+DatabaseManager::circuitBreakerStats(const QString &name) const
+{
+    return Connectors::CircuitBreaker::stats(parseConnectionName(name));
+}
+
+/* Scatter/gather */
+
+QVector<QSqlRecord>
+DatabaseManager::parallel(const QStringList &connections, const QString &query,
+                          const QVector<QVariant> &bindings)
+{
+    return Support::ScatterGather::concat(
+                Support::ScatterGather::select(*this, connections, query, bindings));
+}
+
+#ifdef T_COROUTINES
+/* Async queries */
+
+AsyncQuery<QVector<QSqlRecord>>
+DatabaseManager::selectAsync(const QString &query, QVector<QVariant> bindings,
+                             const QString &connection)
+{
+    // Served by the read-only wal_readers connections if configured
+    return runAsync<QVector<QSqlRecord>>(
+                readerPoolShared(connection),
+                [query, bindings = std::move(bindings)]
+                (DatabaseConnection &connection_)
+    {
+        auto result = connection_.select(query, bindings);
+
+        return Utils::Query::fetchRecords(result);
+    });
+}
+
+AsyncQuery<QVector<QSqlRecord>>
+DatabaseManager::selectFromWriteConnectionAsync(
+        const QString &query, QVector<QVariant> bindings,
+        const QString &connection)
+{
+    return runAsync<QVector<QSqlRecord>>(
+                connectionPoolShared(connection),
+                [query, bindings = std::move(bindings)]
+                (DatabaseConnection &connection_)
+    {
+        auto result = connection_.selectFromWriteConnection(query, bindings);
+
+        return Utils::Query::fetchRecords(result);
+    });
+}
+
+AsyncQuery<QVariant>
+DatabaseManager::scalarAsync(const QString &query, QVector<QVariant> bindings,
+                             const QString &connection)
+{
+    return runAsync<QVariant>(readerPoolShared(connection),
+                              [query, bindings = std::move(bindings)]
+                              (DatabaseConnection &connection_)
+    {
+        return connection_.scalar(query, bindings);
+    });
+}
+
+AsyncQuery<void>
+DatabaseManager::statementAsync(const QString &query, QVector<QVariant> bindings,
+                                const QString &connection)
+{
+    return runAsync<void>(connectionPoolShared(connection),
+                          [query, bindings = std::move(bindings)]
+                          (DatabaseConnection &connection_)
+    {
+        connection_.statement(query, bindings);
+    });
+}
+
+AsyncQuery<int>
+DatabaseManager::affectingStatementAsync(
+        const QString &query, QVector<QVariant> bindings, const QString &connection)
+{
+    return runAsync<int>(connectionPoolShared(connection),
+                         [query, bindings = std::move(bindings)]
+                         (DatabaseConnection &connection_)
+    {
+        return std::get<0>(connection_.affectingStatement(query, bindings));
+    });
+}
+#endif
+
 QStringList DatabaseManager::connectionNames() const
 {
     return *m_configuration | ranges::views::keys | ranges::to<QStringList>();
@@ -842,6 +1217,7 @@ StatementsCounter DatabaseManager::getStatementCounters(const QStringList &conne
             counter.normal        += counter_.normal;
             counter.affecting     += counter_.affecting;
             counter.transactional += counter_.transactional;
+            counter.retried       += counter_.retried;
         }
     }
 
@@ -864,6 +1240,7 @@ StatementsCounter DatabaseManager::takeStatementCounters(const QStringList &conn
             counter.normal        += counter_.normal;
             counter.affecting     += counter_.affecting;
             counter.transactional += counter_.transactional;
+            counter.retried       += counter_.retried;
         }
     }
 
@@ -934,9 +1311,56 @@ DatabaseManager::configure(std::shared_ptr<DatabaseConnection> &&connection) con
        the connection, which will allow us to reconnect from OUR connections. */
     connection->setReconnector(m_reconnector);
 
+    // Shared by the connections with the same name in all threads
+    connection->setCircuitBreaker(
+                Connectors::CircuitBreaker::forConnection(connection->getName(),
+                                                          connection->getConfig()));
+
     return std::move(connection);
 }
 
+void DatabaseManager::removeConnectionPool(const QString &name)
+{
+    std::scoped_lock lock(m_connectionPoolsMutex);
+
+    const auto it = m_connectionPools.find(name);
+    const auto readerIt = m_readerPools.find(name);
+
+    /* Throws if any connection is borrowed, the pools stay registered in this case.
+       They are disconnected under the lock, so a new connection can't be acquired
+       through the DatabaseManager meanwhile. */
+    if (it != m_connectionPools.end())
+        it->second->disconnect();
+
+    if (readerIt != m_readerPools.end() && readerIt->second->isReaderPool())
+        readerIt->second->disconnect();
+
+    if (it != m_connectionPools.end())
+        m_connectionPools.erase(it);
+
+    if (readerIt != m_readerPools.end())
+        m_readerPools.erase(readerIt);
+}
+
+#ifdef T_COROUTINES
+template<typename T>
+AsyncQuery<T>
+DatabaseManager::runAsync(std::shared_ptr<Support::ConnectionPool> &&pool,
+                          std::function<T(DatabaseConnection &)> &&callback)
+{
+    /* Configurations are thread_local, so the pool has to be obtained in the awaiting
+       thread by the caller, the pool itself is thread-safe. */
+    return AsyncQuery<T>([pool = std::move(pool),
+                          callback = std::move(callback)]() -> T
+    {
+        // Returned back to the pool at the end of the scope
+        auto pooled = pool->acquire();
+
+        return std::invoke(callback, *pooled);
+    });
+}
+#endif
+
 DatabaseConnection &
 DatabaseManager::refreshQtConnection(const QString &connection)
 {
@@ -947,8 +1371,12 @@ DatabaseManager::refreshQtConnection(const QString &connection)
        will be again resolved/connected lazily. */
     auto fresh = configure(makeConnection(connectionName));
 
-    return (*m_connections)[connectionName]->setQtConnectionResolver(
-                fresh->getQtConnectionResolver());
+    auto &connection = *(*m_connections)[connectionName];
+
+    // The read connection resolver is empty if it's not a read/write connection
+    connection.setReadQtConnectionResolver(fresh->getReadQtConnectionResolver());
+
+    return connection.setQtConnectionResolver(fresh->getQtConnectionResolver());
 }
 
 void DatabaseManager::checkInstance()
@@ -964,5 +1392,4 @@ void DatabaseManager::checkInstance()
 
 TINYORM_END_COMMON_NAMESPACE
 
-// FUTURE add support for ::read and ::write db connections silverx
 // TODO implement RepositoryFactory silverqx
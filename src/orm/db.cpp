@@ -73,6 +73,13 @@ DB::selectFromWriteConnection(const QString &query, QVector<QVariant> bindings,
                     .selectFromWriteConnection(query, std::move(bindings));
 }
 
+SqlQuery
+DB::cursor(const QString &query, QVector<QVariant> bindings,
+           const QString &connection)
+{
+    return manager().connection(connection).cursor(query, std::move(bindings));
+}
+
 SqlQuery
 DB::selectOne(const QString &query, QVector<QVariant> bindings,
               const QString &connection)
@@ -129,6 +136,19 @@ SqlQuery DB::unprepared(const QString &query,
     return manager().connection(connection).unprepared(query);
 }
 
+QVector<int> DB::batch(const QVector<BatchStatement> &statements,
+                       const QString &connection)
+{
+    return manager().batch(statements, connection);
+}
+
+void DB::transaction(const std::function<void(DatabaseConnection &)> &callback,
+                     const int attempts, const std::chrono::milliseconds backoff,
+                     const QString &connection)
+{
+    manager().connection(connection).transaction(callback, attempts, backoff);
+}
+
 // NOTE api different silverqx
 bool DB::beginTransaction(const QString &connection)
 {
@@ -240,6 +260,123 @@ void DB::connectEagerly(const QString &name)
     manager().connectEagerly(name);
 }
 
+QVector<WarmUpResult> DB::warmUp(const QStringList &connections, const int threads)
+{
+    return manager().warmUp(connections, threads);
+}
+
+/* Connection pools */
+
+Support::ConnectionPool &DB::connectionPool(const QString &name)
+{
+    return manager().connectionPool(name);
+}
+
+Support::ConnectionPool &DB::readerPool(const QString &name)
+{
+    return manager().readerPool(name);
+}
+
+bool DB::hasConnectionPool(const QString &name)
+{
+    return manager().hasConnectionPool(name);
+}
+
+Support::PooledConnection DB::acquire(const QString &name)
+{
+    return manager().acquire(name);
+}
+
+Support::PooledConnection
+DB::acquire(const std::chrono::milliseconds timeout, const QString &name)
+{
+    return manager().acquire(timeout, name);
+}
+
+ConnectionPoolStats DB::connectionPoolStats(const QString &name)
+{
+    return manager().connectionPoolStats(name);
+}
+
+/* Keepalive */
+
+void DB::startKeepAlive(const std::chrono::milliseconds interval)
+{
+    manager().startKeepAlive(interval);
+}
+
+void DB::stopKeepAlive()
+{
+    manager().stopKeepAlive();
+}
+
+bool DB::isKeepAliveRunning()
+{
+    return manager().isKeepAliveRunning();
+}
+
+void DB::maintainConnectionPools()
+{
+    manager().maintainConnectionPools();
+}
+
+/* Circuit breaker */
+
+std::optional<Connectors::CircuitBreakerStats>
+DB::circuitBreakerStats(const QString &name)
+{
+    return manager().circuitBreakerStats(name);
+}
+
+/* Scatter/gather */
+
+QVector<QSqlRecord>
+DB::parallel(const QStringList &connections, const QString &query,
+             const QVector<QVariant> &bindings)
+{
+    return manager().parallel(connections, query, bindings);
+}
+
+#ifdef T_COROUTINES
+/* Async queries */
+
+AsyncQuery<QVector<QSqlRecord>>
+DB::selectAsync(const QString &query, QVector<QVariant> bindings,
+                const QString &connection)
+{
+    return manager().selectAsync(query, std::move(bindings), connection);
+}
+
+AsyncQuery<QVector<QSqlRecord>>
+DB::selectFromWriteConnectionAsync(const QString &query, QVector<QVariant> bindings,
+                                   const QString &connection)
+{
+    return manager().selectFromWriteConnectionAsync(query, std::move(bindings),
+                                                    connection);
+}
+
+AsyncQuery<QVariant>
+DB::scalarAsync(const QString &query, QVector<QVariant> bindings,
+                const QString &connection)
+{
+    return manager().scalarAsync(query, std::move(bindings), connection);
+}
+
+AsyncQuery<void>
+DB::statementAsync(const QString &query, QVector<QVariant> bindings,
+                   const QString &connection)
+{
+    return manager().statementAsync(query, std::move(bindings), connection);
+}
+
+AsyncQuery<int>
+DB::affectingStatementAsync(const QString &query, QVector<QVariant> bindings,
+                            const QString &connection)
+{
+    return manager().affectingStatementAsync(query, std::move(bindings), connection);
+}
+#endif
+
 QStringList DB::connectionNames()
 {
     return manager().connectionNames();
@@ -0,0 +1,1321 @@
+#include "orm/drivers/libpqdriver.hpp"
+
+#ifdef TINYORM_LIBPQ_DRIVER
+#include <QDateTime>
+#include <QUuid>
+#include <QtEndian>
+#include <QtSql/QSqlDatabase>
+#include <QtSql/QSqlError>
+#include <QtSql/QSqlField>
+#include <QtSql/QSqlRecord>
+#include <QtSql/QSqlResult>
+
+#include <bit>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <mutex>
+
+#include <libpq-fe.h>
+
+#include "orm/constants.hpp"
+#include "orm/utils/helpers.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using Orm::Constants::DOT;
+using Orm::Constants::QPSQL_LIBPQ;
+using Orm::Constants::QUOTE;
+using Orm::Constants::SQUOTE;
+using Orm::Constants::TMPL_SQUOTES;
+
+using Orm::Utils::Helpers;
+
+namespace Orm::Drivers
+{
+
+/*!
+    \class LibPqDriver
+    \brief The LibPqDriver class is the native PostgreSQL driver using the libpq.
+
+    \ingroup database
+    \inmodule Export
+
+    The QPSQL driver reads all results in the text format and parses every number
+    and timestamp from the string. Prepared statements executed by this driver are
+    described once after the prepare and if all result columns have a known binary
+    representation (integers, floats, timestamps, bytea, text, ...), the results
+    are transferred in the binary format. Forward-only queries are streamed
+    in the libpq's single-row mode and unprepared multi-statement queries return
+    all their results in one round trip (QSqlQuery::nextResult()).
+*/
+
+namespace
+{
+    /* PostgreSQL type OIDs, from the server's pg_type.h */
+    constexpr Oid BoolOid        = 16;
+    constexpr Oid ByteaOid       = 17;
+    constexpr Oid CharOid        = 18;
+    constexpr Oid NameOid        = 19;
+    constexpr Oid Int8Oid        = 20;
+    constexpr Oid Int2Oid        = 21;
+    constexpr Oid Int4Oid        = 23;
+    constexpr Oid TextOid        = 25;
+    constexpr Oid OidOid         = 26;
+    constexpr Oid JsonOid        = 114;
+    constexpr Oid Float4Oid      = 700;
+    constexpr Oid Float8Oid      = 701;
+    constexpr Oid BpcharOid      = 1042;
+    constexpr Oid VarcharOid     = 1043;
+    constexpr Oid DateOid        = 1082;
+    constexpr Oid TimeOid        = 1083;
+    constexpr Oid TimestampOid   = 1114;
+    constexpr Oid TimestampTzOid = 1184;
+    constexpr Oid NumericOid     = 1700;
+    constexpr Oid UuidOid        = 2950;
+    constexpr Oid JsonbOid       = 3802;
+
+    /*! The libpq text format code. */
+    constexpr int TextFormat   = 0;
+    /*! The libpq binary format code. */
+    constexpr int BinaryFormat = 1;
+
+    /*! Get the PostgreSQL epoch (2000-01-01) used by the binary date/time formats. */
+    const QDate &postgresEpoch()
+    {
+        static const QDate cached(2000, 1, 1);
+
+        return cached;
+    }
+
+    /*! Get the QMetaType id for the given PostgreSQL type. */
+    int metaTypeId(const Oid type, const QSql::NumericalPrecisionPolicy policy)
+    {
+        switch (type) {
+        case BoolOid:
+            return QMetaType::Bool;
+
+        case Int2Oid:
+        case Int4Oid:
+            return QMetaType::Int;
+
+        case Int8Oid:
+            return QMetaType::LongLong;
+
+        case OidOid:
+            return QMetaType::UInt;
+
+        case NumericOid:
+            if (policy == QSql::HighPrecision)
+                return QMetaType::QString;
+            [[fallthrough]];
+
+        case Float4Oid:
+        case Float8Oid:
+            switch (policy) {
+            case QSql::LowPrecisionInt32:
+                return QMetaType::Int;
+            case QSql::LowPrecisionInt64:
+                return QMetaType::LongLong;
+            default:
+                return QMetaType::Double;
+            }
+
+        case ByteaOid:
+            return QMetaType::QByteArray;
+
+        case DateOid:
+            return QMetaType::QDate;
+
+        case TimeOid:
+            return QMetaType::QTime;
+
+        case TimestampOid:
+        case TimestampTzOid:
+            return QMetaType::QDateTime;
+
+        default:
+            return QMetaType::QString;
+        }
+    }
+
+    /*! Get the null QVariant of the given type. */
+    QVariant nullVariant(const int typeId)
+    {
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        return QVariant(QMetaType(typeId));
+#else
+        return QVariant(static_cast<QVariant::Type>(typeId));
+#endif
+    }
+
+    /*! Determine whether the given type can be decoded from the binary format. */
+    bool isBinaryDecodable(const Oid type)
+    {
+        switch (type) {
+        case BoolOid:
+        case ByteaOid:
+        case CharOid:
+        case NameOid:
+        case Int8Oid:
+        case Int2Oid:
+        case Int4Oid:
+        case TextOid:
+        case OidOid:
+        case JsonOid:
+        case Float4Oid:
+        case Float8Oid:
+        case BpcharOid:
+        case VarcharOid:
+        case DateOid:
+        case TimeOid:
+        case TimestampOid:
+        case TimestampTzOid:
+        case UuidOid:
+        case JsonbOid:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+    /*! Apply the numerical precision policy on the floating-point value. */
+    QVariant applyPrecisionPolicy(const double value,
+                                  const QSql::NumericalPrecisionPolicy policy)
+    {
+        // The NaN and infinity can't be converted to the integer
+        if (!std::isfinite(value))
+            return value;
+
+        switch (policy) {
+        case QSql::LowPrecisionInt32:
+            return static_cast<int>(value);
+        case QSql::LowPrecisionInt64:
+            return static_cast<qint64>(value);
+        default:
+            return value;
+        }
+    }
+
+    /*! Convert the microseconds since the PostgreSQL epoch to the QDateTime. */
+    QDateTime fromPostgresTimestamp(const qint64 microseconds)
+    {
+        // The infinity and -infinity values
+        if (microseconds == std::numeric_limits<qint64>::max() ||
+            microseconds == std::numeric_limits<qint64>::min()
+        )
+            return {};
+
+        // Round towards the negative infinity, the timestamps before the epoch
+        auto milliseconds = microseconds / 1000;
+        if (microseconds % 1000 < 0)
+            --milliseconds;
+
+        return QDateTime(postgresEpoch(), QTime(0, 0), Qt::UTC).addMSecs(milliseconds);
+    }
+
+    /*! Parse the floating-point value in the text format (NaN, Infinity, -Infinity
+        are returned by the PostgreSQL for the special values). */
+    double parseDouble(const QByteArray &bytes)
+    {
+        if (bytes == "NaN")
+            return std::numeric_limits<double>::quiet_NaN();
+        if (bytes == "Infinity")
+            return std::numeric_limits<double>::infinity();
+        if (bytes == "-Infinity")
+            return -std::numeric_limits<double>::infinity();
+
+        return bytes.toDouble();
+    }
+
+    /*! Decode the value in the binary format. */
+    QVariant fromBinary(const char *const data, const int length, const Oid type,
+                        const QSql::NumericalPrecisionPolicy policy)
+    {
+        switch (type) {
+        case BoolOid:
+            return *data != 0;
+
+        case Int2Oid:
+            return static_cast<int>(qFromBigEndian<qint16>(data));
+
+        case Int4Oid:
+            return qFromBigEndian<qint32>(data);
+
+        case Int8Oid:
+            return qFromBigEndian<qint64>(data);
+
+        case OidOid:
+            return qFromBigEndian<quint32>(data);
+
+        case Float4Oid:
+            return applyPrecisionPolicy(
+                        std::bit_cast<float>(qFromBigEndian<quint32>(data)), policy);
+
+        case Float8Oid:
+            return applyPrecisionPolicy(
+                        std::bit_cast<double>(qFromBigEndian<quint64>(data)), policy);
+
+        case ByteaOid:
+            return QByteArray(data, length);
+
+        case DateOid:
+            return postgresEpoch().addDays(qFromBigEndian<qint32>(data));
+
+        case TimeOid:
+            return QTime::fromMSecsSinceStartOfDay(
+                        static_cast<int>(qFromBigEndian<qint64>(data) / 1000));
+
+        // The same as the QPSQL, the timestamp without time zone is in the local time
+        case TimestampOid: {
+            const auto datetime = fromPostgresTimestamp(qFromBigEndian<qint64>(data));
+
+            return datetime.isValid() ? QDateTime(datetime.date(), datetime.time())
+                                      : datetime;
+        }
+        case TimestampTzOid:
+            return fromPostgresTimestamp(qFromBigEndian<qint64>(data));
+
+        case UuidOid:
+            return QUuid::fromRfc4122(QByteArray::fromRawData(data, length))
+                    .toString(QUuid::WithoutBraces);
+
+        // The first byte is the jsonb format version
+        case JsonbOid:
+            return QString::fromUtf8(data + 1, length - 1);
+
+        default:
+            return QString::fromUtf8(data, length);
+        }
+    }
+
+    /*! Parse the timestamp in the ISO format returned by the PostgreSQL. */
+    QDateTime parseTimestamp(const char *const data, const int length)
+    {
+        auto value = QString::fromLatin1(data, length);
+
+        // The QDateTime accepts only the +hh:mm offset format
+        if (const auto sign = value.size() > 3 ? value.at(value.size() - 3) : QChar();
+            sign == QLatin1Char('+') || sign == QLatin1Char('-')
+        )
+            value += QStringLiteral(":00");
+
+        return QDateTime::fromString(value.replace(QLatin1Char(' '), QLatin1Char('T')),
+                                     Qt::ISODateWithMs);
+    }
+
+    /*! Decode the value in the text format. */
+    QVariant fromText(const char *const data, const int length, const Oid type,
+                      const QSql::NumericalPrecisionPolicy policy)
+    {
+        const auto bytes = QByteArray::fromRawData(data, length);
+
+        switch (type) {
+        case BoolOid:
+            return *data == 't';
+
+        case Int2Oid:
+        case Int4Oid:
+            return bytes.toInt();
+
+        case Int8Oid:
+            return bytes.toLongLong();
+
+        case OidOid:
+            return bytes.toUInt();
+
+        case NumericOid:
+            if (policy == QSql::HighPrecision)
+                return QString::fromLatin1(data, length);
+            [[fallthrough]];
+
+        case Float4Oid:
+        case Float8Oid:
+            return applyPrecisionPolicy(parseDouble(bytes), policy);
+
+        case ByteaOid: {
+            std::size_t size = 0;
+            auto *const unescaped = PQunescapeBytea(
+                                        reinterpret_cast<const unsigned char *>(data),
+                                        &size);
+
+            QByteArray result(reinterpret_cast<const char *>(unescaped),
+                              static_cast<QByteArray::size_type>(size));
+            PQfreemem(unescaped);
+
+            return result;
+        }
+        case DateOid:
+            return QDate::fromString(QString::fromLatin1(data, length), Qt::ISODate);
+
+        case TimeOid:
+            return QTime::fromString(QString::fromLatin1(data, length),
+                                     Qt::ISODateWithMs);
+
+        case TimestampOid:
+        case TimestampTzOid:
+            return parseTimestamp(data, length);
+
+        default:
+            return QString::fromUtf8(data, length);
+        }
+    }
+
+    /*! Query parameter converted for the libpq. */
+    struct Parameter
+    {
+        /*! Parameter value. */
+        QByteArray value;
+        /*! Determine whether the parameter is null. */
+        bool isNull = false;
+        /*! The libpq format code of the parameter. */
+        int format = TextFormat;
+    };
+
+    /*! Determine whether the given value should be sent as the SQL NULL. */
+    bool isNullParameter(const QVariant &value)
+    {
+        if (!value.isValid() || value.isNull())
+            return true;
+
+        switch (Helpers::qVariantTypeId(value)) {
+        case QMetaType::QString:
+            return value.value<QString>().isNull();
+        case QMetaType::QByteArray:
+            return value.value<QByteArray>().isNull();
+        case QMetaType::QDateTime:
+            return !value.value<QDateTime>().isValid();
+        case QMetaType::QDate:
+            return !value.value<QDate>().isValid();
+        case QMetaType::QTime:
+            return !value.value<QTime>().isValid();
+        default:
+            return false;
+        }
+    }
+
+    /*! Convert the bound value to the libpq parameter, bytea values are sent
+        in the binary format so they don't need to be escaped. */
+    Parameter toParameter(const QVariant &value)
+    {
+        if (isNullParameter(value))
+            return {{}, true, TextFormat};
+
+        switch (Helpers::qVariantTypeId(value)) {
+        case QMetaType::Bool:
+            return {value.value<bool>() ? QByteArrayLiteral("t") : QByteArrayLiteral("f")};
+
+        case QMetaType::QByteArray:
+            return {value.value<QByteArray>(), false, BinaryFormat};
+
+        case QMetaType::QDateTime:
+            return {value.value<QDateTime>().toString(Qt::ISODateWithMs).toLatin1()};
+
+        case QMetaType::QDate:
+            return {value.value<QDate>().toString(Qt::ISODate).toLatin1()};
+
+        case QMetaType::QTime:
+            return {value.value<QTime>().toString(Qt::ISODateWithMs).toLatin1()};
+
+        case QMetaType::Double:
+        case QMetaType::Float:
+            return {QByteArray::number(value.value<double>(), 'g', 17)};
+
+        default:
+            return {value.value<QString>().toUtf8()};
+        }
+    }
+
+    /*! Replace the positional placeholders by the numbered $n placeholders,
+        placeholders inside the quoted strings and identifiers are skipped. */
+    QByteArray toNumberedPlaceholders(const QString &query)
+    {
+        QString result;
+        result.reserve(query.size() + 16);
+
+        auto number = 0;
+        QChar quote;
+
+        for (const auto character : query) {
+            if (!quote.isNull()) {
+                if (character == quote)
+                    quote = QChar();
+            }
+            else if (character == SQUOTE || character == QUOTE)
+                quote = character;
+
+            else if (character == QLatin1Char('?')) {
+                result += QStringLiteral("$%1").arg(++number);
+                continue;
+            }
+
+            result += character;
+        }
+
+        return result.toUtf8();
+    }
+
+    /*! Create the QSqlError from the libpq error, the SQLSTATE is the native error
+        code. */
+    QSqlError makeError(const QString &driverText, QSqlError::ErrorType type,
+                        const PGconn *const connection, const PGresult *const result)
+    {
+        QString message;
+        QString sqlState;
+
+        if (result != nullptr) {
+            message = QString::fromUtf8(PQresultErrorMessage(result));
+            sqlState = QString::fromLatin1(PQresultErrorField(result, PG_DIAG_SQLSTATE));
+        }
+        if (message.isEmpty() && connection != nullptr)
+            message = QString::fromUtf8(PQerrorMessage(connection));
+
+        if (connection == nullptr || PQstatus(connection) == CONNECTION_BAD)
+            type = QSqlError::ConnectionError;
+
+        return QSqlError(driverText, message.trimmed(), type, sqlState);
+    }
+} // namespace
+
+/*! QSqlResult implementation for the LibPqDriver. */
+class LibPqResult final : public QSqlResult
+{
+    Q_DISABLE_COPY_MOVE(LibPqResult)
+
+public:
+    /*! Constructor. */
+    explicit LibPqResult(const LibPqDriver *driver);
+    /*! Virtual destructor. */
+    ~LibPqResult() final;
+
+    /*! Get the underlying PGresult handle. */
+    QVariant handle() const final;
+
+    /*! Read and discard the rest of the streamed rows. */
+    void discardStreaming();
+    /*! Discard the rest of the streamed rows because another query is executed on
+        the connection, the result is deactivated and the lastError() is set. */
+    void loseStreaming();
+
+protected:
+    /*! Execute the unprepared query. */
+    bool reset(const QString &query) final;
+    /*! Prepare the query on the server. */
+    bool prepare(const QString &query) final;
+    /*! Execute the prepared query with the bound values. */
+    bool exec() final;
+
+    /*! Position on the given row. */
+    bool fetch(int index) final;
+    /*! Position on the first row. */
+    bool fetchFirst() final;
+    /*! Position on the last row. */
+    bool fetchLast() final;
+    /*! Position on the next row. */
+    bool fetchNext() final;
+    /*! Move to the next result of the multi-statement query. */
+    bool nextResult() final;
+    /*! Free the result set, the prepared statement is kept. */
+    void detachFromResultSet() final;
+
+    /*! Get the value of the given field in the current row. */
+    QVariant data(int index) final;
+    /*! Determine whether the given field in the current row is null. */
+    bool isNull(int index) final;
+    /*! Get the number of rows in the result, -1 if unknown (streamed). */
+    int size() final;
+    /*! Get the number of rows affected by the query. */
+    int numRowsAffected() final;
+    /*! Get the fields of the result. */
+    QSqlRecord record() const final;
+    /*! Get the OID of the inserted row (tables with OIDs only). */
+    QVariant lastInsertId() const final;
+
+private:
+    /*! Get the driver. */
+    const LibPqDriver *pqDriver() const;
+    /*! Get the libpq connection, nullptr if the driver isn't open. */
+    PGconn *connection() const;
+
+    /*! Take the next pending result and initialize the result set. */
+    bool takeNextResult();
+    /*! Read the next streamed result (row) from the connection. */
+    bool takeStreamedResult();
+    /*! Stop streaming, the rest of the results is discarded. */
+    void stopStreaming();
+    /*! Free all the results. */
+    void cleanup();
+    /*! Deallocate the prepared statement on the server. */
+    void deallocate();
+
+    /*! The current result. */
+    PGresult *m_result = nullptr;
+    /*! The remaining results of the multi-statement query. */
+    std::deque<PGresult *> m_pendingResults;
+    /*! Index of the current row in the m_result (single-row mode has one row). */
+    int m_resultRow = -1;
+    /*! Determine whether the result is streamed in the single-row mode. */
+    bool m_streaming = false;
+    /*! The name of the prepared statement. */
+    QByteArray m_statementName;
+    /*! The result format of the prepared statement. */
+    int m_resultFormat = TextFormat;
+};
+
+/* LibPqDriver */
+
+/* public */
+
+LibPqDriver::LibPqDriver(QObject *const parent)
+    : QSqlDriver(parent)
+{}
+
+LibPqDriver::~LibPqDriver()
+{
+    LibPqDriver::close();
+}
+
+void LibPqDriver::registerDriver()
+{
+    static std::once_flag registered;
+
+    std::call_once(registered, []
+    {
+        QSqlDatabase::registerSqlDriver(QPSQL_LIBPQ,
+                                        new QSqlDriverCreator<LibPqDriver>());
+    });
+}
+
+bool LibPqDriver::hasFeature(const DriverFeature feature) const
+{
+    switch (feature) {
+    case Transactions:
+    case QuerySize:
+    case BLOB:
+    case Unicode:
+    case PreparedQueries:
+    case PositionalPlaceholders:
+    case MultipleResultSets:
+    case LowPrecisionNumbers:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+bool LibPqDriver::open(const QString &database, const QString &user,
+                       const QString &password, const QString &host, const int port,
+                       const QString &connectOptions)
+{
+    close();
+
+    QString connectionInfo;
+
+    const auto append = [&connectionInfo](const QString &key, QString value)
+    {
+        if (value.isEmpty())
+            return;
+
+        value.replace(QLatin1Char('\\'), QStringLiteral("\\\\"))
+             .replace(SQUOTE, QStringLiteral("\\'"));
+
+        connectionInfo += QStringLiteral("%1=%2 ").arg(key, TMPL_SQUOTES.arg(value));
+    };
+
+    append(QStringLiteral("host"), host);
+    append(QStringLiteral("dbname"), database);
+    append(QStringLiteral("user"), user);
+    append(QStringLiteral("password"), password);
+
+    if (port != -1)
+        append(QStringLiteral("port"), QString::number(port));
+
+    // The same format as the QPSQL connect options
+    if (!connectOptions.isEmpty())
+        connectionInfo += QString(connectOptions).replace(QLatin1Char(';'),
+                                                          QLatin1Char(' '));
+
+    m_connection = PQconnectdb(connectionInfo.toUtf8().constData());
+
+    if (PQstatus(m_connection) != CONNECTION_OK) {
+        setLastError(makeError(QStringLiteral("Unable to connect"),
+                               QSqlError::ConnectionError, m_connection, nullptr));
+        setOpenError(true);
+
+        PQfinish(m_connection);
+        m_connection = nullptr;
+
+        return false;
+    }
+
+    /* The text results are decoded from the UTF-8 and the dates and timestamps
+       are parsed in the ISO format. */
+    if (PQsetClientEncoding(m_connection, "UTF8") != 0) {
+        setLastError(makeError(QStringLiteral("Unable to set the client encoding"),
+                               QSqlError::ConnectionError, m_connection, nullptr));
+        setOpenError(true);
+
+        PQfinish(m_connection);
+        m_connection = nullptr;
+
+        return false;
+    }
+
+    if (!execCommand("set datestyle = 'ISO'",
+                     QStringLiteral("Unable to set the datestyle"))
+    ) {
+        setOpenError(true);
+
+        PQfinish(m_connection);
+        m_connection = nullptr;
+
+        return false;
+    }
+
+    setOpen(true);
+    setOpenError(false);
+
+    return true;
+}
+
+void LibPqDriver::close()
+{
+    if (m_connection == nullptr)
+        return;
+
+    finishStreaming();
+
+    PQfinish(m_connection);
+    m_connection = nullptr;
+
+    setOpen(false);
+    setOpenError(false);
+}
+
+QSqlResult *LibPqDriver::createResult() const
+{
+    return new LibPqResult(this);
+}
+
+bool LibPqDriver::beginTransaction()
+{
+    return execCommand("begin", QStringLiteral("Could not begin transaction"));
+}
+
+bool LibPqDriver::commitTransaction()
+{
+    return execCommand("commit", QStringLiteral("Could not commit transaction"));
+}
+
+bool LibPqDriver::rollbackTransaction()
+{
+    return execCommand("rollback", QStringLiteral("Could not rollback transaction"));
+}
+
+QString LibPqDriver::formatValue(const QSqlField &field, const bool trimStrings) const
+{
+    if (field.isNull() || m_connection == nullptr)
+        return QSqlDriver::formatValue(field, trimStrings);
+
+    const auto value = field.value();
+
+    switch (Helpers::qVariantTypeId(value)) {
+    case QMetaType::QString: {
+        auto string = value.value<QString>();
+
+        if (trimStrings)
+            while (!string.isEmpty() && string.back().isSpace())
+                string.chop(1);
+
+        const auto utf8 = string.toUtf8();
+
+        QByteArray escaped((utf8.size() * 2) + 1, Qt::Uninitialized);
+        auto error = 0;
+
+        const auto size = PQescapeStringConn(m_connection, escaped.data(),
+                                             utf8.constData(),
+                                             static_cast<std::size_t>(utf8.size()),
+                                             &error);
+        escaped.truncate(static_cast<QByteArray::size_type>(size));
+
+        return TMPL_SQUOTES.arg(QString::fromUtf8(escaped));
+    }
+    case QMetaType::QByteArray: {
+        const auto bytes = value.value<QByteArray>();
+        std::size_t size = 0;
+
+        auto *const escaped = PQescapeByteaConn(
+                                  m_connection,
+                                  reinterpret_cast<const unsigned char *>(
+                                      bytes.constData()),
+                                  static_cast<std::size_t>(bytes.size()), &size);
+
+        auto result = TMPL_SQUOTES.arg(
+                          QString::fromLatin1(reinterpret_cast<const char *>(escaped)));
+        PQfreemem(escaped);
+
+        return result;
+    }
+    case QMetaType::Bool:
+        return value.value<bool>() ? QStringLiteral("TRUE") : QStringLiteral("FALSE");
+
+    case QMetaType::QDateTime:
+    case QMetaType::QDate:
+    case QMetaType::QTime:
+        return TMPL_SQUOTES.arg(QString::fromLatin1(toParameter(value).value));
+
+    default:
+        return QSqlDriver::formatValue(field, trimStrings);
+    }
+}
+
+QString LibPqDriver::escapeIdentifier(const QString &identifier,
+                                      const IdentifierType /*unused*/) const
+{
+    if (identifier.isEmpty() || isIdentifierEscaped(identifier, TableName))
+        return identifier;
+
+    auto parts = identifier.split(DOT);
+
+    for (auto &part : parts)
+        part = QStringLiteral("\"%1\"").arg(part.replace(QUOTE, QStringLiteral("\"\"")));
+
+    return parts.join(DOT);
+}
+
+QVariant LibPqDriver::handle() const
+{
+    return QVariant::fromValue(static_cast<void *>(m_connection));
+}
+
+/* private */
+
+bool LibPqDriver::execCommand(const char *const command, const QString &errorText)
+{
+    finishStreaming();
+
+    auto *const result = PQexec(m_connection, command);
+    const auto ok = PQresultStatus(result) == PGRES_COMMAND_OK;
+
+    if (!ok)
+        setLastError(makeError(errorText, QSqlError::TransactionError, m_connection,
+                               result));
+
+    PQclear(result);
+
+    return ok;
+}
+
+void LibPqDriver::finishStreaming() const
+{
+    if (m_streamingResult != nullptr)
+        m_streamingResult->loseStreaming();
+}
+
+QByteArray LibPqDriver::nextStatementName() const
+{
+    return QByteArrayLiteral("tiny_stmt_") + QByteArray::number(++m_statementCounter);
+}
+
+/* LibPqResult */
+
+/* public */
+
+LibPqResult::LibPqResult(const LibPqDriver *const driver)
+    : QSqlResult(driver)
+{}
+
+LibPqResult::~LibPqResult()
+{
+    cleanup();
+    deallocate();
+}
+
+QVariant LibPqResult::handle() const
+{
+    return QVariant::fromValue(static_cast<void *>(m_result));
+}
+
+void LibPqResult::discardStreaming()
+{
+    if (!m_streaming)
+        return;
+
+    // The connection can't run another query until all results are read
+    if (auto *const connection_ = connection(); connection_ != nullptr)
+        while (auto *const result = PQgetResult(connection_))
+            PQclear(result);
+
+    stopStreaming();
+}
+
+void LibPqResult::loseStreaming()
+{
+    if (!m_streaming)
+        return;
+
+    discardStreaming();
+
+    setLastError(QSqlError(
+                     QStringLiteral("Query results lost"),
+                     QStringLiteral("The rest of the streamed rows was discarded "
+                                    "because another query was executed on "
+                                    "the same connection."),
+                     QSqlError::StatementError));
+    setActive(false);
+
+    PQclear(m_result);
+    m_result = nullptr;
+    m_resultRow = -1;
+}
+
+/* protected */
+
+bool LibPqResult::reset(const QString &query)
+{
+    cleanup();
+
+    auto *const connection_ = connection();
+    if (connection_ == nullptr)
+        return false;
+
+    pqDriver()->finishStreaming();
+
+    /* Send the whole query at once, every statement of the multi-statement query
+       has its own result and all results are returned in one round trip. */
+    if (PQsendQuery(connection_, query.toUtf8().constData()) == 0) {
+        setLastError(makeError(QStringLiteral("Unable to send query"),
+                               QSqlError::StatementError, connection_, nullptr));
+        return false;
+    }
+
+    while (auto *const result = PQgetResult(connection_))
+        m_pendingResults.push_back(result);
+
+    return takeNextResult();
+}
+
+bool LibPqResult::prepare(const QString &query)
+{
+    cleanup();
+    deallocate();
+
+    auto *const connection_ = connection();
+    if (connection_ == nullptr)
+        return false;
+
+    pqDriver()->finishStreaming();
+
+    auto statementName = pqDriver()->nextStatementName();
+
+    auto *const result = PQprepare(connection_, statementName.constData(),
+                                   toNumberedPlaceholders(query).constData(), 0,
+                                   nullptr);
+
+    if (PQresultStatus(result) != PGRES_COMMAND_OK) {
+        setLastError(makeError(QStringLiteral("Unable to prepare statement"),
+                               QSqlError::StatementError, connection_, result));
+        PQclear(result);
+
+        return false;
+    }
+
+    PQclear(result);
+
+    m_statementName = std::move(statementName);
+
+    /* The libpq supports only one result format for all columns, the binary format
+       is used only if all the result columns can be decoded from it. */
+    auto *const description = PQdescribePrepared(connection_,
+                                                 m_statementName.constData());
+
+    m_resultFormat = PQresultStatus(description) == PGRES_COMMAND_OK
+                     ? BinaryFormat : TextFormat;
+
+    if (m_resultFormat == BinaryFormat)
+        for (auto index = 0; index < PQnfields(description); ++index)
+            if (!isBinaryDecodable(PQftype(description, index))) {
+                m_resultFormat = TextFormat;
+                break;
+            }
+
+    PQclear(description);
+
+    return true;
+}
+
+bool LibPqResult::exec()
+{
+    cleanup();
+
+    auto *const connection_ = connection();
+    if (connection_ == nullptr || m_statementName.isEmpty())
+        return false;
+
+    pqDriver()->finishStreaming();
+
+    const auto values = boundValues();
+
+    std::vector<Parameter> parameters;
+    parameters.reserve(static_cast<std::size_t>(values.size()));
+
+    for (const auto &value : values)
+        parameters.push_back(toParameter(value));
+
+    std::vector<const char *> parameterValues;
+    std::vector<int> parameterLengths;
+    std::vector<int> parameterFormats;
+    parameterValues.reserve(parameters.size());
+    parameterLengths.reserve(parameters.size());
+    parameterFormats.reserve(parameters.size());
+
+    for (const auto &[value, isNull, format] : parameters) {
+        parameterValues.push_back(isNull ? nullptr : value.constData());
+        parameterLengths.push_back(static_cast<int>(value.size()));
+        parameterFormats.push_back(format);
+    }
+
+    const auto parametersSize = static_cast<int>(parameters.size());
+
+    // Stream the rows in the single-row mode, the result isn't held in the memory
+    if (isForwardOnly()) {
+        if (PQsendQueryPrepared(connection_, m_statementName.constData(),
+                                parametersSize, parameterValues.data(),
+                                parameterLengths.data(), parameterFormats.data(),
+                                m_resultFormat) == 0
+        ) {
+            setLastError(makeError(QStringLiteral("Unable to execute statement"),
+                                   QSqlError::StatementError, connection_, nullptr));
+            return false;
+        }
+
+        if (PQsetSingleRowMode(connection_) == 1) {
+            m_streaming = true;
+            pqDriver()->m_streamingResult = this;
+
+            return takeStreamedResult();
+        }
+
+        // The single-row mode can't be enabled, read the whole result instead
+        while (auto *const result = PQgetResult(connection_))
+            m_pendingResults.push_back(result);
+
+        return takeNextResult();
+    }
+
+    m_pendingResults.push_back(
+                PQexecPrepared(connection_, m_statementName.constData(),
+                               parametersSize, parameterValues.data(),
+                               parameterLengths.data(), parameterFormats.data(),
+                               m_resultFormat));
+
+    return takeNextResult();
+}
+
+bool LibPqResult::fetch(const int index)
+{
+    if (!isActive() || !isSelect() || m_result == nullptr)
+        return false;
+
+    // Streamed rows can be read only once from the first to the last one
+    if (m_streaming)
+        return index == at() + 1 && fetchNext();
+
+    if (index < 0 || index >= PQntuples(m_result))
+        return false;
+
+    m_resultRow = index;
+    setAt(index);
+
+    return true;
+}
+
+bool LibPqResult::fetchFirst()
+{
+    if (m_streaming)
+        return at() == QSql::BeforeFirstRow && fetchNext();
+
+    return fetch(0);
+}
+
+bool LibPqResult::fetchLast()
+{
+    // The last row isn't known until the whole result is read
+    if (m_streaming)
+        return false;
+
+    return m_result != nullptr && fetch(PQntuples(m_result) - 1);
+}
+
+bool LibPqResult::fetchNext()
+{
+    if (!m_streaming)
+        return fetch(at() + 1);
+
+    // The first row is already read by the exec()
+    if (at() == QSql::BeforeFirstRow &&
+        PQresultStatus(m_result) == PGRES_SINGLE_TUPLE
+    ) {
+        m_resultRow = 0;
+        setAt(0);
+
+        return true;
+    }
+
+    const auto row = at();
+
+    if (!takeStreamedResult())
+        return false;
+
+    if (PQresultStatus(m_result) != PGRES_SINGLE_TUPLE) {
+        setAt(QSql::AfterLastRow);
+        return false;
+    }
+
+    m_resultRow = 0;
+    setAt(row + 1);
+
+    return true;
+}
+
+bool LibPqResult::nextResult()
+{
+    discardStreaming();
+
+    if (m_pendingResults.empty())
+        return false;
+
+    PQclear(m_result);
+    m_result = nullptr;
+
+    return takeNextResult();
+}
+
+void LibPqResult::detachFromResultSet()
+{
+    cleanup();
+}
+
+QVariant LibPqResult::data(const int index)
+{
+    if (m_result == nullptr || index < 0 || index >= PQnfields(m_result) ||
+        m_resultRow < 0 || m_resultRow >= PQntuples(m_result)
+    )
+        return {};
+
+    const auto type = PQftype(m_result, index);
+    const auto policy = numericalPrecisionPolicy();
+
+    if (PQgetisnull(m_result, m_resultRow, index) != 0)
+        return nullVariant(metaTypeId(type, policy));
+
+    const auto *const value = PQgetvalue(m_result, m_resultRow, index);
+    const auto length = PQgetlength(m_result, m_resultRow, index);
+
+    if (PQfformat(m_result, index) == BinaryFormat)
+        return fromBinary(value, length, type, policy);
+
+    return fromText(value, length, type, policy);
+}
+
+bool LibPqResult::isNull(const int index)
+{
+    if (m_result == nullptr || m_resultRow < 0 || m_resultRow >= PQntuples(m_result))
+        return true;
+
+    return PQgetisnull(m_result, m_resultRow, index) != 0;
+}
+
+int LibPqResult::size()
+{
+    if (m_streaming || m_result == nullptr || !isSelect())
+        return -1;
+
+    return PQntuples(m_result);
+}
+
+int LibPqResult::numRowsAffected()
+{
+    if (m_result == nullptr)
+        return -1;
+
+    return QByteArray(PQcmdTuples(m_result)).toInt();
+}
+
+QSqlRecord LibPqResult::record() const
+{
+    QSqlRecord record;
+
+    if (!isActive() || !isSelect() || m_result == nullptr)
+        return record;
+
+    const auto policy = numericalPrecisionPolicy();
+
+    for (auto index = 0; index < PQnfields(m_result); ++index) {
+        const auto typeId = metaTypeId(PQftype(m_result, index), policy);
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        QSqlField field(QString::fromUtf8(PQfname(m_result, index)), QMetaType(typeId));
+#else
+        QSqlField field(QString::fromUtf8(PQfname(m_result, index)),
+                        static_cast<QVariant::Type>(typeId));
+#endif
+        record.append(field);
+    }
+
+    return record;
+}
+
+QVariant LibPqResult::lastInsertId() const
+{
+    if (m_result == nullptr)
+        return {};
+
+    const auto oid = PQoidValue(m_result);
+
+    return oid == InvalidOid ? QVariant() : QVariant(oid);
+}
+
+/* private */
+
+const LibPqDriver *LibPqResult::pqDriver() const
+{
+    return static_cast<const LibPqDriver *>(driver());
+}
+
+PGconn *LibPqResult::connection() const
+{
+    const auto *const driver_ = pqDriver();
+
+    if (driver_ == nullptr || !driver_->isOpen() || driver_->isOpenError())
+        return nullptr;
+
+    return driver_->m_connection;
+}
+
+bool LibPqResult::takeNextResult()
+{
+    setAt(QSql::BeforeFirstRow);
+    m_resultRow = -1;
+
+    if (m_pendingResults.empty())
+        return false;
+
+    m_result = m_pendingResults.front();
+    m_pendingResults.pop_front();
+
+    switch (PQresultStatus(m_result)) {
+    case PGRES_TUPLES_OK:
+        setSelect(true);
+        setActive(true);
+        return true;
+
+    case PGRES_COMMAND_OK:
+    case PGRES_EMPTY_QUERY:
+        setSelect(false);
+        setActive(true);
+        return true;
+
+    default:
+        setLastError(makeError(QStringLiteral("Unable to execute statement"),
+                               QSqlError::StatementError, connection(), m_result));
+        setActive(false);
+
+        PQclear(m_result);
+        m_result = nullptr;
+
+        return false;
+    }
+}
+
+bool LibPqResult::takeStreamedResult()
+{
+    PQclear(m_result);
+    m_result = PQgetResult(connection());
+
+    switch (PQresultStatus(m_result)) {
+    // The row
+    case PGRES_SINGLE_TUPLE:
+        setSelect(true);
+        setActive(true);
+        return true;
+
+    // The end of the result (zero rows), the result is kept for the record()
+    case PGRES_TUPLES_OK:
+        setSelect(true);
+        setActive(true);
+        discardStreaming();
+        return true;
+
+    case PGRES_COMMAND_OK:
+        setSelect(false);
+        setActive(true);
+        discardStreaming();
+        return true;
+
+    default:
+        setLastError(makeError(QStringLiteral("Unable to execute statement"),
+                               QSqlError::StatementError, connection(), m_result));
+        setActive(false);
+
+        PQclear(m_result);
+        m_result = nullptr;
+
+        discardStreaming();
+
+        return false;
+    }
+}
+
+void LibPqResult::stopStreaming()
+{
+    m_streaming = false;
+
+    if (const auto *const driver_ = pqDriver();
+        driver_ != nullptr && driver_->m_streamingResult == this
+    )
+        driver_->m_streamingResult = nullptr;
+}
+
+void LibPqResult::cleanup()
+{
+    discardStreaming();
+
+    PQclear(m_result);
+    m_result = nullptr;
+
+    for (auto *const result : m_pendingResults)
+        PQclear(result);
+
+    m_pendingResults.clear();
+
+    m_resultRow = -1;
+    setAt(QSql::BeforeFirstRow);
+    setSelect(false);
+    setActive(false);
+}
+
+void LibPqResult::deallocate()
+{
+    if (m_statementName.isEmpty())
+        return;
+
+    // The prepared statements are freed by the server when the connection is closed
+    if (auto *const connection_ = connection(); connection_ != nullptr) {
+        pqDriver()->finishStreaming();
+
+        PQclear(PQexec(connection_,
+                       (QByteArrayLiteral("deallocate ") + m_statementName)
+                       .constData()));
+    }
+
+    m_statementName.clear();
+}
+
+} // namespace Orm::Drivers
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // TINYORM_LIBPQ_DRIVER
@@ -0,0 +1,1011 @@
+#include "orm/drivers/sqlite3driver.hpp"
+
+#ifdef TINYORM_SQLITE3_DRIVER
+#include <QDateTime>
+#include <QtSql/QSqlDatabase>
+#include <QtSql/QSqlError>
+#include <QtSql/QSqlField>
+#include <QtSql/QSqlRecord>
+#include <QtSql/QSqlResult>
+
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <sqlite3.h>
+
+#include "orm/constants.hpp"
+#include "orm/utils/helpers.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using Orm::Constants::DOT;
+using Orm::Constants::QSQLITE_LIB;
+using Orm::Constants::QUOTE;
+
+using Orm::Utils::Helpers;
+
+namespace Orm::Drivers
+{
+
+/*!
+    \class SQLite3Driver
+    \brief The SQLite3Driver class is the native SQLite driver using the sqlite3.
+
+    \ingroup database
+    \inmodule Export
+
+    The QSQLITE driver prepares the sqlite3_stmt again for every QSqlQuery::prepare()
+    and finalizes it when the query is destroyed. This driver returns every finalized
+    statement to the LRU cache keyed by the query string, the next prepare
+    of the same query only takes the statement from the cache. Bound values are
+    passed to the sqlite3_bind_xyz() without copying (SQLITE_STATIC) and columns
+    are converted by their storage class, integers and reals are never converted
+    from or to strings.
+*/
+
+namespace
+{
+    /*! Get the QMetaType id for the declared column type, the same mapping
+        as the QSQLITE driver uses. */
+    int metaTypeId(const char *const declaredType)
+    {
+        const auto typeName = QByteArray(declaredType).toLower();
+
+        if (typeName == "integer" || typeName == "int")
+            return QMetaType::Int;
+
+        if (typeName == "double" || typeName == "float" || typeName == "real" ||
+            typeName.startsWith("numeric")
+        )
+            return QMetaType::Double;
+
+        if (typeName == "blob")
+            return QMetaType::QByteArray;
+
+        if (typeName == "boolean" || typeName == "bool")
+            return QMetaType::Bool;
+
+        return QMetaType::QString;
+    }
+
+    /*! Get the QMetaType id for the column storage class. */
+    int metaTypeId(const int storageClass)
+    {
+        switch (storageClass) {
+        case SQLITE_INTEGER:
+            return QMetaType::LongLong;
+        case SQLITE_FLOAT:
+            return QMetaType::Double;
+        case SQLITE_BLOB:
+            return QMetaType::QByteArray;
+        default:
+            return QMetaType::QString;
+        }
+    }
+
+    /*! Create the null QVariant of the given type. */
+    QVariant nullVariant(const int typeId)
+    {
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        return QVariant(QMetaType(typeId));
+#else
+        return QVariant(static_cast<QVariant::Type>(typeId));
+#endif
+    }
+
+    /*! Determine whether the given value should be bound as the SQL NULL. */
+    bool isNullValue(const QVariant &value)
+    {
+        if (!value.isValid() || value.isNull())
+            return true;
+
+        switch (Helpers::qVariantTypeId(value)) {
+        case QMetaType::QString:
+            return value.value<QString>().isNull();
+        case QMetaType::QByteArray:
+            return value.value<QByteArray>().isNull();
+        case QMetaType::QDateTime:
+            return !value.value<QDateTime>().isValid();
+        case QMetaType::QDate:
+            return !value.value<QDate>().isValid();
+        case QMetaType::QTime:
+            return !value.value<QTime>().isValid();
+        default:
+            return false;
+        }
+    }
+
+    /*! Create the QSqlError from the sqlite3 error, the extended result code is
+        the native error code. */
+    QSqlError makeError(sqlite3 *const connection, const QString &driverText,
+                        const QSqlError::ErrorType type, const int errorCode)
+    {
+        const auto message = connection == nullptr
+                             ? QString::fromUtf8(sqlite3_errstr(errorCode))
+                             : QString::fromUtf8(sqlite3_errmsg(connection));
+
+        return QSqlError(driverText, message, type, QString::number(errorCode));
+    }
+} // namespace
+
+/*! QSqlResult implementation for the SQLite3Driver. */
+class SQLite3Result final : public QSqlResult
+{
+    Q_DISABLE_COPY_MOVE(SQLite3Result)
+
+public:
+    /*! Constructor. */
+    explicit SQLite3Result(const SQLite3Driver *driver);
+    /*! Virtual destructor. */
+    ~SQLite3Result() final;
+
+    /*! Get the underlying sqlite3_stmt handle. */
+    QVariant handle() const final;
+
+protected:
+    /*! Execute the unprepared query. */
+    bool reset(const QString &query) final;
+    /*! Prepare the query, the statement is taken from the cache if possible. */
+    bool prepare(const QString &query) final;
+    /*! Execute the prepared query with the bound values. */
+    bool exec() final;
+
+    /*! Position on the given row, the statement is stepped only forward and
+        the stepped rows are cached (only the current row if forward-only). */
+    bool fetch(int index) final;
+    /*! Position on the first row. */
+    bool fetchFirst() final;
+    /*! Position on the last row. */
+    bool fetchLast() final;
+    /*! Position on the next row. */
+    bool fetchNext() final;
+    /*! Reset the statement, it releases the database locks held by the statement. */
+    void detachFromResultSet() final;
+
+    /*! Get the value of the given field in the current row. */
+    QVariant data(int index) final;
+    /*! Determine whether the given field in the current row is null. */
+    bool isNull(int index) final;
+    /*! Get the number of rows in the result, SQLite doesn't know it (-1). */
+    int size() final;
+    /*! Get the number of rows affected by the query. */
+    int numRowsAffected() final;
+    /*! Get the fields of the result. */
+    QSqlRecord record() const final;
+    /*! Get the rowid of the last inserted row. */
+    QVariant lastInsertId() const final;
+
+private:
+    /*! Get the driver. */
+    const SQLite3Driver *sqliteDriver() const;
+    /*! Get the sqlite3 connection, nullptr if the driver isn't open. */
+    sqlite3 *connection() const;
+
+    /*! Cached row of the result. */
+    struct CachedRow
+    {
+        /*! The column values. */
+        QVector<QVariant> values;
+        /*! Determine whether the column value is the SQL NULL. */
+        QVector<bool> nulls;
+    };
+
+    /*! Bind the bound values to the statement. */
+    bool bindValues();
+    /*! Step to the next row and cache it, the statement is reset after
+        the last row. */
+    bool step();
+    /*! Copy the current row of the statement to the rows cache. */
+    void cacheRow();
+    /*! Get the value of the given column in the current row of the statement. */
+    QVariant columnValue(int index) const;
+    /*! Get the cached row at the current position, nullptr if not cached. */
+    const CachedRow *currentRow() const;
+    /*! Free the cached rows. */
+    void clearRows();
+    /*! Return the statement to the driver's statement cache. */
+    void releaseStatement();
+
+    /*! The prepared statement. */
+    sqlite3_stmt *m_statement = nullptr;
+    /*! The query string of the prepared statement (the statement cache key). */
+    QString m_query;
+    /*! The driver's connection generation the statement was prepared on. */
+    quint64 m_generation = 0;
+    /*! Bound strings, they have to live until the next bind (SQLITE_STATIC). */
+    std::vector<QString> m_boundStrings;
+    /*! Bound blobs, they have to live until the next bind (SQLITE_STATIC). */
+    std::vector<QByteArray> m_boundBlobs;
+    /*! The stepped rows, the statement can't step backward and re-executing it
+        would repeat its side effects (eg. the RETURNING clause). */
+    std::deque<CachedRow> m_rows;
+    /*! The row index of the first cached row (forward-only results cache only
+        the current row). */
+    int m_rowsOffset = 0;
+    /*! The number of stepped rows. */
+    int m_steppedRows = 0;
+    /*! Determine whether all rows were stepped. */
+    bool m_isDone = false;
+    /*! The number of rows affected by the last executed query. */
+    int m_rowsAffected = -1;
+    /*! The fields of the result, cached until the next prepare. */
+    mutable std::optional<QSqlRecord> m_record;
+};
+
+/* SQLite3Driver */
+
+/* public */
+
+SQLite3Driver::SQLite3Driver(QObject *const parent)
+    : QSqlDriver(parent)
+{}
+
+SQLite3Driver::~SQLite3Driver()
+{
+    SQLite3Driver::close();
+}
+
+void SQLite3Driver::registerDriver()
+{
+    static std::once_flag registered;
+
+    std::call_once(registered, []
+    {
+        QSqlDatabase::registerSqlDriver(QSQLITE_LIB,
+                                        new QSqlDriverCreator<SQLite3Driver>());
+    });
+}
+
+bool SQLite3Driver::hasFeature(const DriverFeature feature) const
+{
+    switch (feature) {
+    case Transactions:
+    case BLOB:
+    case Unicode:
+    case LastInsertId:
+    case PreparedQueries:
+    case PositionalPlaceholders:
+    case SimpleLocking:
+    case FinishQuery:
+    case LowPrecisionNumbers:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+bool SQLite3Driver::open(const QString &database, const QString &/*unused*/,
+                         const QString &/*unused*/, const QString &/*unused*/,
+                         const int /*unused*/, const QString &connectOptions)
+{
+    close();
+
+    // The connection is used by one thread only, like every QSqlDatabase connection
+    auto openFlags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_NOMUTEX;
+    auto busyTimeout = 5000;
+
+    // The same connect options as the QSQLITE driver uses
+    for (const auto &option : connectOptions.split(QLatin1Char(';'))) {
+        const auto trimmed = option.trimmed();
+
+        if (trimmed == QStringLiteral("QSQLITE_OPEN_READONLY"))
+            openFlags = (openFlags & ~(SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE)) |
+                        SQLITE_OPEN_READONLY;
+
+        else if (trimmed == QStringLiteral("QSQLITE_OPEN_URI"))
+            openFlags |= SQLITE_OPEN_URI;
+
+        else if (trimmed == QStringLiteral("QSQLITE_ENABLE_SHARED_CACHE"))
+            openFlags |= SQLITE_OPEN_SHAREDCACHE;
+
+        else if (trimmed.startsWith(QStringLiteral("QSQLITE_BUSY_TIMEOUT=")))
+            busyTimeout = trimmed.section(QLatin1Char('='), 1).toInt();
+
+        else if (trimmed.startsWith(QStringLiteral("QSQLITE_STATEMENT_CACHE_SIZE=")))
+            m_statementCacheSize = trimmed.section(QLatin1Char('='), 1).toULongLong();
+    }
+
+    if (const auto result = sqlite3_open_v2(database.toUtf8().constData(),
+                                            &m_connection, openFlags, nullptr);
+        result != SQLITE_OK
+    ) {
+        setLastError(makeError(m_connection, QStringLiteral("Error opening database"),
+                               QSqlError::ConnectionError, result));
+        setOpenError(true);
+
+        // The handle is allocated even if the open fails
+        sqlite3_close_v2(m_connection);
+        m_connection = nullptr;
+
+        return false;
+    }
+
+    sqlite3_busy_timeout(m_connection, busyTimeout);
+    sqlite3_extended_result_codes(m_connection, 1);
+
+    ++m_generation;
+
+    setOpen(true);
+    setOpenError(false);
+
+    return true;
+}
+
+void SQLite3Driver::close()
+{
+    if (m_connection == nullptr)
+        return;
+
+    clearStatementCache();
+
+    /* The statements still owned by the results are finalized later, the connection
+       is closed after the last of them is finalized (zombie connection). */
+    sqlite3_close_v2(m_connection);
+    m_connection = nullptr;
+
+    setOpen(false);
+    setOpenError(false);
+}
+
+QSqlResult *SQLite3Driver::createResult() const
+{
+    return new SQLite3Result(this);
+}
+
+bool SQLite3Driver::beginTransaction()
+{
+    return execCommand("BEGIN", QStringLiteral("Unable to begin transaction"));
+}
+
+bool SQLite3Driver::commitTransaction()
+{
+    return execCommand("COMMIT", QStringLiteral("Unable to commit transaction"));
+}
+
+bool SQLite3Driver::rollbackTransaction()
+{
+    return execCommand("ROLLBACK", QStringLiteral("Unable to rollback transaction"));
+}
+
+QString SQLite3Driver::formatValue(const QSqlField &field, const bool trimStrings) const
+{
+    if (field.isNull())
+        return QSqlDriver::formatValue(field, trimStrings);
+
+    const auto value = field.value();
+
+    switch (Helpers::qVariantTypeId(value)) {
+    case QMetaType::QByteArray:
+        return QStringLiteral("X'%1'").arg(
+                    QString::fromLatin1(value.value<QByteArray>().toHex()));
+
+    case QMetaType::Bool:
+        return value.value<bool>() ? QStringLiteral("1") : QStringLiteral("0");
+
+    default:
+        return QSqlDriver::formatValue(field, trimStrings);
+    }
+}
+
+QString SQLite3Driver::escapeIdentifier(const QString &identifier,
+                                        const IdentifierType type) const
+{
+    if (identifier.isEmpty() || isIdentifierEscaped(identifier, type))
+        return identifier;
+
+    auto parts = identifier.split(DOT);
+
+    for (auto &part : parts)
+        part = QStringLiteral("\"%1\"").arg(part.replace(QUOTE, QStringLiteral("\"\"")));
+
+    return parts.join(DOT);
+}
+
+QVariant SQLite3Driver::handle() const
+{
+    return QVariant::fromValue(static_cast<void *>(m_connection));
+}
+
+/* private */
+
+bool SQLite3Driver::execCommand(const char *const command, const QString &errorText)
+{
+    if (const auto result = sqlite3_exec(m_connection, command, nullptr, nullptr,
+                                         nullptr);
+        result != SQLITE_OK
+    ) {
+        setLastError(makeError(m_connection, errorText, QSqlError::TransactionError,
+                               result));
+        return false;
+    }
+
+    return true;
+}
+
+sqlite3_stmt *SQLite3Driver::takeStatement(const QString &query) const
+{
+    const auto found = m_statementIndex.find(query);
+
+    if (found == m_statementIndex.end()) {
+        ++m_statementCacheMisses;
+        return nullptr;
+    }
+
+    ++m_statementCacheHits;
+
+    auto *const statement = found->second->second;
+
+    m_statementCache.erase(found->second);
+    m_statementIndex.erase(found);
+
+    return statement;
+}
+
+void SQLite3Driver::returnStatement(const QString &query,
+                                    sqlite3_stmt *const statement) const
+{
+    if (m_statementCacheSize == 0) {
+        sqlite3_finalize(statement);
+        return;
+    }
+
+    // Release the locks and the bound values (they can reference freed memory)
+    sqlite3_reset(statement);
+    sqlite3_clear_bindings(statement);
+
+    m_statementCache.emplace_front(query, statement);
+    m_statementIndex.emplace(query, m_statementCache.begin());
+
+    // Evict the least recently used statements
+    while (m_statementCache.size() > m_statementCacheSize) {
+        const auto last = std::prev(m_statementCache.end());
+
+        auto [first, end] = m_statementIndex.equal_range(last->first);
+        for (; first != end; ++first)
+            if (first->second == last) {
+                m_statementIndex.erase(first);
+                break;
+            }
+
+        sqlite3_finalize(last->second);
+        m_statementCache.erase(last);
+    }
+}
+
+void SQLite3Driver::clearStatementCache() const
+{
+    for (const auto &[query, statement] : m_statementCache)
+        sqlite3_finalize(statement);
+
+    m_statementCache.clear();
+    m_statementIndex.clear();
+}
+
+/* SQLite3Result */
+
+/* public */
+
+SQLite3Result::SQLite3Result(const SQLite3Driver *const driver)
+    : QSqlResult(driver)
+{}
+
+SQLite3Result::~SQLite3Result()
+{
+    releaseStatement();
+}
+
+QVariant SQLite3Result::handle() const
+{
+    return QVariant::fromValue(static_cast<void *>(m_statement));
+}
+
+/* protected */
+
+bool SQLite3Result::reset(const QString &query)
+{
+    return prepare(query) && exec();
+}
+
+bool SQLite3Result::prepare(const QString &query)
+{
+    releaseStatement();
+
+    auto *const connection_ = connection();
+    if (connection_ == nullptr)
+        return false;
+
+    const auto *const driver_ = sqliteDriver();
+
+    m_statement = driver_->takeStatement(query);
+
+    // Cache miss, the statement is cached for the whole connection lifetime
+    if (m_statement == nullptr) {
+        const auto queryUtf8 = query.toUtf8();
+        const char *tail = nullptr;
+
+        if (const auto result = sqlite3_prepare_v3(
+                                    connection_, queryUtf8.constData(),
+                                    static_cast<int>(queryUtf8.size()),
+                                    SQLITE_PREPARE_PERSISTENT, &m_statement, &tail);
+            result != SQLITE_OK
+        ) {
+            setLastError(makeError(connection_,
+                                   QStringLiteral("Unable to execute statement"),
+                                   QSqlError::StatementError, result));
+            sqlite3_finalize(m_statement);
+            m_statement = nullptr;
+
+            return false;
+        }
+
+        // The same behavior as the QSQLITE driver
+        if (tail != nullptr &&
+            !QByteArray(tail).trimmed().isEmpty()
+        ) {
+            setLastError(QSqlError(
+                             QStringLiteral("Unable to execute multiple statements "
+                                            "at a time"),
+                             QStringLiteral("Multiple statements are not supported"),
+                             QSqlError::StatementError));
+            sqlite3_finalize(m_statement);
+            m_statement = nullptr;
+
+            return false;
+        }
+    }
+
+    m_query = query;
+    m_generation = driver_->m_generation;
+
+    return true;
+}
+
+bool SQLite3Result::exec()
+{
+    if (m_statement == nullptr)
+        return false;
+
+    sqlite3_reset(m_statement);
+
+    clearRows();
+    m_isDone = false;
+    m_rowsAffected = -1;
+    setAt(QSql::BeforeFirstRow);
+    setSelect(false);
+    setActive(false);
+
+    if (!bindValues())
+        return false;
+
+    auto *const connection_ = connection();
+
+    switch (const auto result = sqlite3_step(m_statement); result) {
+    case SQLITE_ROW:
+        cacheRow();
+        setSelect(true);
+        break;
+
+    case SQLITE_DONE:
+        m_isDone = true;
+
+        if (sqlite3_column_count(m_statement) > 0)
+            setSelect(true);
+        else
+            m_rowsAffected = sqlite3_changes(connection_);
+
+        // Release the locks
+        sqlite3_reset(m_statement);
+        break;
+
+    default:
+        setLastError(makeError(connection_,
+                               QStringLiteral("Unable to fetch row"),
+                               QSqlError::StatementError, result));
+        sqlite3_reset(m_statement);
+
+        return false;
+    }
+
+    setActive(true);
+
+    return true;
+}
+
+bool SQLite3Result::fetch(const int index)
+{
+    if (!isActive() || !isSelect() || index < 0 ||
+        // Forward-only results don't keep the previous rows
+        index < m_rowsOffset
+    )
+        return false;
+
+    while (m_steppedRows <= index)
+        if (m_isDone || !step()) {
+            setAt(QSql::AfterLastRow);
+            return false;
+        }
+
+    setAt(index);
+
+    return true;
+}
+
+bool SQLite3Result::fetchFirst()
+{
+    return fetch(0);
+}
+
+bool SQLite3Result::fetchLast()
+{
+    if (!isActive() || !isSelect())
+        return false;
+
+    // The last stepped row is always cached, the step() sets the m_isDone at the end
+    while (!m_isDone)
+        step();
+
+    if (m_steppedRows == 0) {
+        setAt(QSql::AfterLastRow);
+        return false;
+    }
+
+    return fetch(m_steppedRows - 1);
+}
+
+bool SQLite3Result::fetchNext()
+{
+    if (at() == QSql::AfterLastRow)
+        return false;
+
+    return fetch(at() + 1);
+}
+
+void SQLite3Result::detachFromResultSet()
+{
+    if (m_statement != nullptr)
+        sqlite3_reset(m_statement);
+
+    clearRows();
+    m_isDone = true;
+}
+
+QVariant SQLite3Result::data(const int index)
+{
+    const auto *const row = currentRow();
+
+    if (row == nullptr || index < 0 || index >= row->values.size())
+        return {};
+
+    return row->values.at(index);
+}
+
+bool SQLite3Result::isNull(const int index)
+{
+    const auto *const row = currentRow();
+
+    if (row == nullptr || index < 0 || index >= row->nulls.size())
+        return true;
+
+    return row->nulls.at(index);
+}
+
+int SQLite3Result::size()
+{
+    return -1;
+}
+
+int SQLite3Result::numRowsAffected()
+{
+    return m_rowsAffected;
+}
+
+QSqlRecord SQLite3Result::record() const
+{
+    if (!isActive() || !isSelect() || m_statement == nullptr)
+        return {};
+
+    // The record is obtained for every hydrated row, build it only once
+    if (m_record)
+        return *m_record;
+
+    QSqlRecord record;
+
+    const auto *const row = m_rows.empty() ? nullptr : &m_rows.front();
+
+    for (auto index = 0; index < sqlite3_column_count(m_statement); ++index) {
+        const auto *const declaredType = sqlite3_column_decltype(m_statement, index);
+
+        // Expression columns don't have the declared type, use the cached value type
+        const auto typeId = declaredType != nullptr
+                            ? metaTypeId(declaredType)
+                            : row != nullptr && !row->nulls.at(index)
+                              ? Helpers::qVariantTypeId(row->values.at(index))
+                              : static_cast<int>(QMetaType::QString);
+
+        const auto name = QString::fromUtf8(sqlite3_column_name(m_statement, index))
+                          .remove(QUOTE);
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        record.append(QSqlField(name, QMetaType(typeId)));
+#else
+        record.append(QSqlField(name, static_cast<QVariant::Type>(typeId)));
+#endif
+    }
+
+    m_record = record;
+
+    return record;
+}
+
+QVariant SQLite3Result::lastInsertId() const
+{
+    auto *const connection_ = connection();
+    if (!isActive() || connection_ == nullptr)
+        return {};
+
+    if (const auto id = sqlite3_last_insert_rowid(connection_); id != 0)
+        return static_cast<qint64>(id);
+
+    return {};
+}
+
+/* private */
+
+const SQLite3Driver *SQLite3Result::sqliteDriver() const
+{
+    return static_cast<const SQLite3Driver *>(driver());
+}
+
+sqlite3 *SQLite3Result::connection() const
+{
+    const auto *const driver_ = sqliteDriver();
+
+    if (driver_ == nullptr || !driver_->isOpen() || driver_->isOpenError())
+        return nullptr;
+
+    return driver_->m_connection;
+}
+
+QVariant SQLite3Result::columnValue(const int index) const
+{
+    switch (sqlite3_column_type(m_statement, index)) {
+    case SQLITE_INTEGER:
+        if (numericalPrecisionPolicy() == QSql::LowPrecisionInt32)
+            return sqlite3_column_int(m_statement, index);
+
+        return static_cast<qint64>(sqlite3_column_int64(m_statement, index));
+
+    case SQLITE_FLOAT:
+        switch (numericalPrecisionPolicy()) {
+        case QSql::LowPrecisionInt32:
+            return sqlite3_column_int(m_statement, index);
+        case QSql::LowPrecisionInt64:
+            return static_cast<qint64>(sqlite3_column_int64(m_statement, index));
+        default:
+            return sqlite3_column_double(m_statement, index);
+        }
+
+    case SQLITE_BLOB:
+        // The sqlite3_column_blob() has to be called before the sqlite3_column_bytes()
+        return QByteArray(static_cast<const char *>(sqlite3_column_blob(m_statement,
+                                                                        index)),
+                          sqlite3_column_bytes(m_statement, index));
+
+    case SQLITE_NULL:
+        return nullVariant(metaTypeId(sqlite3_column_decltype(m_statement, index)));
+
+    default:
+        return QString::fromUtf8(reinterpret_cast<const char *>(
+                                     sqlite3_column_text(m_statement, index)),
+                                 sqlite3_column_bytes(m_statement, index));
+    }
+}
+
+bool SQLite3Result::bindValues()
+{
+    const auto values = boundValues();
+    const auto parametersCount = sqlite3_bind_parameter_count(m_statement);
+
+    if (parametersCount != values.size()) {
+        setLastError(QSqlError(QStringLiteral("Parameter count mismatch"), {},
+                               QSqlError::StatementError));
+        return false;
+    }
+
+    m_boundStrings.clear();
+    m_boundStrings.reserve(static_cast<std::size_t>(values.size()));
+    m_boundBlobs.clear();
+
+    for (auto index = 0; index < parametersCount; ++index) {
+        const auto &value = values.at(index);
+        // Placeholders are numbered from 1
+        const auto parameter = index + 1;
+        auto result = SQLITE_OK;
+
+        if (isNullValue(value))
+            result = sqlite3_bind_null(m_statement, parameter);
+
+        else
+            switch (Helpers::qVariantTypeId(value)) {
+            case QMetaType::Bool:
+            case QMetaType::Char:
+            case QMetaType::SChar:
+            case QMetaType::UChar:
+            case QMetaType::Short:
+            case QMetaType::UShort:
+            case QMetaType::Int:
+            case QMetaType::UInt:
+            case QMetaType::Long:
+            case QMetaType::ULong:
+            case QMetaType::LongLong:
+                result = sqlite3_bind_int64(m_statement, parameter,
+                                            value.value<qint64>());
+                break;
+
+            case QMetaType::ULongLong:
+                // Out of the SQLite INTEGER range, bind as the text like the QSQLITE
+                if (const auto number = value.value<quint64>();
+                    number > static_cast<quint64>(std::numeric_limits<qint64>::max())
+                ) {
+                    const auto &text = m_boundStrings.emplace_back(
+                                           QString::number(number));
+                    result = sqlite3_bind_text16(
+                                 m_statement, parameter, text.utf16(),
+                                 static_cast<int>(text.size() * 2), SQLITE_STATIC);
+                }
+                else
+                    result = sqlite3_bind_int64(m_statement, parameter,
+                                                static_cast<qint64>(number));
+                break;
+
+            case QMetaType::Double:
+            case QMetaType::Float:
+                result = sqlite3_bind_double(m_statement, parameter,
+                                             value.value<double>());
+                break;
+
+            case QMetaType::QByteArray: {
+                const auto &blob = m_boundBlobs.emplace_back(value.value<QByteArray>());
+
+                // The nullptr data would bind the NULL
+                result = blob.isEmpty()
+                         ? sqlite3_bind_zeroblob(m_statement, parameter, 0)
+                         : sqlite3_bind_blob(m_statement, parameter, blob.constData(),
+                                             static_cast<int>(blob.size()),
+                                             SQLITE_STATIC);
+                break;
+            }
+            default: {
+                // The same date/time formats as the QSQLITE driver uses
+                const auto &text = m_boundStrings.emplace_back(
+                    [&value]
+                {
+                    switch (Helpers::qVariantTypeId(value)) {
+                    case QMetaType::QDateTime:
+                        return value.value<QDateTime>().toString(Qt::ISODateWithMs);
+                    case QMetaType::QDate:
+                        return value.value<QDate>().toString(Qt::ISODate);
+                    case QMetaType::QTime:
+                        return value.value<QTime>().toString(Qt::ISODateWithMs);
+                    default:
+                        return value.value<QString>();
+                    }
+                }());
+
+                result = sqlite3_bind_text16(m_statement, parameter, text.utf16(),
+                                             static_cast<int>(text.size() * 2),
+                                             SQLITE_STATIC);
+                break;
+            }
+            }
+
+        if (result != SQLITE_OK) {
+            setLastError(makeError(connection(),
+                                   QStringLiteral("Unable to bind parameters"),
+                                   QSqlError::StatementError, result));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool SQLite3Result::step()
+{
+    if (m_statement == nullptr) {
+        m_isDone = true;
+        return false;
+    }
+
+    switch (const auto result = sqlite3_step(m_statement); result) {
+    case SQLITE_ROW:
+        cacheRow();
+        return true;
+
+    case SQLITE_DONE:
+        m_isDone = true;
+
+        // Release the locks as soon as possible, the WAL readers depend on it
+        sqlite3_reset(m_statement);
+        return false;
+
+    default:
+        setLastError(makeError(connection(), QStringLiteral("Unable to fetch row"),
+                               QSqlError::StatementError, result));
+        m_isDone = true;
+
+        sqlite3_reset(m_statement);
+        return false;
+    }
+}
+
+void SQLite3Result::cacheRow()
+{
+    // Forward-only results keep only the current row, like the QSqlCachedResult
+    if (isForwardOnly() && !m_rows.empty()) {
+        m_rows.clear();
+        m_rowsOffset = m_steppedRows;
+    }
+
+    const auto columnCount = sqlite3_data_count(m_statement);
+
+    auto &row = m_rows.emplace_back();
+    row.values.reserve(columnCount);
+    row.nulls.reserve(columnCount);
+
+    for (auto index = 0; index < columnCount; ++index) {
+        row.nulls << (sqlite3_column_type(m_statement, index) == SQLITE_NULL);
+        row.values << columnValue(index);
+    }
+
+    ++m_steppedRows;
+}
+
+const SQLite3Result::CachedRow *SQLite3Result::currentRow() const
+{
+    const auto index = at() - m_rowsOffset;
+
+    if (at() < 0 || index < 0 || index >= static_cast<int>(m_rows.size()))
+        return nullptr;
+
+    return &m_rows[static_cast<std::size_t>(index)];
+}
+
+void SQLite3Result::clearRows()
+{
+    m_rows.clear();
+    m_rowsOffset = 0;
+    m_steppedRows = 0;
+}
+
+void SQLite3Result::releaseStatement()
+{
+    m_record.reset();
+    clearRows();
+    m_isDone = false;
+    m_rowsAffected = -1;
+
+    if (m_statement == nullptr)
+        return;
+
+    // The statement can be cached only on the connection it was prepared on
+    if (const auto *const driver_ = sqliteDriver();
+        connection() != nullptr && driver_->m_generation == m_generation
+    )
+        driver_->returnStatement(m_query, m_statement);
+    else
+        sqlite3_finalize(m_statement);
+
+    m_statement = nullptr;
+    m_query.clear();
+}
+
+} // namespace Orm::Drivers
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // TINYORM_SQLITE3_DRIVER
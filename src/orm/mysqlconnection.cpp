@@ -3,8 +3,10 @@
 #ifdef TINYORM_MYSQL_PING
 #  include <QDebug>
 #endif
+#include <QTemporaryFile>
 #include <QVersionNumber>
 #include <QtSql/QSqlDriver>
+#include <QtSql/QSqlRecord>
 
 #ifdef TINYORM_MYSQL_PING
 #  ifdef __MINGW32__
@@ -22,19 +24,86 @@ disable TINYORM_MYSQL_PING preprocessor directive.
 #  endif
 #endif
 
+#include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/query/grammars/mysqlgrammar.hpp"
 #include "orm/query/processors/mysqlprocessor.hpp"
 #include "orm/schema/grammars/mysqlschemagrammar.hpp"
 #include "orm/schema/mysqlschemabuilder.hpp"
 #include "orm/utils/configuration.hpp"
+#include "orm/utils/helpers.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
 using ConfigUtils = Orm::Utils::Configuration;
+using Helpers = Orm::Utils::Helpers;
 
 namespace Orm
 {
 
+namespace
+{
+    /*! Flush the LOAD DATA file buffer after it reaches this size (1MiB). */
+    constexpr QByteArray::size_type LoadDataBufferSize = 1024 * 1024;
+
+    /*! Append the given value escaped for the LOAD DATA ... ESCAPED BY '\\'. */
+    void appendLoadDataEscaped(QByteArray &buffer, const QByteArray &value)
+    {
+        for (const auto character : value)
+            switch (character) {
+            case '\\':
+                buffer.append("\\\\");
+                break;
+            case '\t':
+                buffer.append("\\t");
+                break;
+            case '\n':
+                buffer.append("\\n");
+                break;
+            case '\r':
+                buffer.append("\\r");
+                break;
+            case '\0':
+                buffer.append("\\0");
+                break;
+            default:
+                buffer.append(character);
+            }
+    }
+
+    /*! Append the given value to the LOAD DATA file buffer, the value must already
+        be prepared by the DatabaseConnection::prepareBindings(). */
+    void appendLoadDataValue(QByteArray &buffer, const QVariant &value)
+    {
+        // \N is the NULL value for the LOAD DATA
+        if (!value.isValid() || value.isNull()) {
+            buffer.append("\\N");
+            return;
+        }
+
+        switch (Helpers::qVariantTypeId(value)) {
+        case QMetaType::Bool:
+            buffer.append(value.value<bool>() ? '1' : '0');
+            break;
+
+        // Binary data are loaded as they are
+        case QMetaType::QByteArray:
+            appendLoadDataEscaped(buffer, value.value<QByteArray>());
+            break;
+
+        default:
+            appendLoadDataEscaped(buffer, value.value<QString>().toUtf8());
+        }
+    }
+
+    /*! Quote the given string as the MySQL string literal. */
+    QString quoteLoadDataString(QString value)
+    {
+        return QStringLiteral("'%1'")
+                .arg(value.replace(QLatin1Char('\\'), QStringLiteral("\\\\"))
+                          .replace(QLatin1Char('\''), QStringLiteral("\\'")));
+    }
+} // namespace
+
 /* private */
 
 MySqlConnection::MySqlConnection(
@@ -161,6 +230,55 @@ void MySqlConnection::setConfigVersion(const QString &value)
 }
 #endif
 
+/* Bulk loading */
+
+int MySqlConnection::loadData(const QString &table, const QVector<QString> &columns,
+                              const QVector<QVector<QVariant>> &rows)
+{
+    auto it = rows.cbegin();
+
+    return loadData(table, columns, [&it, end = rows.cend()](QVector<QVariant> &row)
+    {
+        if (it == end)
+            return false;
+
+        row = *it++;
+
+        return true;
+    });
+}
+
+int MySqlConnection::loadData(const QString &table, const QVector<QString> &columns,
+                              const LoadDataRowProducer &producer)
+{
+    if (columns.isEmpty())
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The columns list can't be empty in %1().")
+                .arg(__tiny_func__));
+
+    /* Rows are streamed to the temporary file in the LOAD DATA default format, so
+       the memory usage doesn't depend on the number of rows, the file is read
+       by the client library and sent to the server as one stream. */
+    QTemporaryFile file;
+
+    if (!file.open())
+        throw Exceptions::RuntimeError(
+                QStringLiteral("Can't create the temporary file for the LOAD DATA "
+                               "in %1(), %2.")
+                .arg(__tiny_func__, file.errorString()));
+
+    // Nothing to load
+    if (writeLoadDataFile(file, columns.size(), producer) == 0)
+        return 0;
+
+    // The file is removed by the QTemporaryFile destructor
+    file.close();
+
+    // The LOAD DATA statement can't be prepared
+    return unprepared(compileLoadData(table, columns, file.fileName()))
+            .numRowsAffected();
+}
+
 /* Others */
 
 bool MySqlConnection::pingDatabase()
@@ -267,6 +385,137 @@ std::unique_ptr<QueryProcessor> MySqlConnection::getDefaultPostProcessor() const
     return std::make_unique<Query::Processors::MySqlProcessor>();
 }
 
+QString MySqlConnection::compileStatementTimeout(
+        const std::optional<std::chrono::milliseconds> &timeout)
+{
+    // MariaDB's max_statement_time is in seconds and it's applied to all statements
+    if (isMaria())
+        return timeout
+                ? QStringLiteral("set session max_statement_time = %1")
+                  .arg(static_cast<double>(timeout->count()) / 1000.0)
+                : QStringLiteral("set session max_statement_time = default");
+
+    // MySQL's max_execution_time is applied to the read-only select statements only
+    return timeout
+            ? QStringLiteral("set session max_execution_time = %1")
+              .arg(timeout->count())
+            : QStringLiteral("set session max_execution_time = default");
+}
+
+QString MySqlConnection::compileCancelQuery(const QSqlDatabase &connection)
+{
+    QSqlQuery query(connection);
+
+    if (!query.exec(QStringLiteral("select connection_id()")) || !query.first())
+        return {};
+
+    return QStringLiteral("kill query %1").arg(query.value(0).value<quint64>());
+}
+
+bool MySqlConnection::supportsMultiStatementBatch()
+{
+    /* Multi-statements are disabled by default, they have to be enabled using
+       the CLIENT_MULTI_STATEMENTS connection option. */
+    return m_config.value(options_).value<QVariantHash>()
+                   .value(QStringLiteral("CLIENT_MULTI_STATEMENTS")).value<bool>();
+}
+
+std::optional<std::chrono::milliseconds>
+MySqlConnection::queryReplicaLag(const QSqlDatabase &connection)
+{
+    QSqlQuery query(connection);
+
+    // The SHOW REPLICA STATUS is supported since MySQL 8.0.22 and MariaDB 10.5.1
+    if (!query.exec(QStringLiteral("show replica status")) &&
+        !query.exec(QStringLiteral("show slave status"))
+    )
+        return std::nullopt;
+
+    // Not a replica
+    if (!query.first())
+        return std::chrono::milliseconds::zero();
+
+    // MariaDB and MySQL < 8.0.22 use the Seconds_Behind_Master column
+    const auto record = query.record();
+    auto index = record.indexOf(QStringLiteral("Seconds_Behind_Source"));
+
+    if (index == -1)
+        index = record.indexOf(QStringLiteral("Seconds_Behind_Master"));
+
+    // The replication SQL thread isn't running
+    if (index == -1 || query.isNull(index))
+        return std::nullopt;
+
+    return std::chrono::seconds(query.value(index).value<qint64>());
+}
+
+/* private */
+
+quint64 MySqlConnection::writeLoadDataFile(
+        QIODevice &file, const QVector<QString>::size_type columnsSize,
+        const LoadDataRowProducer &producer) const
+{
+    QByteArray buffer;
+    buffer.reserve(LoadDataBufferSize + 4096);
+
+    const auto flush = [&file, &buffer]
+    {
+        if (file.write(buffer) != buffer.size())
+            throw Exceptions::RuntimeError(
+                    QStringLiteral("Can't write to the temporary file for the LOAD DATA "
+                                   "in MySqlConnection::loadData(), %1.")
+                    .arg(file.errorString()));
+
+        buffer.clear();
+    };
+
+    QVector<QVariant> row;
+    row.reserve(columnsSize);
+    quint64 rowNumber = 0;
+
+    while (std::invoke(producer, row)) {
+        ++rowNumber;
+
+        if (row.size() != columnsSize)
+            throw Exceptions::InvalidArgumentError(
+                    QStringLiteral("The row %1 has %2 values but %3 columns were given "
+                                   "in MySqlConnection::loadData().")
+                    .arg(rowNumber).arg(row.size()).arg(columnsSize));
+
+        // QDate/QDateTime to strings, QDateTime is converted to the qt_timezone
+        prepareBindings(row);
+
+        for (QVector<QVariant>::size_type index = 0; index < columnsSize; ++index) {
+            if (index > 0)
+                buffer.append('\t');
+
+            appendLoadDataValue(buffer, row.at(index));
+        }
+
+        buffer.append('\n');
+
+        if (buffer.size() >= LoadDataBufferSize)
+            flush();
+    }
+
+    flush();
+
+    return rowNumber;
+}
+
+QString MySqlConnection::compileLoadData(
+        const QString &table, const QVector<QString> &columns,
+        const QString &fileName) const
+{
+    // The file is always written in the UTF-8, independently of the connection charset
+    return QStringLiteral("load data local infile %1 into table %2 "
+                          "character set utf8mb4 "
+                          "fields terminated by '\\t' escaped by '\\\\' "
+                          "lines terminated by '\\n' (%3)")
+            .arg(quoteLoadDataString(fileName), m_queryGrammar->wrapTable(table),
+                 m_queryGrammar->columnize(columns));
+}
+
 } // namespace Orm
 
 TINYORM_END_COMMON_NAMESPACE
@@ -1,17 +1,235 @@
 #include "orm/postgresconnection.hpp"
 
+#include <QtSql/QSqlDriver>
+#include <QtSql/QSqlError>
+
 #include <range/v3/view/move.hpp>
 
+#ifdef TINYORM_LIBPQ_DRIVER
+#  include <libpq-fe.h>
+#endif
+
+#include "orm/drivers/libpqdriver.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/exceptions/sqlerror.hpp"
 #include "orm/query/grammars/postgresgrammar.hpp"
 #include "orm/query/processors/postgresprocessor.hpp"
+#include "orm/query/querybuilder.hpp"
 #include "orm/schema/grammars/postgresschemagrammar.hpp"
 #include "orm/schema/postgresschemabuilder.hpp"
+#include "orm/utils/helpers.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
+using Helpers = Orm::Utils::Helpers;
+
 namespace Orm
 {
 
+namespace
+{
+    /*! Send the COPY data after the buffer reaches this size (1MiB). */
+    constexpr QByteArray::size_type CopyBufferSize = 1024 * 1024;
+
+    /*! Append the given value escaped for the COPY text format. */
+    void appendCopyEscaped(QByteArray &buffer, const QByteArray &value)
+    {
+        for (const auto character : value)
+            switch (character) {
+            case '\\':
+                buffer.append("\\\\");
+                break;
+            case '\t':
+                buffer.append("\\t");
+                break;
+            case '\n':
+                buffer.append("\\n");
+                break;
+            case '\r':
+                buffer.append("\\r");
+                break;
+            default:
+                buffer.append(character);
+            }
+    }
+
+    /*! Append the given value to the COPY data buffer, the value must already
+        be prepared by the DatabaseConnection::prepareBindings(). */
+    void appendCopyValue(QByteArray &buffer, const QVariant &value)
+    {
+        // \N is the NULL value for the COPY text format
+        if (!value.isValid() || value.isNull()) {
+            buffer.append("\\N");
+            return;
+        }
+
+        switch (Helpers::qVariantTypeId(value)) {
+        case QMetaType::Bool:
+            buffer.append(value.value<bool>() ? 't' : 'f');
+            break;
+
+        // The bytea hex format, the backslash itself has to be escaped
+        case QMetaType::QByteArray:
+            buffer.append("\\\\x").append(value.value<QByteArray>().toHex());
+            break;
+
+        default:
+            appendCopyEscaped(buffer, value.value<QString>().toUtf8());
+        }
+    }
+
+    /*! Parse the row in the COPY text format. */
+    QVector<QVariant> parseCopyRow(const QByteArray &data)
+    {
+        QVector<QVariant> row;
+        QByteArray value;
+        auto isNull = false;
+
+        // Every row ends with the newline
+        const auto end = data.endsWith('\n') ? data.size() - 1 : data.size();
+
+        for (QByteArray::size_type index = 0; index <= end; ++index) {
+            // End of the value
+            if (index == end || data.at(index) == '\t') {
+                row << (isNull ? QVariant() : QVariant(QString::fromUtf8(value)));
+
+                value.clear();
+                isNull = false;
+                continue;
+            }
+
+            const auto character = data.at(index);
+
+            if (character != '\\' || index + 1 == end) {
+                value.append(character);
+                continue;
+            }
+
+            switch (const auto escaped = data.at(++index); escaped) {
+            case 'N':
+                isNull = true;
+                break;
+            case 'b':
+                value.append('\b');
+                break;
+            case 'f':
+                value.append('\f');
+                break;
+            case 'n':
+                value.append('\n');
+                break;
+            case 'r':
+                value.append('\r');
+                break;
+            case 't':
+                value.append('\t');
+                break;
+            case 'v':
+                value.append('\v');
+                break;
+            default:
+                value.append(escaped);
+            }
+        }
+
+        return row;
+    }
+
+#ifdef TINYORM_LIBPQ_DRIVER
+    /*! Get the WITH clause for the given COPY format. */
+    QString copyFormatOptions(const PostgresConnection::CopyFormat format)
+    {
+        return format == PostgresConnection::CopyFormat::Binary
+                ? QStringLiteral(" with (format binary)")
+                : QString();
+    }
+
+    /*! Get the libpq connection handle of the given driver (QPSQL or the native). */
+    PGconn *pgConnection(const QSqlDriver &driver)
+    {
+        const auto handle = driver.handle();
+
+        if (dynamic_cast<const Drivers::LibPqDriver *>(&driver) != nullptr)
+            return static_cast<PGconn *>(handle.value<void *>());
+
+        if (qstrcmp(handle.typeName(), "PGconn*") == 0)
+            return *static_cast<PGconn *const *>(handle.constData());
+
+        throw Exceptions::RuntimeError(
+                "The database driver doesn't provide the libpq connection handle, "
+                "the COPY can't be used.");
+    }
+
+    /*! Create the QSqlError from the given result or from the connection. */
+    QSqlError copyError(PGconn *connection, const QString &message,
+                        const PGresult *result = nullptr)
+    {
+        if (result == nullptr)
+            return {message, QString::fromUtf8(PQerrorMessage(connection)).trimmed(),
+                    QSqlError::ConnectionError};
+
+        return {message, QString::fromUtf8(PQresultErrorMessage(result)).trimmed(),
+                QSqlError::StatementError,
+                QString::fromUtf8(PQresultErrorField(result, PG_DIAG_SQLSTATE))};
+    }
+
+    /*! Execute the COPY statement and check that the server is in the expected
+        COPY state. */
+    void startCopy(PGconn *connection, const QString &copyQuery,
+                   const ExecStatusType expected, const QString &message)
+    {
+        std::unique_ptr<PGresult, decltype (&PQclear)>
+        result(PQexec(connection, copyQuery.toUtf8().constData()), &PQclear);
+
+        if (PQresultStatus(result.get()) != expected)
+            throw Exceptions::SqlError(message,
+                                       copyError(connection, message, result.get()));
+    }
+
+    /*! Read all the COPY results, the connection can't be used until the last result
+        is read, returns the number of copied rows and the first error. */
+    std::pair<quint64, std::optional<QSqlError>>
+    readCopyResults(PGconn *connection, const QString &message)
+    {
+        quint64 rows = 0;
+        std::optional<QSqlError> error;
+
+        while (auto *result = PQgetResult(connection)) {
+            if (PQresultStatus(result) == PGRES_COMMAND_OK)
+                rows = QByteArray(PQcmdTuples(result)).toULongLong();
+            else if (!error)
+                error = copyError(connection, message, result);
+
+            PQclear(result);
+        }
+
+        return {rows, std::move(error)};
+    }
+
+    /*! Finish the COPY, returns the number of copied rows. */
+    quint64 finishCopy(PGconn *connection, const QString &message)
+    {
+        auto [rows, error] = readCopyResults(connection, message);
+
+        if (error)
+            throw Exceptions::SqlError(message, *error);
+
+        return rows;
+    }
+#else
+    /*! Throw the exception, the COPY needs the libpq library. */
+    [[noreturn]] void throwCopyDisabled()
+    {
+        throw Exceptions::RuntimeError(
+                "The COPY is disabled, if you want to use the "
+                "PostgresConnection::copyIn() or copyOut(), then reconfigure the TinyORM "
+                "project with the LIBPQ_DRIVER option ( -DLIBPQ_DRIVER=ON ) for cmake "
+                "or with the 'libpq_driver' configuration option "
+                "( \"CONFIG+=libpq_driver\" ) for qmake.");
+    }
+#endif
+} // namespace
+
 /* private */
 
 PostgresConnection::PostgresConnection(
@@ -74,6 +292,204 @@ QStringList PostgresConnection::searchPathRaw(const bool flushCache)
     return *(m_searchPath = searchPathRawDb());
 }
 
+/* COPY */
+
+quint64 PostgresConnection::copyIn(const QString &table, const QVector<QString> &columns,
+                                   const QVector<QVector<QVariant>> &rows)
+{
+    auto it = rows.cbegin();
+
+    return copyIn(table, columns, [&it, end = rows.cend()](QVector<QVariant> &row)
+    {
+        if (it == end)
+            return false;
+
+        row = *it++;
+
+        return true;
+    });
+}
+
+quint64 PostgresConnection::copyIn(const QString &table, const QVector<QString> &columns,
+                                   const CopyRowProducer &producer)
+{
+    QVector<QVariant> row;
+    row.reserve(columns.size());
+
+    quint64 rowNumber = 0;
+    auto finished = false;
+
+    /* Rows are sent in chunks in the COPY text format, so the memory usage doesn't
+       depend on the number of rows. */
+    return copyInRaw(table, columns, CopyFormat::Text,
+                     [this, &columns, &producer, &row, &rowNumber, &finished]
+                     (QByteArray &data)
+    {
+        data.clear();
+
+        while (!finished && data.size() < CopyBufferSize) {
+            if (!std::invoke(producer, row)) {
+                finished = true;
+                break;
+            }
+
+            ++rowNumber;
+
+            if (!columns.isEmpty() && row.size() != columns.size())
+                throw Exceptions::InvalidArgumentError(
+                        QStringLiteral("The row %1 has %2 values but %3 columns were "
+                                       "given in PostgresConnection::copyIn().")
+                        .arg(rowNumber).arg(row.size()).arg(columns.size()));
+
+            // QDate/QDateTime to strings, QDateTime is converted to the qt_timezone
+            prepareBindings(row);
+
+            for (QVector<QVariant>::size_type index = 0; index < row.size(); ++index) {
+                if (index > 0)
+                    data.append('\t');
+
+                appendCopyValue(data, row.at(index));
+            }
+
+            data.append('\n');
+        }
+
+        return !data.isEmpty();
+    });
+}
+
+quint64
+PostgresConnection::copyInRaw(
+        [[maybe_unused]] const QString &table,
+        [[maybe_unused]] const QVector<QString> &columns,
+        [[maybe_unused]] const CopyFormat format,
+        [[maybe_unused]] const CopyDataProducer &producer)
+{
+#ifdef TINYORM_LIBPQ_DRIVER
+    const auto copyQuery =
+            QStringLiteral("copy %1%2 from stdin%3")
+            .arg(m_queryGrammar->wrapTable(table),
+                 columns.isEmpty()
+                 ? QString()
+                 : QStringLiteral(" (%1)").arg(m_queryGrammar->columnize(columns)),
+                 copyFormatOptions(format));
+
+    return runDirect(copyQuery, true, [this, &copyQuery, &producer]
+    {
+        static const auto message =
+                QStringLiteral("COPY in PostgresConnection::copyIn() failed.");
+
+        auto *const connection = pgConnection(*driver());
+
+        startCopy(connection, copyQuery, PGRES_COPY_IN, message);
+
+        try {
+            QByteArray data;
+
+            while (std::invoke(producer, data))
+                if (!data.isEmpty() &&
+                    PQputCopyData(connection, data.constData(),
+                                  static_cast<int>(data.size())) != 1
+                )
+                    throw Exceptions::SqlError(message, copyError(connection, message));
+
+        } catch (...) {
+            // Abort the COPY, none of the sent rows are inserted
+            PQputCopyEnd(connection, "Aborted by the client");
+            readCopyResults(connection, message);
+
+            throw;
+        }
+
+        if (PQputCopyEnd(connection, nullptr) != 1)
+            throw Exceptions::SqlError(message, copyError(connection, message));
+
+        return finishCopy(connection, message);
+    });
+#else
+    throwCopyDisabled();
+#endif
+}
+
+quint64
+PostgresConnection::copyOut(const QString &query, const QVector<QVariant> &bindings,
+                            const CopyRowConsumer &consumer)
+{
+    // Every call returns exactly one row in the text format
+    return copyOutRaw(query, bindings, CopyFormat::Text,
+                      [&consumer](const QByteArray &data)
+    {
+        std::invoke(consumer, parseCopyRow(data));
+    });
+}
+
+quint64 PostgresConnection::copyOut(QueryBuilder &query, const CopyRowConsumer &consumer)
+{
+    return copyOut(query.toSql(), query.getBindings(), consumer);
+}
+
+quint64
+PostgresConnection::copyOutRaw(
+        [[maybe_unused]] const QString &query,
+        [[maybe_unused]] const QVector<QVariant> &bindings,
+        [[maybe_unused]] const CopyFormat format,
+        [[maybe_unused]] const CopyDataConsumer &consumer)
+{
+#ifdef TINYORM_LIBPQ_DRIVER
+    // The COPY can't be prepared, the bindings are formatted and escaped by the driver
+    auto preparedBindings = bindings;
+    prepareBindings(preparedBindings);
+
+    const auto copyQuery =
+            QStringLiteral("copy (%1) to stdout%2")
+            .arg(inlineBindings(query, preparedBindings, *driver(), QPSQL),
+                 copyFormatOptions(format));
+
+    return runDirect(copyQuery, false, [this, &copyQuery, &consumer]
+    {
+        static const auto message =
+                QStringLiteral("COPY in PostgresConnection::copyOut() failed.");
+
+        auto *const connection = pgConnection(*driver());
+
+        startCopy(connection, copyQuery, PGRES_COPY_OUT, message);
+
+        char *buffer = nullptr;
+        int size = 0;
+
+        try {
+            while ((size = PQgetCopyData(connection, &buffer, 0)) > 0) {
+                const QByteArray data(buffer, size);
+                PQfreemem(buffer);
+
+                std::invoke(consumer, data);
+            }
+
+        } catch (...) {
+            // The COPY can't be aborted, read and discard the rest of the data
+            while ((size = PQgetCopyData(connection, &buffer, 0)) > 0)
+                PQfreemem(buffer);
+
+            readCopyResults(connection, message);
+
+            throw;
+        }
+
+        // -1 if the COPY is done, -2 if an error occurred
+        if (size == -2) {
+            auto error = copyError(connection, message);
+            readCopyResults(connection, message);
+
+            throw Exceptions::SqlError(message, error);
+        }
+
+        return finishCopy(connection, message);
+    });
+#else
+    throwCopyDisabled();
+#endif
+}
+
 /* protected */
 
 std::unique_ptr<QueryGrammar> PostgresConnection::getDefaultQueryGrammar() const
@@ -106,6 +522,64 @@ std::unique_ptr<QueryProcessor> PostgresConnection::getDefaultPostProcessor() co
     return std::make_unique<Query::Processors::PostgresProcessor>();
 }
 
+QString PostgresConnection::compileStatementTimeout(
+        const std::optional<std::chrono::milliseconds> &timeout)
+{
+    return timeout
+            ? QStringLiteral("set statement_timeout = %1").arg(timeout->count())
+            : QStringLiteral("set statement_timeout to default");
+}
+
+QString PostgresConnection::compileCancelQuery(const QSqlDatabase &connection)
+{
+    QSqlQuery query(connection);
+
+    if (!query.exec(QStringLiteral("select pg_backend_pid()")) || !query.first())
+        return {};
+
+    return QStringLiteral("select pg_cancel_backend(%1)")
+            .arg(query.value(0).value<qint64>());
+}
+
+bool PostgresConnection::supportsMultiStatementBatch()
+{
+    /* The QPSQL driver returns only the last result of the multi-statement query,
+       the native libpq driver returns all of them. */
+    return getQtConnection().driver()->hasFeature(QSqlDriver::MultipleResultSets);
+}
+
+std::optional<std::chrono::milliseconds>
+PostgresConnection::queryReplicaLag(const QSqlDatabase &connection)
+{
+    /* The replay timestamp doesn't move if the primary is idle, so the replica that
+       has replayed everything it has received isn't lagging. It's true only while
+       the WAL receiver is streaming, the disconnected replica has replayed all it
+       has received too but it doesn't receive anything new. */
+    QSqlQuery query(connection);
+
+    if (!query.exec(QStringLiteral(
+                        "select case "
+                          "when not pg_is_in_recovery() then 0 "
+                          "when pg_last_wal_receive_lsn() = pg_last_wal_replay_lsn() "
+                            "and exists (select 1 from pg_stat_wal_receiver "
+                                        "where status = 'streaming') "
+                            "then 0 "
+                          "else (extract(epoch from now() - "
+                                "pg_last_xact_replay_timestamp()) * 1000)::bigint "
+                        "end")) ||
+        !query.first()
+    )
+        return std::nullopt;
+
+    const auto lag = query.value(0);
+
+    // Nothing was replayed yet
+    if (lag.isNull())
+        return std::nullopt;
+
+    return std::chrono::milliseconds(lag.value<qint64>());
+}
+
 /* private */
 
 QStringList PostgresConnection::searchPathRawForPretending() const
@@ -1,14 +1,61 @@
 #include "orm/query/grammars/grammar.hpp"
 
+#include <algorithm>
+
 #include "orm/databaseconnection.hpp"
+#include "orm/exceptions/runtimeerror.hpp"
 #include "orm/macros/likely.hpp"
 #include "orm/query/joinclause.hpp"
+#include "orm/utils/helpers.hpp"
+#include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
+using Helpers = Orm::Utils::Helpers;
+using TypeUtils = Orm::Utils::Type;
+
 namespace Orm::Query::Grammars
 {
 
+namespace
+{
+    /*! Determine whether the given value can be an element of the array binding. */
+    bool isInArrayBindable(const QVariant &value)
+    {
+        if (!value.isValid() || value.isNull())
+            return true;
+
+        switch (Helpers::qVariantTypeId(value)) {
+        case QMetaType::Short:
+        case QMetaType::UShort:
+        case QMetaType::Int:
+        case QMetaType::UInt:
+        case QMetaType::Long:
+        case QMetaType::ULong:
+        case QMetaType::LongLong:
+        case QMetaType::ULongLong:
+        case QMetaType::QString:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+    /*! Join the integer values converted by the Builder::whereIntegerInRaw(). */
+    QString inlineIntegers(const QVector<QVariant> &values)
+    {
+        QStringList integers;
+        integers.reserve(values.size());
+
+        for (const auto &value : values)
+            integers << (value.isNull() ? QStringLiteral("null")
+                                        : value.value<QString>());
+
+        return integers.join(COMMA);
+    }
+} // namespace
+
 /* public */
 
 QString Grammar::compileSelect(QueryBuilder &query) const
@@ -160,6 +207,61 @@ const QVector<QString> &Grammar::getOperators() const
     return cachedOperators;
 }
 
+bool Grammar::sortsNullsLast() const
+{
+    // MySQL and SQLite sort null values first in the ascending order
+    return false;
+}
+
+/* Array binding of the "where in" values */
+
+Grammar &Grammar::setInArrayThreshold(const std::size_t threshold) noexcept
+{
+    m_inArrayThreshold = threshold;
+
+    return *this;
+}
+
+bool Grammar::shouldBindInArray(const QVector<QVariant> &values) const
+{
+    /* Expressions and values that can't be represented as the array element
+       (eg. QDateTime that has to be converted to the qt_timezone) are bound
+       one by one. */
+    return m_inArrayThreshold > 0 &&
+           static_cast<std::size_t>(values.size()) >= m_inArrayThreshold &&
+           supportsInArrayBinding() &&
+           std::ranges::all_of(values, isInArrayBindable);
+}
+
+QVariant Grammar::prepareInArrayBinding(const QVector<QVariant> &/*unused*/) const
+{
+    throw Exceptions::RuntimeError(
+                QStringLiteral("The '%1' grammar doesn't support the array binding "
+                               "of the \"where in\" values in %2().")
+                .arg(TypeUtils::classPureBasename(*this), __tiny_func__));
+}
+
+/* Bound parameters limit */
+
+std::size_t Grammar::getMaxBindings() const
+{
+    return m_maxBindings == 0 ? getDefaultMaxBindings() : m_maxBindings;
+}
+
+Grammar &Grammar::setMaxBindings(const std::size_t maxBindings) noexcept
+{
+    m_maxBindings = maxBindings;
+
+    return *this;
+}
+
+std::size_t Grammar::getInsertChunkSize(const std::size_t columnsCount) const
+{
+    const auto rows = getMaxBindings() / std::max<std::size_t>(columnsCount, 1);
+
+    return std::clamp<std::size_t>(rows, 1, MaxInsertChunkSize);
+}
+
 /* protected */
 
 bool Grammar::shouldCompileAggregate(const std::optional<AggregateItem> &aggregate)
@@ -424,6 +526,10 @@ QString Grammar::whereIn(const WhereConditionItem &where) const
     if (where.values.isEmpty())
         return QStringLiteral("0 = 1");
 
+    // The same decision as in the Builder::whereIn() that added the bindings
+    if (shouldBindInArray(where.values))
+        return whereInArray(where, false);
+
     return QStringLiteral("%1 in (%2)").arg(wrap(where.column),
                                             parametrize(where.values));
 }
@@ -433,10 +539,49 @@ QString Grammar::whereNotIn(const WhereConditionItem &where) const
     if (where.values.isEmpty())
         return QStringLiteral("1 = 1");
 
+    if (shouldBindInArray(where.values))
+        return whereInArray(where, true);
+
     return QStringLiteral("%1 not in (%2)").arg(wrap(where.column),
                                                 parametrize(where.values));
 }
 
+bool Grammar::supportsInArrayBinding() const
+{
+    return false;
+}
+
+QString Grammar::whereInArray(const WhereConditionItem &/*unused*/,
+                              const bool /*unused*/) const
+{
+    // Guarded by the supportsInArrayBinding()
+    Q_UNREACHABLE();
+}
+
+std::size_t Grammar::getDefaultMaxBindings() const
+{
+    // The MySQL and PostgreSQL protocols send the number of parameters as uint16
+    return 65535;
+}
+
+QString Grammar::whereInRaw(const WhereConditionItem &where) const
+{
+    if (where.values.isEmpty())
+        return QStringLiteral("0 = 1");
+
+    return QStringLiteral("%1 in (%2)").arg(wrap(where.column),
+                                            inlineIntegers(where.values));
+}
+
+QString Grammar::whereNotInRaw(const WhereConditionItem &where) const
+{
+    if (where.values.isEmpty())
+        return QStringLiteral("1 = 1");
+
+    return QStringLiteral("%1 not in (%2)").arg(wrap(where.column),
+                                                inlineIntegers(where.values));
+}
+
 QString Grammar::whereNull(const WhereConditionItem &where) const
 {
     return QStringLiteral("%1 is null").arg(wrap(where.column));
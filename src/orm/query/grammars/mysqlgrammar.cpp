@@ -178,6 +178,8 @@ MySqlGrammar::getWhereMethod(const WhereType whereType) const
         bind(&MySqlGrammar::whereColumn),
         bind(&MySqlGrammar::whereIn),
         bind(&MySqlGrammar::whereNotIn),
+        bind(&MySqlGrammar::whereInRaw),
+        bind(&MySqlGrammar::whereNotInRaw),
         bind(&MySqlGrammar::whereNull),
         bind(&MySqlGrammar::whereNotNull),
         bind(&MySqlGrammar::whereRaw),
@@ -1,9 +1,12 @@
 #include "orm/query/grammars/postgresgrammar.hpp"
 
 #include "orm/query/querybuilder.hpp"
+#include "orm/utils/helpers.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
+using Orm::Utils::Helpers;
+
 namespace Orm::Query::Grammars
 {
 
@@ -93,6 +96,46 @@ const QVector<QString> &PostgresGrammar::getOperators() const
     return cachedOperators;
 }
 
+bool PostgresGrammar::sortsNullsLast() const
+{
+    // NULLS LAST is the default for the ascending order
+    return true;
+}
+
+QVariant
+PostgresGrammar::prepareInArrayBinding(const QVector<QVariant> &values) const
+{
+    /* The array literal, its type is inferred from the compared column on the server,
+       so the same literal works for the integer, text, or uuid columns. */
+    QString array;
+    array.reserve(2 + (values.size() * 8));
+
+    array += QLatin1Char('{');
+
+    for (QVector<QVariant>::size_type index = 0; index < values.size(); ++index) {
+        if (index > 0)
+            array += COMMA_C;
+
+        const auto &value = values.at(index);
+
+        if (!value.isValid() || value.isNull())
+            array += QStringLiteral("NULL");
+
+        // Strings are always quoted so the NULL string or commas are not special
+        else if (Helpers::qVariantTypeId(value) == QMetaType::QString)
+            array += QStringLiteral("\"%1\"")
+                     .arg(value.value<QString>()
+                          .replace(QLatin1Char('\\'), QStringLiteral("\\\\"))
+                          .replace(QLatin1Char('"'), QStringLiteral("\\\"")));
+        else
+            array += value.value<QString>();
+    }
+
+    array += QLatin1Char('}');
+
+    return array;
+}
+
 QString PostgresGrammar::whereBasic(const WhereConditionItem &where) const
 {
     if (!where.comparison.contains(LIKE, Qt::CaseInsensitive))
@@ -185,6 +228,8 @@ PostgresGrammar::getWhereMethod(const WhereType whereType) const
         bind(&PostgresGrammar::whereColumn),
         bind(&PostgresGrammar::whereIn),
         bind(&PostgresGrammar::whereNotIn),
+        bind(&PostgresGrammar::whereInRaw),
+        bind(&PostgresGrammar::whereNotInRaw),
         bind(&PostgresGrammar::whereNull),
         bind(&PostgresGrammar::whereNotNull),
         bind(&PostgresGrammar::whereRaw),
@@ -264,6 +309,20 @@ QString PostgresGrammar::compileUpdateColumns(const QVector<UpdateItem> &values)
     return columnizeWithoutWrap(compiledAssignments);
 }
 
+bool PostgresGrammar::supportsInArrayBinding() const
+{
+    return true;
+}
+
+QString PostgresGrammar::whereInArray(const WhereConditionItem &where,
+                                      const bool nope) const
+{
+    /* One parameter for any number of values, so the query string and the cached
+       query plan don't depend on the number of values. */
+    return nope ? QStringLiteral("%1 <> all(?)").arg(wrap(where.column))
+                : QStringLiteral("%1 = any(?)").arg(wrap(where.column));
+}
+
 /* private */
 
 QString PostgresGrammar::compileUpdateWithJoinsOrLimit(
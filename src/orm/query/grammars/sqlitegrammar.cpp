@@ -82,6 +82,54 @@ const QVector<QString> &SQLiteGrammar::getOperators() const
     return cachedOperators;
 }
 
+QVariant SQLiteGrammar::prepareInArrayBinding(const QVector<QVariant> &values) const
+{
+    // The JSON array, expanded to rows by the json_each() table-valued function
+    QString array;
+    array.reserve(2 + (values.size() * 8));
+
+    array += QLatin1Char('[');
+
+    for (QVector<QVariant>::size_type index = 0; index < values.size(); ++index) {
+        if (index > 0)
+            array += COMMA_C;
+
+        const auto &value = values.at(index);
+
+        if (!value.isValid() || value.isNull()) {
+            array += QStringLiteral("null");
+            continue;
+        }
+
+        if (Helpers::qVariantTypeId(value) != QMetaType::QString) {
+            array += value.value<QString>();
+            continue;
+        }
+
+        array += QLatin1Char('"');
+
+        for (const auto character : value.value<QString>()) {
+            if (character == QLatin1Char('"') || character == QLatin1Char('\\'))
+                array += QLatin1Char('\\');
+
+            // Control characters have to be escaped
+            else if (character.unicode() < 0x20) {
+                array += QStringLiteral("\\u%1")
+                         .arg(character.unicode(), 4, 16, QLatin1Char('0'));
+                continue;
+            }
+
+            array += character;
+        }
+
+        array += QLatin1Char('"');
+    }
+
+    array += QLatin1Char(']');
+
+    return array;
+}
+
 /* protected */
 
 const QMap<Grammar::SelectComponentType, Grammar::SelectComponentValue> &
@@ -163,6 +211,8 @@ SQLiteGrammar::getWhereMethod(const WhereType whereType) const
         bind(&SQLiteGrammar::whereColumn),
         bind(&SQLiteGrammar::whereIn),
         bind(&SQLiteGrammar::whereNotIn),
+        bind(&SQLiteGrammar::whereInRaw),
+        bind(&SQLiteGrammar::whereNotInRaw),
         bind(&SQLiteGrammar::whereNull),
         bind(&SQLiteGrammar::whereNotNull),
         bind(&SQLiteGrammar::whereRaw),
@@ -258,6 +308,28 @@ QString SQLiteGrammar::compileUpdateColumns(const QVector<UpdateItem> &values) c
     return columnizeWithoutWrap(compiledAssignments);
 }
 
+bool SQLiteGrammar::supportsInArrayBinding() const
+{
+    return true;
+}
+
+QString SQLiteGrammar::whereInArray(const WhereConditionItem &where,
+                                    const bool nope) const
+{
+    /* One parameter for any number of values, it also avoids the SQLite's limit
+       of the number of bound parameters. */
+    return QStringLiteral("%1 %2 (select value from json_each(?))")
+            .arg(wrap(where.column),
+                 nope ? QStringLiteral("not in") : QStringLiteral("in"));
+}
+
+std::size_t SQLiteGrammar::getDefaultMaxBindings() const
+{
+    /* The SQLITE_MAX_VARIABLE_NUMBER default since the SQLite 3.32, older versions
+       have 999, it can be lowered using the max_bindings configuration option. */
+    return 32766;
+}
+
 /* private */
 
 QString
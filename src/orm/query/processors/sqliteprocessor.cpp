@@ -13,7 +13,7 @@ namespace Orm::Query::Processors
 QStringList SQLiteProcessor::processColumnListing(SqlQuery &query) const
 {
     QStringList columns;
-    columns.reserve(QueryUtils::queryResultSize(query));
+    columns.reserve(QueryUtils::queryResultSizeHint(query));
 
     while (query.next())
         columns << query.value(NAME).value<QString>();
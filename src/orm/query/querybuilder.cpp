@@ -2,12 +2,16 @@
 
 #include <QDebug>
 
+#include <algorithm>
+
 #include <range/v3/view/remove_if.hpp>
 
 #include "orm/databaseconnection.hpp"
+#include "orm/databasemanager.hpp"
 #include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/macros/likely.hpp"
 #include "orm/query/joinclause.hpp"
+#include "orm/support/scattergather.hpp"
 #include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -36,6 +40,103 @@ SqlQuery Builder::get(const QVector<Column> &columns)
     });
 }
 
+SqlQuery Builder::cursor(const QVector<Column> &columns)
+{
+    return onceWithColumns(columns, [this]
+    {
+        return runWithTimeout([this]
+        {
+            return m_connection->cursor(toSql(), getBindings(), !m_useWriteConnection);
+        });
+    });
+}
+
+QVector<QSqlRecord>
+Builder::onConnections(const QStringList &connections, const QVector<Column> &columns)
+{
+    auto indexed = onConnectionsIndexed(connections, columns);
+
+    QVector<QSqlRecord> records;
+    records.reserve(indexed.size());
+
+    for (auto &indexedRecord : indexed)
+        records << std::move(indexedRecord.second);
+
+    return records;
+}
+
+QVector<Support::ScatterGather::IndexedRecord>
+Builder::onConnectionsIndexed(const QStringList &connections,
+                              const QVector<Column> &columns)
+{
+    // Save orignal columns, limit, and offset
+    auto original = m_columns;
+    const auto limit = m_limit;
+    const auto offset = m_offset;
+
+    if (original.isEmpty())
+        m_columns = columns;
+
+    /* LIMIT pushdown, every connection returns at most offset + limit rows and
+       the offset is applied after the results are merged. */
+    if (offset > 0) {
+        if (limit > -1)
+            m_limit = limit + offset;
+
+        m_offset = -1;
+    }
+
+    auto queryString = toSql();
+    const auto bindings = getBindings();
+
+    m_columns = std::move(original);
+    m_limit = limit;
+    m_offset = offset;
+
+    auto records = Support::ScatterGather::mergeSortedIndexed(
+                       Support::ScatterGather::select(
+                           DatabaseManager::reference(), connections, queryString,
+                           bindings,
+                           {m_useWriteConnection, m_timeout, m_maxStaleness}),
+                       m_orders, m_grammar->sortsNullsLast());
+
+    // Nothing to slice
+    if (offset <= 0 && (limit <= -1 || records.size() <= limit))
+        return records;
+
+    return records.mid(std::max(0, offset), limit);
+}
+
+#ifdef T_COROUTINES
+AsyncQuery<QVector<QSqlRecord>> Builder::getAsync(const QVector<Column> &columns)
+{
+    // Save orignal columns
+    auto original = m_columns;
+
+    if (original.isEmpty())
+        m_columns = columns;
+
+    // The query is compiled in the current thread, the query builder isn't thread-safe
+    auto queryString = toSql();
+    auto bindings = getBindings();
+
+    m_columns = std::move(original);
+
+    auto &manager = DatabaseManager::reference();
+    /* The pooled connection has its own name that isn't registered
+       in the DatabaseManager, the query is executed on its connection pool. */
+    const auto &connection = m_connection->getPoolName().isEmpty()
+                             ? m_connection->getName()
+                             : m_connection->getPoolName();
+
+    if (m_useWriteConnection)
+        return manager.selectFromWriteConnectionAsync(queryString, std::move(bindings),
+                                                      connection);
+
+    return manager.selectAsync(queryString, std::move(bindings), connection);
+}
+#endif
+
 SqlQuery Builder::find(const QVariant &id, const QVector<Column> &columns)
 {
     return where(ID, EQ, id).first(columns);
@@ -113,19 +214,15 @@ QVector<QVariant> Builder::pluck(const Column &column)
        and get the exact data that was requested for the query. */
     auto query = get({column});
 
-    const auto size = QueryUtils::queryResultSize(query);
-
-    // Empty result
-    if (size == 0)
-        return {};
-
     /* If the column is qualified with a table or have an alias, we cannot use
        those directly in the "pluck" operations, we have to strip the table out or
        use the alias name instead. */
     const auto unqualifiedColumn = stripTableForPluck(column);
 
     QVector<QVariant> result;
-    result.reserve(size);
+    // Don't count rows (SQLite), the result grows geometrically
+    result.reserve(m_sizeHint > 0 ? m_sizeHint
+                                  : QueryUtils::queryResultSizeHint(query));
 
     while (query.next())
         result << query.value(unqualifiedColumn);
@@ -185,8 +282,30 @@ Builder::insert(const QVector<QVariantMap> &values)
        in the same order for the record. We need to make sure this is the case
        so there are not any errors or problems when inserting these records. */
 
-    return m_connection->insert(m_grammar->compileInsert(*this, values),
-                                cleanBindings(flatValuesForInsert(values)));
+    const auto chunkSize = insertChunkSize(values);
+
+    if (values.size() <= chunkSize)
+        return m_connection->insert(m_grammar->compileInsert(*this, values),
+                                    cleanBindings(flatValuesForInsert(values)));
+
+    /* Too many rows for one statement (bound parameters limit), insert them using
+       more statements in one transaction, the last query is returned. */
+    std::optional<SqlQuery> query;
+
+    m_connection->transaction([this, &values, chunkSize, &query]
+                              (DatabaseConnection &connection)
+    {
+        for (QVector<QVariantMap>::size_type offset = 0; offset < values.size();
+             offset += chunkSize
+        ) {
+            const auto chunk = values.mid(offset, chunkSize);
+
+            query = connection.insert(m_grammar->compileInsert(*this, chunk),
+                                      cleanBindings(flatValuesForInsert(chunk)));
+        }
+    });
+
+    return query;
 }
 
 std::optional<SqlQuery>
@@ -221,9 +340,35 @@ Builder::insertOrIgnore(const QVector<QVariantMap> &values)
     if (values.isEmpty())
         return {0, std::nullopt};
 
-    return m_connection->affectingStatement(
-                m_grammar->compileInsertOrIgnore(*this, values),
-                cleanBindings(flatValuesForInsert(values)));
+    const auto chunkSize = insertChunkSize(values);
+
+    if (values.size() <= chunkSize)
+        return m_connection->affectingStatement(
+                    m_grammar->compileInsertOrIgnore(*this, values),
+                    cleanBindings(flatValuesForInsert(values)));
+
+    // The same as in the insert(), the affected rows are summed up
+    int affected = 0;
+    std::optional<QSqlQuery> query;
+
+    m_connection->transaction([this, &values, chunkSize, &affected, &query]
+                              (DatabaseConnection &connection)
+    {
+        for (QVector<QVariantMap>::size_type offset = 0; offset < values.size();
+             offset += chunkSize
+        ) {
+            const auto chunk = values.mid(offset, chunkSize);
+
+            auto [chunkAffected, chunkQuery] = connection.affectingStatement(
+                    m_grammar->compileInsertOrIgnore(*this, chunk),
+                    cleanBindings(flatValuesForInsert(chunk)));
+
+            affected += chunkAffected;
+            query = std::move(chunkQuery);
+        }
+    });
+
+    return {affected, std::move(query)};
 }
 
 std::tuple<int, std::optional<QSqlQuery>>
@@ -366,7 +511,11 @@ QVariant Builder::aggregate(const QString &function,
 
 bool Builder::exists()
 {
-    auto results = m_connection->select(m_grammar->compileExists(*this), getBindings());
+    auto results = runWithTimeout([this]
+    {
+        return m_connection->select(m_grammar->compileExists(*this), getBindings(),
+                                    !m_useWriteConnection);
+    });
 
     /* If the results have rows, we will get the row and see if the exists column is a
        boolean true. If there are no results for this query we will return false as
@@ -645,14 +794,67 @@ Builder &Builder::orWhereColumnEq(const Column &first, const Column &second)
 
 /* where IN */
 
+namespace
+{
+    /*! Determine whether all the given values are integers (or nulls). */
+    bool allIntegers(const QVector<QVariant> &values)
+    {
+        return std::ranges::all_of(values, [](const QVariant &value)
+        {
+            if (!value.isValid() || value.isNull())
+                return true;
+
+            switch (Helpers::qVariantTypeId(value)) {
+            case QMetaType::Short:
+            case QMetaType::UShort:
+            case QMetaType::Int:
+            case QMetaType::UInt:
+            case QMetaType::Long:
+            case QMetaType::ULong:
+            case QMetaType::LongLong:
+            case QMetaType::ULongLong:
+                return true;
+
+            default:
+                return false;
+            }
+        });
+    }
+} // namespace
+
 Builder &Builder::whereIn(const Column &column, const QVector<QVariant> &values,
                           const QString &condition, const bool nope)
 {
+    /* The values would exceed the bound parameters limit, integers can be inlined
+       into the query string instead (no parameters), other values can't be sent. */
+    if (const auto maxBindings = m_grammar->getMaxBindings();
+        static_cast<std::size_t>(values.size()) > maxBindings &&
+        !m_grammar->shouldBindInArray(values)
+    ) {
+        if (allIntegers(values))
+            return whereIntegerInRaw(column, values, condition, nope);
+
+        if (const auto bindingsSize = cleanBindings(values).size();
+            static_cast<std::size_t>(bindingsSize) > maxBindings
+        )
+            throw Exceptions::InvalidArgumentError(
+                    QStringLiteral(
+                        "The \"where in\" clause has %1 values to bind, it exceeds "
+                        "the bound parameters limit of %2, only integer values can be "
+                        "inlined into the query in %3().")
+                    .arg(bindingsSize).arg(maxBindings).arg(__tiny_func__));
+    }
+
     const auto type = nope ? WhereType::NOT_IN : WhereType::IN_;
 
     m_wheres.append({.column = column, .condition = condition, .type = type,
                      .values = values});
 
+    /* Large lists of values are bound as one array parameter if the grammar supports
+       it, so the query string doesn't depend on the number of values. */
+    if (m_grammar->shouldBindInArray(values))
+        return addBinding(m_grammar->prepareInArrayBinding(values), BindingType::WHERE);
+
     /* Finally we'll add a binding for each values unless that value is an expression
        in which case we will just skip over it since it will be the query as a raw
        string and not as a parameterized place-holder to be replaced by the DB driver. */
@@ -677,6 +879,91 @@ Builder &Builder::orWhereNotIn(const Column &column, const QVector<QVariant> &va
     return whereNotIn(column, values, OR);
 }
 
+/* where IN raw */
+
+namespace
+{
+    /*! Convert the given value to the integer that can be inlined into the query. */
+    QVariant toIntegerValue(const QVariant &value)
+    {
+        // The null can be inlined too, it has the same meaning as in the whereIn()
+        if (!value.isValid() || value.isNull())
+            return {};
+
+        auto ok = false;
+        QVariant integer;
+
+        /* Non-integral types (eg. the 1.5 double) would be silently truncated
+           by the toLongLong(), so they are rejected, strings are parsed strictly. */
+        switch (Helpers::qVariantTypeId(value)) {
+        case QMetaType::UShort:
+        case QMetaType::UInt:
+        case QMetaType::ULong:
+        case QMetaType::ULongLong:
+            integer = value.toULongLong(&ok);
+            break;
+
+        case QMetaType::Short:
+        case QMetaType::Int:
+        case QMetaType::Long:
+        case QMetaType::LongLong:
+        case QMetaType::QString:
+        case QMetaType::QByteArray:
+            integer = value.toLongLong(&ok);
+            break;
+
+        default:
+            break;
+        }
+
+        if (ok)
+            return integer;
+
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The '%1' value can't be converted to the integer, only "
+                               "integer values can be inlined into the query in %2().")
+                .arg(value.value<QString>(), __tiny_func__));
+    }
+} // namespace
+
+Builder &Builder::whereIntegerInRaw(const Column &column, const QVector<QVariant> &values,
+                                    const QString &condition, const bool nope)
+{
+    const auto type = nope ? WhereType::NOT_IN_RAW : WhereType::IN_RAW;
+
+    /* The values are inlined into the query string, so they have to be converted
+       to integers, it avoids the SQL injection and no bindings are needed. */
+    QVector<QVariant> integerValues;
+    integerValues.reserve(values.size());
+
+    for (const auto &value : values)
+        integerValues << toIntegerValue(value);
+
+    m_wheres.append({.column = column, .condition = condition, .type = type,
+                     .values = std::move(integerValues)});
+
+    return *this;
+}
+
+Builder &Builder::orWhereIntegerInRaw(const Column &column,
+                                      const QVector<QVariant> &values)
+{
+    return whereIntegerInRaw(column, values, OR);
+}
+
+Builder &Builder::whereIntegerNotInRaw(const Column &column,
+                                       const QVector<QVariant> &values,
+                                       const QString &condition)
+{
+    return whereIntegerInRaw(column, values, condition, true);
+}
+
+Builder &Builder::orWhereIntegerNotInRaw(const Column &column,
+                                         const QVector<QVariant> &values)
+{
+    return whereIntegerInRaw(column, values, OR, true);
+}
+
 /* where null */
 
 Builder &Builder::whereNull(const QVector<Column> &columns, const QString &condition,
@@ -1155,11 +1442,8 @@ Builder &Builder::lock(const bool value)
 {
     m_lock = value;
 
-    // FEATURE read/write connection silverqx
-//    if (! is_null($this->lock))
-//        useWritePdo();
-
-    return *this;
+    // Locking reads have to be sent to the primary (write) database server
+    return useWriteConnection();
 }
 
 Builder &Builder::lock(const char *value)
@@ -1169,20 +1453,48 @@ Builder &Builder::lock(const char *value)
        https://stackoverflow.com/questions/14770252/string-literal-matches-bool-overload-instead-of-stdstring */
     m_lock = QString(value);
 
-    return *this;
+    return useWriteConnection();
 }
 
 Builder &Builder::lock(const QString &value)
 {
     m_lock = value;
 
-    return *this;
+    return useWriteConnection();
 }
 
 Builder &Builder::lock(QString &&value)
 {
     m_lock = std::move(value);
 
+    return useWriteConnection();
+}
+
+Builder &Builder::useWriteConnection() noexcept
+{
+    m_useWriteConnection = true;
+
+    return *this;
+}
+
+Builder &Builder::sizeHint(const int rows) noexcept
+{
+    m_sizeHint = rows;
+
+    return *this;
+}
+
+Builder &Builder::timeout(const std::chrono::milliseconds timeout) noexcept
+{
+    m_timeout = timeout;
+
+    return *this;
+}
+
+Builder &Builder::maxStaleness(const std::chrono::milliseconds staleness) noexcept
+{
+    m_maxStaleness = staleness;
+
     return *this;
 }
 
@@ -1224,6 +1536,14 @@ const QString &Builder::defaultKeyName() const noexcept // NOLINT(readability-co
     return ID;
 }
 
+Builder &Builder::setConnection(DatabaseConnection &connection)
+{
+    m_connection = connection.shared_from_this();
+    m_grammar = connection.getQueryGrammarShared();
+
+    return *this;
+}
+
 QVector<QVariant> Builder::getBindings() const
 {
     QVector<QVariant> flattenBindings;
@@ -1686,7 +2006,34 @@ Builder &Builder::setAggregate(const QString &function, const QVector<Column> &c
 
 SqlQuery Builder::runSelect()
 {
-    return m_connection->select(toSql(), getBindings());
+    return runWithTimeout([this]
+    {
+        return m_connection->select(toSql(), getBindings(), !m_useWriteConnection);
+    });
+}
+
+SqlQuery Builder::runWithTimeout(const std::function<SqlQuery()> &callback)
+{
+    const auto run = [this, &callback]
+    {
+        if (!m_timeout)
+            return std::invoke(callback);
+
+        return m_connection->withStatementTimeout(*m_timeout, callback);
+    };
+
+    if (!m_maxStaleness)
+        return run();
+
+    return m_connection->withMaxStaleness(*m_maxStaleness, run);
+}
+
+QVector<QVariantMap>::size_type
+Builder::insertChunkSize(const QVector<QVariantMap> &values) const
+{
+    return static_cast<QVector<QVariantMap>::size_type>(
+                m_grammar->getInsertChunkSize(
+                    static_cast<std::size_t>(values.constFirst().size())));
 }
 
 Builder &Builder::joinInternal(
@@ -177,7 +177,7 @@ bool SchemaBuilder::hasTable(const QString &table) const
     auto query = m_connection->selectFromWriteConnection(
                      m_grammar->compileTableExists(), {table_});
 
-    return QueryUtils::queryResultSize(query) > 0;
+    return query.first();
 }
 
 // TEST schema, test in functional tests silverqx
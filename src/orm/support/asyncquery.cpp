@@ -0,0 +1,66 @@
+#include "orm/support/asyncquery.hpp"
+
+#ifdef T_COROUTINES
+#include <QAbstractEventDispatcher>
+#include <QThread>
+#include <QThreadPool>
+
+#include "orm/exceptions/runtimeerror.hpp"
+#include "orm/utils/type.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+/*!
+    \class AsyncQueryExecutor
+    \brief The AsyncQueryExecutor class executes the async queries.
+
+    \ingroup database
+    \inmodule Export
+
+    Queries are executed in the dedicated thread pool (not in the global QThreadPool),
+    every worker thread borrows a connection from the ConnectionPool, so the number of
+    concurrently running queries is also limited by the pool_max_size configuration
+    option.
+*/
+
+/* public */
+
+QThreadPool &AsyncQueryExecutor::threadPool()
+{
+    static QThreadPool instance;
+
+    return instance;
+}
+
+void AsyncQueryExecutor::start(std::function<void()> &&work,
+                               std::function<void()> &&callback)
+{
+    /* The event dispatcher lives in the current thread and it's owned by Qt, it's
+       used as the context of the queued call so nothing has to be allocated here. */
+    auto *const context = QThread::currentThread()->eventDispatcher();
+
+    if (context == nullptr)
+        throw Exceptions::RuntimeError(
+                QStringLiteral("The async query can be awaited only in the thread "
+                               "with the Qt event loop, the current thread doesn't "
+                               "have the event dispatcher in %1().")
+                .arg(__tiny_func__));
+
+    threadPool().start([work = std::move(work), context,
+                        callback = std::move(callback)]
+    {
+        std::invoke(work);
+
+        // Invoke the callback in the awaiting thread
+        QMetaObject::invokeMethod(context, callback, Qt::QueuedConnection);
+    });
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // T_COROUTINES
@@ -0,0 +1,633 @@
+#include "orm/support/connectionpool.hpp"
+
+#include <QElapsedTimer>
+#include <QThread>
+
+#include <QtSql/QSqlDatabase>
+#include <QtSql/QSqlQuery>
+
+#include "orm/connectors/connectionfactory.hpp"
+#include "orm/constants.hpp"
+#include "orm/exceptions/connectionpooltimeouterror.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/exceptions/runtimeerror.hpp"
+#include "orm/support/pooledconnection.hpp"
+#include "orm/utils/type.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+#ifdef TINYORM_MYSQL_PING
+using Orm::Constants::QMYSQL;
+#endif
+using Orm::Constants::QSQLITE;
+using Orm::Constants::driver_;
+using Orm::Constants::journal_mode;
+using Orm::Constants::pool_acquire_timeout;
+using Orm::Constants::pool_keepalive_interval;
+using Orm::Constants::pool_max_idle_time;
+using Orm::Constants::pool_max_size;
+using Orm::Constants::pool_min_size;
+using Orm::Constants::query_only;
+using Orm::Constants::wal_readers;
+
+namespace Orm::Support
+{
+
+/*!
+    \class ConnectionPool
+    \brief The ConnectionPool class manages a bounded set of database connections
+    that can be borrowed by any thread.
+
+    \ingroup database
+    \inmodule Export
+
+    The thread-affine mode where every thread has its own DatabaseConnection
+    (DatabaseManager::connection()) stays the default, the pool is opt-in and it's
+    created lazily by the DatabaseManager::connectionPool() or acquire() methods.
+    Pooled connections are created lazily up to the pool_max_size configuration
+    option, the pool_min_size connections are created eagerly (they don't open
+    a physical connection until the first query).
+
+    Idle connections are maintained by the maintain() method, it's called
+    periodically by the DatabaseManager::startKeepAlive() scheduler. Connections idle
+    longer than the pool_keepalive_interval are pinged so the database server or
+    middleboxes don't kill them, and connections idle longer than
+    the pool_max_idle_time are closed, they reconnect lazily on the next query.
+
+    The SQLite connection with the wal_readers configuration option has also
+    the separate reader pool (DatabaseManager::readerPool()) that contains
+    the wal_readers read-only (query_only) connections, the general pool stays
+    writable. In the WAL journal mode the readers don't wait for the writer, so
+    the select AsyncQuery-ies and the ScatterGather queries don't serialize behind
+    writes.
+*/
+
+namespace
+{
+    /*! Default maximum number of connections in the pool. */
+    std::size_t defaultMaxSize()
+    {
+        return static_cast<std::size_t>(std::max(QThread::idealThreadCount(), 1));
+    }
+
+    /*! Default acquire timeout. */
+    constexpr std::chrono::milliseconds DefaultAcquireTimeout {30000};
+
+    /*! Get the configuration of the pooled connections. */
+    QVariantHash pooledConfig(const QVariantHash &config, const bool readers)
+    {
+        if (!readers)
+            return config;
+
+        auto readerConfig = config;
+
+        // The journal mode is persistent, it's switched to the WAL by the writer
+        readerConfig.remove(journal_mode);
+        readerConfig.remove(wal_readers);
+        readerConfig.insert(query_only, true);
+        // The pool_max_size is the size of the general pool
+        readerConfig.insert(pool_max_size, config.value(wal_readers));
+
+        return readerConfig;
+    }
+
+    /*! Get the time configuration option in milliseconds (0 if missing). */
+    std::chrono::milliseconds
+    milliseconds(const QVariantHash &config, const QString &option)
+    {
+        return std::chrono::milliseconds(config.value(option, 0).value<qint64>());
+    }
+} // namespace
+
+/* public */
+
+ConnectionPool::ConnectionPool(const QString &name, const QVariantHash &config,
+                               const bool readers)
+    : m_name(name)
+    , m_readers(readers && hasReaderPool(config))
+    , m_config(pooledConfig(config, m_readers))
+    , m_minSize(m_config.value(pool_min_size, 0).value<std::size_t>())
+    , m_maxSize(m_config.contains(pool_max_size)
+                ? m_config.value(pool_max_size).value<std::size_t>()
+                : defaultMaxSize())
+    , m_acquireTimeout(config.contains(pool_acquire_timeout)
+                       ? std::chrono::milliseconds(
+                             config.value(pool_acquire_timeout).value<qint64>())
+                       : DefaultAcquireTimeout)
+    , m_keepAliveInterval(milliseconds(config, pool_keepalive_interval))
+    , m_maxIdleTime(milliseconds(config, pool_max_idle_time))
+{
+    throwIfInvalidSize();
+
+    const auto now = std::chrono::steady_clock::now();
+
+    // Nothing is connected at this point, connections are resolved lazily
+    for (std::size_t index = 0; index < m_minSize; ++index) {
+        auto connection = makeConnection(m_nextIndex++);
+
+        m_idle.push_back({connection, now, now});
+        m_connections.push_back(std::move(connection));
+        ++m_size;
+    }
+
+    m_stats.size = m_size;
+    m_stats.idle = m_idle.size();
+}
+
+ConnectionPool::~ConnectionPool()
+{
+    /* The pool removed from the DatabaseManager while a connection was being acquired
+       is destroyed by the last PooledConnection, clean up what was returned. */
+    try {
+        std::scoped_lock lock(m_mutex);
+
+        removeIdleConnections();
+
+    } catch (...) {} // NOLINT(bugprone-empty-catch)
+}
+
+PooledConnection ConnectionPool::acquire()
+{
+    return acquire(m_acquireTimeout);
+}
+
+PooledConnection ConnectionPool::acquire(const std::chrono::milliseconds timeout)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    bool waited = false;
+
+    std::unique_lock lock(m_mutex);
+
+    while (m_idle.empty()) {
+        // The pool can still grow, create a new connection outside of the lock
+        if (m_size < m_maxSize) {
+            const auto index = m_nextIndex++;
+            ++m_size;
+
+            lock.unlock();
+
+            std::shared_ptr<DatabaseConnection> connection;
+            try {
+                connection = makeConnection(index);
+
+            } catch (...) {
+                lock.lock();
+                --m_size;
+                lock.unlock();
+                m_released.notify_one();
+                throw;
+            }
+
+            lock.lock();
+
+            m_connections.push_back(connection);
+            recordAcquired(waited, timer.elapsed());
+
+            lock.unlock();
+
+            connection->acquireThreadAffinity();
+
+            return {shared_from_this(), std::move(connection)};
+        }
+
+        waited = true;
+
+        if (m_released.wait_until(lock, deadline) == std::cv_status::timeout &&
+            m_idle.empty()
+        ) {
+            ++m_stats.timeouts;
+
+            throw Exceptions::ConnectionPoolTimeoutError(
+                        QStringLiteral("Timed out after %1ms while waiting for a free "
+                                       "connection in the '%2' connection pool "
+                                       "(pool_max_size = %3) in %4().")
+                        .arg(timeout.count()).arg(m_name).arg(m_maxSize)
+                        .arg(__tiny_func__));
+        }
+    }
+
+    auto connection = std::move(m_idle.front().connection);
+    m_idle.pop_front();
+
+    recordAcquired(waited, timer.elapsed());
+
+    lock.unlock();
+
+    connection->acquireThreadAffinity();
+
+    return {shared_from_this(), std::move(connection)};
+}
+
+void ConnectionPool::disconnect()
+{
+    std::unique_lock lock(m_mutex);
+
+    // The maintained connections are returned shortly
+    m_released.wait(lock, [this] { return m_maintaining == 0; });
+
+    // Borrowed connections are used by other threads, they can't be removed here
+    if (m_idle.size() != m_size)
+        throw Exceptions::RuntimeError(
+                QStringLiteral("The '%1' connection pool can't be disconnected, %2 "
+                               "connection(s) are still borrowed in %3().")
+                .arg(m_name).arg(m_size - m_idle.size()).arg(__tiny_func__));
+
+    removeIdleConnections();
+}
+
+ConnectionPoolStats ConnectionPool::stats() const
+{
+    std::scoped_lock lock(m_mutex);
+
+    return m_stats;
+}
+
+void ConnectionPool::resetStats()
+{
+    std::scoped_lock lock(m_mutex);
+
+    m_stats.acquired      = 0;
+    m_stats.waited        = 0;
+    m_stats.timeouts      = 0;
+    m_stats.totalWaitTime = 0;
+    m_stats.maxWaitTime   = 0;
+    m_stats.pings         = 0;
+    m_stats.reaped        = 0;
+    m_stats.revived       = 0;
+    m_stats.failed        = 0;
+}
+
+bool ConnectionPool::hasReaderPool(const QVariantHash &config)
+{
+    return config.value(driver_).value<QString>() == QSQLITE &&
+           config.contains(wal_readers);
+}
+
+void ConnectionPool::maintain()
+{
+    // Nothing to do
+    if (m_keepAliveInterval.count() <= 0 && m_maxIdleTime.count() <= 0)
+        return;
+
+    const auto now = std::chrono::steady_clock::now();
+
+    // The due connections are taken out of the pool, so they can't be borrowed meanwhile
+    std::vector<IdleConnection> due;
+    {
+        std::scoped_lock lock(m_mutex);
+
+        for (auto it = m_idle.begin(); it != m_idle.end();)
+            if (isMaintenanceDue(*it, now)) {
+                due.push_back(std::move(*it));
+                it = m_idle.erase(it);
+            }
+            else
+                ++it;
+
+        m_maintaining += due.size();
+    }
+
+    // Nothing to maintain
+    if (due.empty())
+        return;
+
+    std::size_t pings = 0;
+    std::size_t reaped = 0;
+    std::size_t revived = 0;
+    std::size_t failed = 0;
+
+    /* Return the due connections to the pool, also if the maintenance throws,
+       otherwise the disconnect() would wait for them forever. */
+    const auto returnDue = [this, &due, &pings, &reaped, &revived, &failed]
+    {
+        {
+            std::scoped_lock lock(m_mutex);
+
+            for (auto &idle : due)
+                m_idle.push_back(std::move(idle));
+
+            m_maintaining -= due.size();
+
+            m_stats.pings   += pings;
+            m_stats.reaped  += reaped;
+            m_stats.revived += revived;
+            m_stats.failed  += failed;
+        }
+
+        m_released.notify_all();
+    };
+
+    // The connection whose driver was pulled to the current thread
+    DatabaseConnection *pulled = nullptr;
+
+    try {
+        for (auto &idle : due) {
+            auto &connection = *idle.connection;
+
+            // Pull the driver to the current thread, the same as the acquire() does
+            connection.acquireThreadAffinity();
+            pulled = &connection;
+
+            switch (maintainConnection(connection, idle, now)) {
+            case Maintenance::None:
+                break;
+
+            case Maintenance::Pinged:
+                ++pings;
+                break;
+
+            case Maintenance::Revived:
+                ++pings;
+                ++revived;
+                break;
+
+            case Maintenance::Failed:
+                ++pings;
+                ++failed;
+                break;
+
+            case Maintenance::Reaped:
+                ++reaped;
+                break;
+
+            default:
+                Q_UNREACHABLE();
+            }
+
+            idle.lastActivity = now;
+
+            connection.releaseThreadAffinity();
+            pulled = nullptr;
+        }
+
+    } catch (...) {
+        // Push the driver out, so the next borrower can pull it
+        if (pulled != nullptr)
+            try {
+                pulled->releaseThreadAffinity();
+            } catch (...) {} // NOLINT(bugprone-empty-catch)
+
+        returnDue();
+
+        throw;
+    }
+
+    returnDue();
+}
+
+/* private */
+
+void ConnectionPool::release(std::shared_ptr<DatabaseConnection> &&connection) noexcept
+{
+    /* Don't leak an open transaction to the next borrower, if the rollback or
+       the thread affinity hand over fails the connection is in an unknown state,
+       so throw it away. */
+    bool discard = false;
+
+    try {
+        if (connection->inTransaction())
+            connection->rollBack();
+
+        // Can be pulled only if it was pushed out by the thread that owns it
+        connection->releaseThreadAffinity();
+
+    } catch (...) {
+        discard = true;
+    }
+
+    if (discard)
+        try {
+            // Pull the driver back if it was pushed out before the failure
+            connection->acquireThreadAffinity();
+            connection->disconnect();
+        } catch (...) {} // NOLINT(bugprone-empty-catch)
+
+    // The sticky read/write connection state belongs to the borrower's unit of work
+    connection->forgetRecordModificationState();
+
+    {
+        std::scoped_lock lock(m_mutex);
+
+        if (discard) {
+            std::erase(m_connections, connection);
+            --m_size;
+        }
+        else {
+            const auto now = std::chrono::steady_clock::now();
+
+            m_idle.push_back({std::move(connection), now, now});
+        }
+
+        m_stats.size = m_size;
+        m_stats.idle = m_idle.size();
+        m_stats.borrowed = m_size - m_idle.size();
+    }
+
+    // The discarded connection name is never reused, so don't leak it
+    if (discard)
+        removeQtConnections(connection->getName());
+
+    m_released.notify_one();
+}
+
+void ConnectionPool::recordAcquired(const bool waited, const qint64 elapsed)
+{
+    ++m_stats.acquired;
+
+    if (waited) {
+        ++m_stats.waited;
+        m_stats.totalWaitTime += elapsed;
+        m_stats.maxWaitTime = std::max(m_stats.maxWaitTime, elapsed);
+    }
+
+    m_stats.size = m_size;
+    m_stats.idle = m_idle.size();
+    m_stats.borrowed = m_size - m_idle.size();
+}
+
+void ConnectionPool::removeIdleConnections()
+{
+    for (const auto &idle : m_idle) {
+
+        const auto &connection = idle.connection;
+
+        // Pull the driver to the current thread so it can be closed and destroyed
+        connection->acquireThreadAffinity();
+        connection->disconnect();
+
+        std::erase(m_connections, connection);
+        --m_size;
+
+        removeQtConnections(connection->getName());
+    }
+
+    m_idle.clear();
+
+    m_stats.size = m_size;
+    m_stats.idle = 0;
+    m_stats.borrowed = m_size;
+}
+
+void ConnectionPool::removeQtConnections(const QString &name)
+{
+    if (QSqlDatabase::contains(name))
+        QSqlDatabase::removeDatabase(name);
+
+    // Also the read connection of the read/write connection
+    if (const auto readName = Connectors::ConnectionFactory::readConnectionName(name);
+        QSqlDatabase::contains(readName)
+    )
+        QSqlDatabase::removeDatabase(readName);
+}
+
+
+bool ConnectionPool::isMaintenanceDue(
+        const IdleConnection &idle, const std::chrono::steady_clock::time_point now) const
+{
+    if (m_maxIdleTime.count() > 0 && now - idle.idleSince >= m_maxIdleTime)
+        return true;
+
+    return m_keepAliveInterval.count() > 0 &&
+           now - idle.lastActivity >= m_keepAliveInterval;
+}
+
+ConnectionPool::Maintenance
+ConnectionPool::maintainConnection(
+        DatabaseConnection &connection, const IdleConnection &idle,
+        const std::chrono::steady_clock::time_point now) const
+{
+    // Never connected or already closed, it will be connected lazily
+    if (!connection.isOpen())
+        return Maintenance::None;
+
+    // Close the physical connection, it reconnects lazily on the next query
+    if (m_maxIdleTime.count() > 0 && now - idle.idleSince >= m_maxIdleTime) {
+        connection.disconnect();
+
+        return Maintenance::Reaped;
+    }
+
+    if (pingConnection(connection))
+        return Maintenance::Pinged;
+
+    /* The connection was lost, reconnect it now so the next borrower doesn't pay
+       the lost connection, reconnect, and retry round trip. */
+    try {
+        connection.disconnect();
+        connection.reconnect();
+        connection.connectEagerly();
+
+    } catch (...) {
+        // It will be reconnected lazily on the next query
+        connection.disconnect();
+
+        return Maintenance::Failed;
+    }
+
+    return Maintenance::Revived;
+}
+
+bool ConnectionPool::pingConnection(DatabaseConnection &connection)
+{
+    try {
+#ifdef TINYORM_MYSQL_PING
+        if (connection.driverName() == QMYSQL)
+            return connection.pingDatabase();
+#endif
+
+        // The cheapest round trip for the other drivers
+        QSqlQuery query(connection.getQtConnection());
+
+        return query.exec(QStringLiteral("select 1"));
+
+    } catch (...) {
+        return false;
+    }
+}
+
+std::shared_ptr<DatabaseConnection> ConnectionPool::makeConnection(const std::size_t index)
+{
+    /* Every pooled connection must have its own QSqlDatabase connection name, it's
+       also the name returned by the DatabaseConnection::getName(). */
+    auto config = m_config;
+    const auto name = QStringLiteral("%1-%2-%3")
+                      .arg(m_name, m_readers ? QStringLiteral("reader")
+                                             : QStringLiteral("pool"))
+                      .arg(index);
+
+    std::shared_ptr<DatabaseConnection> connection;
+
+    try {
+        connection = Connectors::ConnectionFactory::make(config, name);
+
+        // Queries built on the pooled connection refer to the pool by this name
+        connection->setPoolName(m_name);
+
+        /* The DatabaseManager's reconnector looks up connections for the current
+           thread, pooled connections have to be refreshed by the pool instead. */
+        connection->setReconnector([this](const DatabaseConnection &connection_)
+        {
+            refreshQtConnection(connection_.getName());
+        });
+
+        // Shared with the thread-local connections of the same name
+        connection->setCircuitBreaker(
+                    Connectors::CircuitBreaker::forConnection(
+                        m_name, connection->getConfig()));
+
+    } catch (...) {
+        /* The connector could already add the QSqlDatabase connection (eg. the eager
+           connect failed), the index and so the name is never reused. */
+        connection.reset();
+        removeQtConnections(name);
+
+        throw;
+    }
+
+    return connection;
+}
+
+void ConnectionPool::refreshQtConnection(const QString &name)
+{
+    auto config = m_config;
+    auto fresh = Connectors::ConnectionFactory::make(config, name);
+
+    std::shared_ptr<DatabaseConnection> connection;
+    {
+        std::scoped_lock lock(m_mutex);
+
+        const auto it = std::ranges::find_if(m_connections,
+                                             [&name](const auto &connection_)
+        {
+            return connection_->getName() == name;
+        });
+
+        // This should never happen 🤔
+        Q_ASSERT(it != m_connections.cend());
+
+        connection = *it;
+    }
+
+    connection->setReadQtConnectionResolver(fresh->getReadQtConnectionResolver());
+    connection->setQtConnectionResolver(fresh->getQtConnectionResolver());
+}
+
+void ConnectionPool::throwIfInvalidSize() const
+{
+    if (m_maxSize > 0 && m_minSize <= m_maxSize)
+        return;
+
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The '%1' connection pool has invalid size, "
+                               "the pool_max_size must be greater than zero and "
+                               "the pool_min_size must be less or equal to "
+                               "the pool_max_size in %2().")
+                .arg(m_name, __tiny_func__));
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
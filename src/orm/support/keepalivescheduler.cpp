@@ -0,0 +1,70 @@
+#include "orm/support/keepalivescheduler.hpp"
+
+#include <QDebug>
+
+#include <exception>
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+/*!
+    \class KeepAliveScheduler
+    \brief The KeepAliveScheduler class invokes the connection pools maintenance
+    periodically.
+
+    \ingroup database
+    \inmodule Export
+
+    It's created by the DatabaseManager::startKeepAlive() method, the task is invoked
+    in the background thread every interval until the scheduler is destroyed.
+    An exception thrown by the task is logged and the scheduler continues.
+*/
+
+/* public */
+
+KeepAliveScheduler::KeepAliveScheduler(const std::chrono::milliseconds interval,
+                                       std::function<void()> &&task)
+    : m_interval(interval)
+    , m_task(std::move(task))
+    , m_thread(&KeepAliveScheduler::run, this)
+{}
+
+KeepAliveScheduler::~KeepAliveScheduler()
+{
+    {
+        std::scoped_lock lock(m_mutex);
+
+        m_stopping = true;
+    }
+
+    m_stop.notify_one();
+
+    m_thread.join();
+}
+
+/* private */
+
+void KeepAliveScheduler::run()
+{
+    std::unique_lock lock(m_mutex);
+
+    while (!m_stop.wait_for(lock, m_interval, [this] { return m_stopping; })) {
+        // Don't block the destructor during the maintenance
+        lock.unlock();
+
+        try {
+            std::invoke(m_task);
+
+        } catch (const std::exception &e) {
+            qWarning().noquote() << "The keepalive task failed:" << e.what();
+        }
+
+        lock.lock();
+    }
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
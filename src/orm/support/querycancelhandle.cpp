@@ -0,0 +1,108 @@
+#include "orm/support/querycancelhandle.hpp"
+
+#include <QtSql/QSqlDatabase>
+#include <QtSql/QSqlQuery>
+
+#include <algorithm>
+#include <atomic>
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+/*!
+    \class QueryCancelHandle
+    \brief The QueryCancelHandle class cancels the running query from another thread.
+
+    \ingroup database
+    \inmodule Export
+
+    The QSqlDatabase connection can't be used from another thread and the running query
+    blocks the thread that owns the connection, so the handle copies the connection
+    parameters in the owning thread and sends the cancel request through a new
+    short-lived connection (pg_cancel_backend() or KILL QUERY). The canceled query
+    throws the QueryCanceledError exception.
+
+    The handle doesn't own a copy of the password, it only references the password
+    owned by the DatabaseConnection, so the plaintext password doesn't outlive
+    the connection and the cancel() is a no-op after the connection was destroyed.
+*/
+
+namespace
+{
+    /*! Counter used to generate unique connection names for the cancel requests. */
+    std::atomic<quint64> CancelConnectionCounter = 0; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+} // namespace
+
+/* public */
+
+QueryCancelHandle::QueryCancelHandle(
+        const QSqlDatabase &connection, QString cancelQuery,
+        const std::shared_ptr<const QString> &password)
+    : m_driverName(connection.driverName())
+    , m_hostName(connection.hostName())
+    , m_port(connection.port())
+    , m_databaseName(connection.databaseName())
+    , m_userName(connection.userName())
+    , m_password(password)
+    , m_connectOptions(connection.connectOptions())
+    , m_cancelQuery(std::move(cancelQuery))
+{}
+
+bool QueryCancelHandle::cancel() const
+{
+    if (!isValid())
+        return false;
+
+    // The connection was destroyed, there is nothing to cancel
+    const auto password = m_password.lock();
+    if (!password)
+        return false;
+
+    const auto connectionName =
+            QStringLiteral("tinyorm_cancel_%1").arg(++CancelConnectionCounter);
+
+    auto canceled = false;
+
+    // The QSqlDatabase has to be destroyed before the removeDatabase() call
+    {
+        auto connection = QSqlDatabase::addDatabase(m_driverName, connectionName);
+
+        connection.setHostName(m_hostName);
+        connection.setPort(m_port);
+        connection.setDatabaseName(m_databaseName);
+        connection.setUserName(m_userName);
+        connection.setPassword(*password);
+        connection.setConnectOptions(m_connectOptions);
+
+        if (connection.open()) {
+            QSqlQuery query(connection);
+
+            canceled = query.exec(m_cancelQuery);
+        }
+
+        connection.close();
+    }
+
+    QSqlDatabase::removeDatabase(connectionName);
+
+    return canceled;
+}
+
+std::shared_ptr<const QString>
+QueryCancelHandle::makePassword(const QSqlDatabase &connection)
+{
+    // Overwrite the plaintext password before the memory is freed
+    return {new QString(connection.password()), [](const QString *password)
+    {
+        auto *const data = const_cast<QString *>(password)->data(); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+        std::fill_n(data, password->size(), QChar(0));
+
+        delete password;
+    }};
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
@@ -0,0 +1,438 @@
+#include "orm/support/scattergather.hpp"
+
+#include <QThreadPool>
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <queue>
+
+#include "orm/databasemanager.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/utils/helpers.hpp"
+#include "orm/utils/query.hpp"
+#include "orm/utils/type.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using Orm::Constants::DESC;
+using Orm::Constants::DOT;
+
+using Helpers = Orm::Utils::Helpers;
+using QueryUtils = Orm::Utils::Query;
+
+namespace Orm::Support
+{
+
+/*!
+    \class ScatterGather
+    \brief The ScatterGather class runs one query on many connections concurrently.
+
+    \ingroup database
+    \inmodule Export
+
+    Used to query sharded databases, the query is compiled only once and executed on
+    all connections in the dedicated thread pool, so the latency is the latency of
+    the slowest connection instead of the sum of all of them. Every worker borrows
+    a connection from the ConnectionPool of the given connection.
+*/
+
+namespace
+{
+    /*! Three-way comparison of the given values (-1, 0, or 1). */
+    template<typename T>
+    int threeWay(const T &left, const T &right)
+    {
+        return static_cast<int>(right < left) - static_cast<int>(left < right);
+    }
+
+    /*! Determine whether the given type is an integral type. */
+    bool isIntegral(const int typeId)
+    {
+        switch (typeId) {
+        case QMetaType::Bool:
+        case QMetaType::Char:
+        case QMetaType::SChar:
+        case QMetaType::UChar:
+        case QMetaType::Short:
+        case QMetaType::UShort:
+        case QMetaType::Int:
+        case QMetaType::UInt:
+        case QMetaType::Long:
+        case QMetaType::ULong:
+        case QMetaType::LongLong:
+        case QMetaType::ULongLong:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+    /*! Determine whether the given integral type is unsigned. */
+    bool isUnsigned(const int typeId)
+    {
+        switch (typeId) {
+        case QMetaType::Bool:
+        case QMetaType::UChar:
+        case QMetaType::UShort:
+        case QMetaType::UInt:
+        case QMetaType::ULong:
+        case QMetaType::ULongLong:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+    /*! Three-way comparison of the given integral values, the unsigned values
+        are compared as unsigned so values above INT64_MAX don't wrap. */
+    int compareIntegers(const QVariant &left, const int leftTypeId,
+                        const QVariant &right, const int rightTypeId)
+    {
+        const auto leftUnsigned = isUnsigned(leftTypeId);
+        const auto rightUnsigned = isUnsigned(rightTypeId);
+
+        if (!leftUnsigned && !rightUnsigned)
+            return threeWay(left.value<qint64>(), right.value<qint64>());
+
+        // The negative value is smaller than any unsigned value
+        if (!leftUnsigned && left.value<qint64>() < 0)
+            return -1;
+        if (!rightUnsigned && right.value<qint64>() < 0)
+            return 1;
+
+        return threeWay(left.value<quint64>(), right.value<quint64>());
+    }
+
+    /*! Determine whether the given type is a floating-point type. */
+    bool isFloatingPoint(const int typeId)
+    {
+        return typeId == QMetaType::Double || typeId == QMetaType::Float;
+    }
+
+    /*! Run the select query on the given connection with the given options. */
+    SqlQuery selectWithOptions(DatabaseConnection &connection, const QString &query,
+                               const QVector<QVariant> &bindings,
+                               const ScatterGatherOptions &options)
+    {
+        const auto select = [&connection, &query, &bindings, &options]
+        {
+            return connection.select(query, bindings, !options.useWriteConnection);
+        };
+
+        const auto run = [&connection, &options, &select]
+        {
+            if (!options.timeout)
+                return select();
+
+            return connection.withStatementTimeout(*options.timeout, select);
+        };
+
+        if (!options.maxStaleness)
+            return run();
+
+        return connection.withMaxStaleness(*options.maxStaleness, run);
+    }
+
+    /*! Cursor to the current row of one result during the merge. */
+    struct MergeCursor
+    {
+        /*! Index of the result (connection). */
+        QVector<QVector<QSqlRecord>>::size_type result;
+        /*! Index of the current row in the result. */
+        QVector<QSqlRecord>::size_type row;
+    };
+} // namespace
+
+/* public */
+
+QVector<QVector<QSqlRecord>>
+ScatterGather::select(DatabaseManager &manager, const QStringList &connections,
+                      const QString &query, const QVector<QVariant> &bindings,
+                      const ScatterGatherOptions &options)
+{
+    const auto size = static_cast<std::size_t>(connections.size());
+
+    // Otherwise, the latency would be the sum of the latencies of some connections
+    reserveThreads(static_cast<int>(connections.size()));
+
+    /* Configurations are thread_local, so the pools have to be obtained in the current
+       thread, the pools itself are thread-safe. */
+    std::vector<std::shared_ptr<ConnectionPool>> pools;
+    pools.reserve(size);
+
+    // Reads are served by the read-only wal_readers connections if configured
+    for (const auto &connection : connections)
+        pools.push_back(options.useWriteConnection
+                        ? manager.connectionPoolShared(connection)
+                        : manager.readerPoolShared(connection));
+
+    // Every worker writes only to its own element
+    std::vector<QVector<QSqlRecord>> results(size);
+    std::vector<std::exception_ptr> exceptions(size);
+
+    std::mutex mutex;
+    std::condition_variable finished;
+    auto remaining = size;
+
+    for (std::size_t index = 0; index < size; ++index)
+        threadPool().start([&, index]
+        {
+            try {
+                // Returned back to the pool at the end of the scope
+                auto pooled = pools[index]->acquire();
+                auto result = selectWithOptions(*pooled, query, bindings, options);
+
+                results[index] = QueryUtils::fetchRecords(result);
+
+            } catch (...) {
+                exceptions[index] = std::current_exception();
+            }
+
+            // Notify under the lock, the current thread's stack is gone after the wait
+            std::scoped_lock lock(mutex);
+
+            if (--remaining == 0)
+                finished.notify_one();
+        });
+
+    {
+        std::unique_lock lock(mutex);
+
+        finished.wait(lock, [&remaining] { return remaining == 0; });
+    }
+
+    // Rethrow the exception of the first failed connection
+    for (const auto &exception : exceptions)
+        if (exception)
+            std::rethrow_exception(exception);
+
+    QVector<QVector<QSqlRecord>> gathered;
+    gathered.reserve(static_cast<QVector<QVector<QSqlRecord>>::size_type>(size));
+
+    for (auto &result : results)
+        gathered << std::move(result);
+
+    return gathered;
+}
+
+QVector<QSqlRecord> ScatterGather::concat(QVector<QVector<QSqlRecord>> &&results)
+{
+    QVector<QSqlRecord>::size_type size = 0;
+    for (const auto &result : results)
+        size += result.size();
+
+    QVector<QSqlRecord> records;
+    records.reserve(size);
+
+    for (auto &result : results)
+        for (auto &record : result)
+            records << std::move(record);
+
+    return records;
+}
+
+QVector<QSqlRecord>
+ScatterGather::mergeSorted(QVector<QVector<QSqlRecord>> &&results,
+                           const QVector<OrderByItem> &orders, const bool nullsLast)
+{
+    if (orders.isEmpty())
+        return concat(std::move(results));
+
+    auto indexedRecords = mergeSortedIndexed(std::move(results), orders, nullsLast);
+
+    QVector<QSqlRecord> records;
+    records.reserve(indexedRecords.size());
+
+    for (auto &indexedRecord : indexedRecords)
+        records << std::move(indexedRecord.second);
+
+    return records;
+}
+
+QVector<ScatterGather::IndexedRecord>
+ScatterGather::mergeSortedIndexed(QVector<QVector<QSqlRecord>> &&results,
+                                  const QVector<OrderByItem> &orders,
+                                  const bool nullsLast)
+{
+    QVector<QSqlRecord>::size_type size = 0;
+    for (const auto &result : results)
+        size += result.size();
+
+    QVector<IndexedRecord> records;
+    records.reserve(size);
+
+    // Concatenate in the order of the connections
+    if (orders.isEmpty()) {
+        for (QVector<QVector<QSqlRecord>>::size_type index = 0; index < results.size();
+             ++index
+        )
+            for (auto &record : results[index])
+                records.append({index, std::move(record)});
+
+        return records;
+    }
+
+    const auto mergeOrders_ = mergeOrders(orders);
+
+    // All records of one result have the same fields
+    for (const auto &result : results)
+        if (!result.isEmpty())
+            throwIfMissingOrderField(result.constFirst(), mergeOrders_);
+
+    /* The priority queue returns the greatest element, so the comparator is inverted,
+       ties are resolved by the connection index to keep the merge stable. */
+    auto greater = [&results, &mergeOrders_, nullsLast](const MergeCursor &left,
+                                                        const MergeCursor &right)
+    {
+        const auto &leftRecord = results.at(left.result).at(left.row);
+        const auto &rightRecord = results.at(right.result).at(right.row);
+
+        if (lessThan(rightRecord, leftRecord, mergeOrders_, nullsLast))
+            return true;
+
+        if (lessThan(leftRecord, rightRecord, mergeOrders_, nullsLast))
+            return false;
+
+        return left.result > right.result;
+    };
+
+    std::priority_queue<MergeCursor, std::vector<MergeCursor>, decltype (greater)>
+    cursors(greater);
+
+    for (QVector<QVector<QSqlRecord>>::size_type index = 0; index < results.size();
+         ++index
+    )
+        if (!results[index].isEmpty())
+            cursors.push({index, 0});
+
+    while (!cursors.empty()) {
+        auto cursor = cursors.top();
+        cursors.pop();
+
+        records.append({cursor.result, std::move(results[cursor.result][cursor.row])});
+
+        if (++cursor.row < results[cursor.result].size())
+            cursors.push(cursor);
+    }
+
+    return records;
+}
+
+QThreadPool &ScatterGather::threadPool()
+{
+    static QThreadPool instance;
+
+    return instance;
+}
+
+/* private */
+
+QVector<ScatterGather::MergeOrder>
+ScatterGather::mergeOrders(const QVector<OrderByItem> &orders)
+{
+    QVector<MergeOrder> mergeOrders;
+    mergeOrders.reserve(orders.size());
+
+    for (const auto &order : orders) {
+        if (!order.sql.isEmpty() || !std::holds_alternative<QString>(order.column))
+            throw Exceptions::InvalidArgumentError(
+                    QStringLiteral("Raw order by clauses can't be merged, results "
+                                   "from many connections can be merged only by "
+                                   "the column names in %1().")
+                    .arg(__tiny_func__));
+
+        const auto &column = std::get<QString>(order.column);
+
+        // Fetched records contain field names without the table qualifier
+        mergeOrders.append({column.mid(column.lastIndexOf(DOT) + 1),
+                            order.direction.toLower() == DESC});
+    }
+
+    return mergeOrders;
+}
+
+void ScatterGather::throwIfMissingOrderField(const QSqlRecord &record,
+                                             const QVector<MergeOrder> &orders)
+{
+    for (const auto &order : orders)
+        // The missing field would compare as null, the merge order would be random
+        if (!record.contains(order.fieldName))
+            throw Exceptions::InvalidArgumentError(
+                    QStringLiteral("The '%1' order by column isn't in the select list, "
+                                   "results from many connections can be merged only "
+                                   "by the selected columns in %2().")
+                    .arg(order.fieldName, __tiny_func__));
+}
+
+void ScatterGather::reserveThreads(const int count)
+{
+    // Many threads can query many connections at once
+    static std::mutex mutex;
+
+    std::scoped_lock lock(mutex);
+
+    if (auto &pool = threadPool(); pool.maxThreadCount() < count)
+        pool.setMaxThreadCount(count);
+}
+
+bool ScatterGather::lessThan(const QSqlRecord &left, const QSqlRecord &right,
+                             const QVector<MergeOrder> &orders, const bool nullsLast)
+{
+    for (const auto &order : orders) {
+        const auto result = compareValues(left.value(order.fieldName),
+                                          right.value(order.fieldName), nullsLast);
+
+        if (result != 0)
+            return order.descending ? result > 0 : result < 0;
+    }
+
+    return false;
+}
+
+int ScatterGather::compareValues(const QVariant &left, const QVariant &right,
+                                 const bool nullsLast)
+{
+    const auto leftIsNull = left.isNull();
+    const auto rightIsNull = right.isNull();
+
+    /* Null values are sorted the same way as the database sorts them, the smallest
+       on MySQL and SQLite, the largest on PostgreSQL. */
+    if (leftIsNull || rightIsNull) {
+        const auto result = static_cast<int>(rightIsNull) -
+                            static_cast<int>(leftIsNull);
+
+        return nullsLast ? -result : result;
+    }
+
+    const auto leftTypeId = Helpers::qVariantTypeId(left);
+    const auto rightTypeId = Helpers::qVariantTypeId(right);
+
+    if (isIntegral(leftTypeId) && isIntegral(rightTypeId))
+        return compareIntegers(left, leftTypeId, right, rightTypeId);
+
+    if ((isIntegral(leftTypeId) || isFloatingPoint(leftTypeId)) &&
+        (isIntegral(rightTypeId) || isFloatingPoint(rightTypeId))
+    )
+        return threeWay(left.value<double>(), right.value<double>());
+
+    if (leftTypeId == QMetaType::QDateTime && rightTypeId == QMetaType::QDateTime)
+        return threeWay(left.value<QDateTime>(), right.value<QDateTime>());
+
+    if (leftTypeId == QMetaType::QDate && rightTypeId == QMetaType::QDate)
+        return threeWay(left.value<QDate>(), right.value<QDate>());
+
+    if (leftTypeId == QMetaType::QTime && rightTypeId == QMetaType::QTime)
+        return threeWay(left.value<QTime>(), right.value<QTime>());
+
+    /* Binary comparison, the collation of the database isn't known, so only
+       binary-collated string columns are merged in the same order. */
+    return threeWay(QString::compare(left.value<QString>(), right.value<QString>()),
+                    0);
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
@@ -0,0 +1,150 @@
+#include "orm/support/statementcache.hpp"
+
+#include <QThread>
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+/*!
+    \class StatementCache
+    \brief The StatementCache class is an LRU cache of prepared queries.
+
+    \ingroup database
+    \inmodule Export
+
+    Used by the DatabaseConnection to avoid parsing and planning the same query
+    string on the database server again, it's enabled by the statement_cache_size
+    configuration option. The cache contains only idle statements, the statement
+    is checked out while the SqlQuery with its result is alive and the SqlQuery
+    checks it in when it's destroyed. The cache is not thread-safe,
+    the DatabaseConnection is always used only from one thread.
+*/
+
+/* public */
+
+std::unique_ptr<QSqlQuery> StatementCache::checkOut(const QString &queryString)
+{
+    if (!isEnabled())
+        return nullptr;
+
+    const auto it = m_index.find(queryString);
+
+    if (it == m_index.end()) {
+        ++m_misses;
+        return nullptr;
+    }
+
+    ++m_hits;
+
+    // The statement is busy until it's checked in again, it can't be handed out twice
+    auto query = std::move(it->second->second);
+
+    m_entries.erase(it->second);
+    m_index.erase(it);
+
+    return query;
+}
+
+void StatementCache::checkIn(const QString &queryString,
+                             std::unique_ptr<QSqlQuery> &&query)
+{
+    if (!isEnabled() || !query)
+        return;
+
+    /* Another statement for the same query string was prepared while this one was
+       checked out, keep only one of them. */
+    if (const auto it = m_index.find(queryString); it != m_index.end()) {
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return;
+    }
+
+    /* Free the result set of the previous execution (it also resets the SQLite
+       statement so it doesn't hold the read lock), the statement stays prepared. */
+    query->finish();
+
+    m_entries.emplace_front(queryString, std::move(query));
+    m_index.emplace(queryString, m_entries.begin());
+
+    evictOverflow();
+}
+
+StatementCache::CheckInType
+StatementCache::checkInHandler(const QString &queryString)
+{
+    /* The connection can be moved to another thread (connection pools), the statement
+       is checked in only from the thread that executed it. */
+    return [cache = weak_from_this(), queryString, generation = m_generation,
+            thread = QThread::currentThread()]
+           (QSqlQuery &&query)
+    {
+        // The result was destroyed in another thread (eg. the AsyncQuery)
+        if (thread != QThread::currentThread())
+            return;
+
+        const auto statementCache = cache.lock();
+
+        // The connection was destroyed, disconnected, or reconnected
+        if (!statementCache || statementCache->m_generation != generation)
+            return;
+
+        statementCache->checkIn(queryString,
+                                std::make_unique<QSqlQuery>(std::move(query)));
+    };
+}
+
+void StatementCache::remove(const QString &queryString)
+{
+    const auto it = m_index.find(queryString);
+
+    // Nothing to remove
+    if (it == m_index.end())
+        return;
+
+    m_entries.erase(it->second);
+    m_index.erase(it);
+}
+
+void StatementCache::clear()
+{
+    ++m_generation;
+
+    m_index.clear();
+    m_entries.clear();
+}
+
+void StatementCache::setCapacity(const std::size_t capacity)
+{
+    m_capacity = capacity;
+
+    evictOverflow();
+}
+
+StatementCacheStats StatementCache::stats() const
+{
+    return {m_entries.size(), m_hits, m_misses, m_evictions};
+}
+
+void StatementCache::resetStats() noexcept
+{
+    m_hits      = 0;
+    m_misses    = 0;
+    m_evictions = 0;
+}
+
+/* private */
+
+void StatementCache::evictOverflow()
+{
+    while (m_entries.size() > m_capacity) {
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+
+        ++m_evictions;
+    }
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
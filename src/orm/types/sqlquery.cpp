@@ -2,6 +2,11 @@
 
 #include <QtSql/QSqlDriver>
 
+#include <cstring>
+
+#ifdef TINYORM_SQLITE3_DRIVER
+#  include "orm/drivers/sqlite3driver.hpp"
+#endif
 #include "orm/query/grammars/grammar.hpp" // IWYU pragma: keep
 #include "orm/utils/helpers.hpp"
 
@@ -12,11 +17,45 @@ using Orm::Utils::Helpers;
 namespace Orm::Types
 {
 
+namespace
+{
+    /*! Determine whether the given driver is the QSQLITE or the native SQLite driver,
+        the dbmsType() can't be set by the custom drivers. */
+    bool isSQLiteDriver(const QSqlDriver *const driver)
+    {
+        if (driver->dbmsType() == QSqlDriver::DbmsType::SQLite)
+            return true;
+
+#ifdef TINYORM_SQLITE3_DRIVER
+        return dynamic_cast<const Drivers::SQLite3Driver *>(driver) != nullptr;
+#else
+        return false;
+#endif
+    }
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    /*! Determine whether the QSqlQuery was moved from, the SqlQuery can be moved
+        to the QSqlQuery (slicing) and the QSqlQuery's move constructor sets its only
+        data member, the d-pointer, to the nullptr. */
+    bool isMovedFrom(const QSqlQuery &query) noexcept
+    {
+        static_assert(sizeof (QSqlQuery) == sizeof (void *),
+                      "The QSqlQuery must contain only the d-pointer.");
+
+        const void *d = nullptr;
+        std::memcpy(&d, static_cast<const void *>(&query), sizeof (d));
+
+        return d == nullptr;
+    }
+#endif
+} // namespace
+
 /* public */
 
 SqlQuery::SqlQuery(QSqlQuery &&other, const QtTimeZoneConfig &qtTimeZone, // NOLINT(modernize-pass-by-value)
                    const QueryGrammar &queryGrammar,
-                   const std::optional<bool> returnQDateTime
+                   const std::optional<bool> returnQDateTime,
+                   CheckInType &&checkIn
 )
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
     : QSqlQuery(other)
@@ -25,13 +64,50 @@ SqlQuery::SqlQuery(QSqlQuery &&other, const QtTimeZoneConfig &qtTimeZone, // NOL
 #endif
     , m_qtTimeZone(qtTimeZone)
     , m_isConvertingTimeZone(m_qtTimeZone.type != QtTimeZoneType::DontConvert)
-    , m_isSQLiteDb(driver()->dbmsType() == QSqlDriver::DbmsType::SQLite)
+    , m_isSQLiteDb(isSQLiteDriver(driver()))
     // Following two are need by SQLite only
     , m_dateFormat(m_isSQLiteDb ? std::make_optional(queryGrammar.getDateFormat())
                                 : std::nullopt)
     , m_returnQDateTime(returnQDateTime)
+    , m_checkIn(std::move(checkIn))
 {}
 
+SqlQuery::~SqlQuery()
+{
+    checkIn();
+}
+
+SqlQuery::SqlQuery(SqlQuery &&other) noexcept
+    : QSqlQuery(std::move(other))
+    , m_qtTimeZone(std::move(other.m_qtTimeZone))
+    , m_isConvertingTimeZone(other.m_isConvertingTimeZone)
+    , m_isSQLiteDb(other.m_isSQLiteDb)
+    , m_dateFormat(std::move(other.m_dateFormat))
+    , m_returnQDateTime(other.m_returnQDateTime)
+    // The moved from SqlQuery doesn't own the prepared statement anymore
+    , m_checkIn(std::exchange(other.m_checkIn, nullptr))
+{}
+
+SqlQuery &SqlQuery::operator=(SqlQuery &&other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    // The prepared statement of this result is going to be replaced
+    checkIn();
+
+    QSqlQuery::operator=(std::move(other));
+
+    m_qtTimeZone           = std::move(other.m_qtTimeZone);
+    m_isConvertingTimeZone = other.m_isConvertingTimeZone;
+    m_isSQLiteDb           = other.m_isSQLiteDb;
+    m_dateFormat           = std::move(other.m_dateFormat);
+    m_returnQDateTime      = other.m_returnQDateTime;
+    m_checkIn              = std::exchange(other.m_checkIn, nullptr);
+
+    return *this;
+}
+
 /* private */
 
 QVariant SqlQuery::valueInternal(QVariant &&value) const
@@ -133,6 +209,31 @@ std::optional<QDateTime> SqlQuery::asDateTime(const QString &value) const
     return std::nullopt;
 }
 
+void SqlQuery::checkIn() noexcept
+{
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    // Nothing to do, the statement isn't cached
+    if (!m_checkIn)
+        return;
+
+    const auto checkIn = std::exchange(m_checkIn, nullptr);
+
+    // The QSqlQuery with the result was moved out of this SqlQuery
+    if (isMovedFrom(*this))
+        return;
+
+    try {
+        checkIn(std::move(static_cast<QSqlQuery &>(*this)));
+    }
+    catch (...) {} // NOLINT(bugprone-empty-catch)
+#else
+    /* Qt v5 doesn't have the QSqlQuery's move constructor, the QSqlQuery copy shares
+       the result with this SqlQuery, so it can't be determined whether the result
+       is still used; the statement isn't returned and it will be prepared again. */
+    m_checkIn = nullptr;
+#endif
+}
+
 } // namespace Orm::Types
 
 TINYORM_END_COMMON_NAMESPACE
@@ -4,7 +4,10 @@
 #include <QtSql/QSqlDriver>
 #include <QtSql/QSqlQuery>
 
+#include <algorithm>
+
 #include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/types/sqlquery.hpp"
 #include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -82,6 +85,35 @@ int Query::queryResultSize(QSqlQuery &query)
     return size;
 }
 
+int Query::queryResultSizeHint(const QSqlQuery &query)
+{
+    // Don't count rows, containers grow geometrically anyway
+    if (!query.driver()->hasFeature(QSqlDriver::QuerySize))
+        return 0;
+
+    return std::max(0, query.size());
+}
+
+QVector<QSqlRecord> Query::fetchRecords(SqlQuery &query)
+{
+    QVector<QSqlRecord> records;
+
+    if (const auto size = query.size(); size > 0)
+        records.reserve(size);
+
+    while (query.next()) {
+        auto record = query.record();
+
+        // The SqlQuery::value() correctly handles QDateTime's time zone
+        for (int i = 0; i < record.count(); ++i)
+            record.setValue(i, query.value(i));
+
+        records << std::move(record);
+    }
+
+    return records;
+}
+
 } // namespace Orm::Utils
 
 TINYORM_END_COMMON_NAMESPACE
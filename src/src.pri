@@ -6,6 +6,7 @@ extern_constants: \
 sourcesList += \
     $$PWD/orm/basegrammar.cpp \
     $$PWD/orm/concerns/countsqueries.cpp \
+    $$PWD/orm/concerns/detectsconcurrencyerrors.cpp \
     $$PWD/orm/concerns/detectslostconnections.cpp \
     $$PWD/orm/concerns/hasconnectionresolver.cpp \
     $$PWD/orm/concerns/logsqueries.cpp \
@@ -17,14 +18,18 @@ sourcesList += \
     $$PWD/orm/configurations/mysqlconfigurationparser.cpp \
     $$PWD/orm/configurations/postgresconfigurationparser.cpp \
     $$PWD/orm/configurations/sqliteconfigurationparser.cpp \
+    $$PWD/orm/connectors/circuitbreaker.cpp \
     $$PWD/orm/connectors/connectionfactory.cpp \
     $$PWD/orm/connectors/connector.cpp \
+    $$PWD/orm/connectors/hostselector.cpp \
     $$PWD/orm/connectors/mysqlconnector.cpp \
     $$PWD/orm/connectors/postgresconnector.cpp \
     $$PWD/orm/connectors/sqliteconnector.cpp \
     $$PWD/orm/databaseconnection.cpp \
     $$PWD/orm/databasemanager.cpp \
     $$PWD/orm/db.cpp \
+    $$PWD/orm/drivers/libpqdriver.cpp \
+    $$PWD/orm/drivers/sqlite3driver.cpp \
     $$PWD/orm/exceptions/logicerror.cpp \
     $$PWD/orm/exceptions/queryerror.cpp \
     $$PWD/orm/exceptions/runtimeerror.cpp \
@@ -55,6 +60,12 @@ sourcesList += \
     $$PWD/orm/schema/schemabuilder.cpp \
     $$PWD/orm/schema/sqliteschemabuilder.cpp \
     $$PWD/orm/sqliteconnection.cpp \
+    $$PWD/orm/support/asyncquery.cpp \
+    $$PWD/orm/support/connectionpool.cpp \
+    $$PWD/orm/support/keepalivescheduler.cpp \
+    $$PWD/orm/support/querycancelhandle.cpp \
+    $$PWD/orm/support/scattergather.cpp \
+    $$PWD/orm/support/statementcache.cpp \
     $$PWD/orm/types/sqlquery.cpp \
     $$PWD/orm/utils/configuration.cpp \
     $$PWD/orm/utils/fs.cpp \
@@ -99,6 +99,8 @@ win32-msvc:CONFIG(debug, debug|release) {
 only).")
 
     mysql_ping: message("Enable MySQL ping on Orm::MySqlConnection.")
+    libpq_driver: message("Build the native PostgreSQL driver using the libpq.")
+    sqlite3_driver: message("Build the native SQLite driver using the sqlite3.")
 }
 
 # User Configuration
@@ -0,0 +1,203 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/databasemanager.hpp"
+#include "orm/db.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::QSQLITE;
+using Orm::Constants::database_;
+using Orm::Constants::driver_;
+using Orm::Constants::pool_max_size;
+
+using Orm::DatabaseManager;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+#ifdef T_COROUTINES
+namespace
+{
+    /*! Fire-and-forget coroutine used to co_await the async queries. */
+    struct DetachedTask
+    {
+        /*! Coroutine promise type. */
+        struct promise_type // NOLINT(readability-identifier-naming)
+        {
+            DetachedTask get_return_object() const noexcept { return {}; }
+            std::suspend_never initial_suspend() const noexcept { return {}; }
+            std::suspend_never final_suspend() const noexcept { return {}; }
+            void return_void() const noexcept {}
+            void unhandled_exception() const { std::terminate(); }
+        };
+    };
+
+    /*! Results of the async queries collected by the coroutine. */
+    struct AsyncResults
+    {
+        /*! Thread in which the coroutine was resumed. */
+        QThread *resumedThread = nullptr;
+        /*! Result of the scalarAsync(). */
+        QVariant scalar;
+        /*! Result of the selectAsync(). */
+        QVector<QSqlRecord> records;
+        /*! Determine whether the coroutine is done. */
+        bool done = false;
+    };
+
+    /*! Run the async queries and collect their results. */
+    DetachedTask runAsyncQueries(const QString connection, AsyncResults *const results)
+    {
+        results->scalar = co_await Orm::DB::scalarAsync("select 1 + 1", {}, connection);
+
+        results->records = co_await Orm::DB::selectAsync(
+                               "select 1 as one union all select 2", {}, connection);
+
+        results->resumedThread = QThread::currentThread();
+        results->done = true;
+    }
+
+    /*! Run the async query built on the given query builder. */
+    DetachedTask runAsyncBuilderQuery(const std::shared_ptr<Orm::QueryBuilder> query,
+                                      AsyncResults *const results)
+    {
+        results->records = co_await query->getAsync();
+
+        results->resumedThread = QThread::currentThread();
+        results->done = true;
+    }
+} // namespace
+#endif
+
+class tst_AsyncQueries : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void selectAsync_ResumesInAwaitingThread() const;
+    void getAsync_OnPooledConnection() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_AsyncQueries";
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_AsyncQueries::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::SQLITE});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_AsyncQueries::selectAsync_ResumesInAwaitingThread() const
+{
+#ifndef T_COROUTINES
+    QSKIP("C++20 coroutines are not supported by the compiler.", );
+#else
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,   QSQLITE},
+        {database_, QStringLiteral(":memory:")},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    AsyncResults results;
+
+    runAsyncQueries(*connectionName, &results);
+
+    // Queries run in the thread pool, the coroutine is resumed by the event loop
+    QVERIFY(!results.done);
+    QTRY_VERIFY(results.done);
+
+    QCOMPARE(results.resumedThread, QThread::currentThread());
+    QCOMPARE(results.scalar.value<int>(), 2);
+    QCOMPARE(results.records.size(), 2);
+    QCOMPARE(results.records.at(0).value("one").value<int>(), 1);
+    QCOMPARE(results.records.at(1).value("one").value<int>(), 2);
+
+    // Every running query has borrowed a connection from the pool
+    QVERIFY(m_dm->hasConnectionPool(*connectionName));
+    QCOMPARE(m_dm->connectionPoolStats(*connectionName).borrowed,
+             static_cast<std::size_t>(0));
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+#endif
+}
+
+void tst_AsyncQueries::getAsync_OnPooledConnection() const
+{
+#ifndef T_COROUTINES
+    QSKIP("C++20 coroutines are not supported by the compiler.", );
+#else
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,       QSQLITE},
+        {database_,     QStringLiteral(":memory:")},
+        {pool_max_size, 2},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    AsyncResults results;
+
+    {
+        auto pooled = m_dm->acquire(*connectionName);
+
+        // The pooled connection has its own name, it isn't registered in the manager
+        QVERIFY(pooled->getName() != *connectionName);
+        QCOMPARE(pooled->getPoolName(), *connectionName);
+
+        auto query = pooled->query();
+        query->fromRaw("(select 1 as one union all select 2)");
+
+        runAsyncBuilderQuery(query, &results);
+
+        QTRY_VERIFY(results.done);
+    }
+
+    QCOMPARE(results.resumedThread, QThread::currentThread());
+    QCOMPARE(results.records.size(), 2);
+    QCOMPARE(results.records.at(0).value("one").value<int>(), 1);
+    QCOMPARE(results.records.at(1).value("one").value<int>(), 2);
+
+    QCOMPARE(m_dm->connectionPoolStats(*connectionName).borrowed,
+             static_cast<std::size_t>(0));
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+#endif
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_AsyncQueries)
+
+#include "tst_async_queries.moc"
@@ -0,0 +1,150 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/databasemanager.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::QSQLITE;
+using Orm::Constants::database_;
+using Orm::Constants::driver_;
+using Orm::Constants::options_;
+
+using Orm::DatabaseManager;
+using Orm::Exceptions::InvalidArgumentError;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_Batch : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void sqlite_AffectedRows() const;
+    void mysql_MultiStatements() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_Batch";
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_Batch::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::MYSQL, Databases::SQLITE});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkippedAny.arg(TypeUtils::classPureBasename(*this))
+                                           .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_Batch::sqlite_AffectedRows() const
+{
+    // Add new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,   QSQLITE},
+        {database_, QStringLiteral(":memory:")},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    connection.statement("create table counters (id integer primary key, name text)");
+    connection.enableQueryLog();
+
+    const auto affected = m_dm->batch({
+        {"insert into counters (id, name) values (?, ?)", {1, "one"}},
+        {"insert into counters (id, name) values (?, ?)", {2, "two"}},
+        {"update counters set name = ? where id > ?",     {"'?'", 0}},
+        {"delete from counters where id = ?",             {3}},
+    }, *connectionName);
+
+    QCOMPARE(affected, QVector<int>({1, 1, 2, 0}));
+    QCOMPARE(connection.scalar("select count(*) from counters where name = ?", {"'?'"})
+             .value<int>(), 2);
+
+    // Every statement is logged separately
+    const auto queryLog = connection.getQueryLog();
+    QCOMPARE(queryLog->size(), 5);
+    QCOMPARE(queryLog->at(2).query,
+             QStringLiteral("update counters set name = ? where id > ?"));
+    QCOMPARE(queryLog->at(2).boundValues, QVector<QVariant>({"'?'", 0}));
+    QCOMPARE(queryLog->at(2).affected, 2);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+
+void tst_Batch::mysql_MultiStatements() const
+{
+    // Add new database connection
+    const auto connectionName =
+            Databases::createConnectionTempFrom(
+                Databases::MYSQL, {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+                {{options_, QVariantHash {{"CLIENT_MULTI_STATEMENTS", true}}}});
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::MYSQL)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    connection.statement("create temporary table batch_counters "
+                         "(id int primary key, name varchar(32))");
+    connection.enableQueryLog();
+    connection.enableStatementsCounter();
+
+    // Values are escaped by the driver, placeholders inside the strings are kept
+    const auto affected = connection.batch({
+        {"insert into batch_counters (id, name) values (?, ?)", {1, "it's"}},
+        {"insert into batch_counters (id, name) values (?, ?)", {2, "back\\slash"}},
+        {"update batch_counters set name = concat(name, '?') where id > ?", {0}},
+        {"delete from batch_counters where id = ?", {3}},
+    });
+
+    QCOMPARE(affected, QVector<int>({1, 1, 2, 0}));
+    QCOMPARE(connection.getStatementsCounter().affecting, 4);
+    QCOMPARE(connection.getQueryLog()->size(), 4);
+    QCOMPARE(connection.scalar("select name from batch_counters where id = ?", {1})
+             .value<QString>(),
+             QStringLiteral("it's?"));
+    QCOMPARE(connection.scalar("select name from batch_counters where id = ?", {2})
+             .value<QString>(),
+             QStringLiteral("back\\slash?"));
+
+    // The number of placeholders has to match the number of bindings
+    QVERIFY_EXCEPTION_THROWN(
+                connection.batch({{"delete from batch_counters where id = ?", {}},
+                                  {"delete from batch_counters", {1}}}),
+                InvalidArgumentError);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_Batch)
+
+#include "tst_batch.moc"
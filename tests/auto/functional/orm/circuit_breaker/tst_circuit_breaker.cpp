@@ -0,0 +1,176 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include <thread>
+
+#include "orm/connectors/circuitbreaker.hpp"
+#include "orm/databasemanager.hpp"
+#include "orm/exceptions/circuitbreakeropenerror.hpp"
+#include "orm/exceptions/runtimeerror.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::QSQLITE;
+using Orm::Constants::circuit_open_time;
+using Orm::Constants::circuit_threshold;
+using Orm::Constants::database_;
+using Orm::Constants::driver_;
+
+using Orm::Connectors::CircuitBreaker;
+using Orm::Connectors::CircuitBreakerGuard;
+using Orm::Connectors::CircuitState;
+using Orm::DatabaseManager;
+using Orm::Exceptions::CircuitBreakerOpenError;
+using Orm::Exceptions::RuntimeError;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_CircuitBreaker : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void opensAndProbes() const;
+    void unfinishedProbe_Released() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_CircuitBreaker";
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_CircuitBreaker::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::SQLITE});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_CircuitBreaker::opensAndProbes() const
+{
+    // Add new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,           QSQLITE},
+        {database_,         QStringLiteral(":memory:")},
+        {circuit_threshold, 2},
+        {circuit_open_time, 50},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    // The circuit breaker is shared by all connections with the same name
+    const auto &breaker = connection.getCircuitBreaker();
+    QVERIFY(breaker);
+    QCOMPARE(breaker, CircuitBreaker::forConnection(*connectionName,
+                                                    connection.getConfig()));
+
+    // Closed, failures below the threshold
+    breaker->recordFailure();
+    QCOMPARE(breaker->state(), CircuitState::Closed);
+    QCOMPARE(connection.scalar("select 1").value<int>(), 1);
+    QCOMPARE(m_dm->circuitBreakerStats(*connectionName)->consecutiveFailures,
+             static_cast<std::size_t>(0));
+
+    // Open, queries fail fast
+    breaker->recordFailure();
+    breaker->recordFailure();
+    QCOMPARE(breaker->state(), CircuitState::Open);
+    QVERIFY(!breaker->allowsReconnect());
+    QVERIFY_EXCEPTION_THROWN(connection.scalar("select 1"), CircuitBreakerOpenError);
+
+    // Half-open, only one probe is let through
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+
+    breaker->acquire();
+    QCOMPARE(breaker->state(), CircuitState::HalfOpen);
+    QVERIFY_EXCEPTION_THROWN(connection.scalar("select 1"), CircuitBreakerOpenError);
+
+    // The successful probe closes the circuit
+    breaker->recordSuccess();
+    QCOMPARE(breaker->state(), CircuitState::Closed);
+    QCOMPARE(connection.scalar("select 1").value<int>(), 1);
+
+    const auto stats = m_dm->circuitBreakerStats(*connectionName);
+    QVERIFY(stats);
+    QCOMPARE(stats->state, CircuitState::Closed);
+    QCOMPARE(stats->opened, static_cast<std::size_t>(1));
+    QCOMPARE(stats->halfOpened, static_cast<std::size_t>(1));
+    QCOMPARE(stats->closed, static_cast<std::size_t>(1));
+    QCOMPARE(stats->rejected, static_cast<std::size_t>(2));
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+
+    // The circuit breaker was removed with the connection
+    QVERIFY(!m_dm->circuitBreakerStats(*connectionName));
+}
+
+void tst_CircuitBreaker::unfinishedProbe_Released() const
+{
+    CircuitBreaker breaker(QStringLiteral("tinyorm_unfinished_probe"), 1,
+                           std::chrono::milliseconds(50));
+
+    breaker.recordFailure();
+    QCOMPARE(breaker.state(), CircuitState::Open);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+
+    // The probe that never records its result is replaced after the open time
+    QVERIFY(breaker.acquire());
+    QCOMPARE(breaker.state(), CircuitState::HalfOpen);
+    QVERIFY_EXCEPTION_THROWN(breaker.acquire(), CircuitBreakerOpenError);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+
+    // The guard releases the probe that has thrown before its result was recorded
+    try {
+        const CircuitBreakerGuard guard(&breaker);
+
+        QVERIFY_EXCEPTION_THROWN(CircuitBreakerGuard {&breaker},
+                                 CircuitBreakerOpenError);
+
+        throw RuntimeError("The query setup failed.");
+
+    } catch (const RuntimeError &/*unused*/) {}
+
+    QCOMPARE(breaker.state(), CircuitState::HalfOpen);
+
+    // The next query probes immediately and its result closes the circuit
+    {
+        CircuitBreakerGuard guard(&breaker);
+
+        guard.recordSuccess();
+    }
+
+    QCOMPARE(breaker.state(), CircuitState::Closed);
+    QCOMPARE(breaker.stats().halfOpened, static_cast<std::size_t>(1));
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_CircuitBreaker)
+
+#include "tst_circuit_breaker.moc"
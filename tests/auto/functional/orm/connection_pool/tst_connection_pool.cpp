@@ -0,0 +1,220 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/databasemanager.hpp"
+#include "orm/exceptions/connectionpooltimeouterror.hpp"
+#include "orm/exceptions/runtimeerror.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::QSQLITE;
+using Orm::Constants::database_;
+using Orm::Constants::driver_;
+using Orm::Constants::pool_acquire_timeout;
+using Orm::Constants::pool_keepalive_interval;
+using Orm::Constants::pool_max_idle_time;
+using Orm::Constants::pool_max_size;
+
+using Orm::DatabaseManager;
+using Orm::Exceptions::ConnectionPoolTimeoutError;
+using Orm::Exceptions::RuntimeError;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_ConnectionPool : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void acquireAndRelease() const;
+    void acquireTimeout() const;
+    void keepAliveAndReaper() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_ConnectionPool";
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_ConnectionPool::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::SQLITE});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_ConnectionPool::acquireAndRelease() const
+{
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,       QSQLITE},
+        {database_,     QStringLiteral(":memory:")},
+        {pool_max_size, 1},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    QVERIFY(!m_dm->hasConnectionPool(*connectionName));
+
+    QString pooledName;
+    {
+        auto connection = m_dm->acquire(*connectionName);
+
+        QVERIFY(connection);
+        QVERIFY(m_dm->hasConnectionPool(*connectionName));
+
+        pooledName = connection->getName();
+        QCOMPARE(pooledName, QStringLiteral("%1-pool-0").arg(*connectionName));
+
+        connection->statement("create table tbl1 (one varchar(10))");
+        connection->insert("insert into tbl1 values(?)", {"hello!"});
+
+        const auto stats = m_dm->connectionPoolStats(*connectionName);
+        QCOMPARE(stats.size, static_cast<std::size_t>(1));
+        QCOMPARE(stats.borrowed, static_cast<std::size_t>(1));
+        QCOMPARE(stats.idle, static_cast<std::size_t>(0));
+
+        // The pool with a borrowed connection can't be removed
+        QVERIFY_EXCEPTION_THROWN(m_dm->removeConnection(*connectionName),
+                                 RuntimeError);
+        QVERIFY(m_dm->hasConnectionPool(*connectionName));
+    }
+
+    // The same connection has to be returned, the in-memory database is still alive
+    {
+        auto connection = m_dm->acquire(*connectionName);
+
+        QCOMPARE(connection->getName(), pooledName);
+        QCOMPARE(connection->scalar("select one from tbl1").value<QString>(),
+                 QStringLiteral("hello!"));
+    }
+
+    const auto stats = m_dm->connectionPoolStats(*connectionName);
+    QCOMPARE(stats.size, static_cast<std::size_t>(1));
+    QCOMPARE(stats.idle, static_cast<std::size_t>(1));
+    QCOMPARE(stats.borrowed, static_cast<std::size_t>(0));
+    QCOMPARE(stats.acquired, static_cast<std::size_t>(2));
+    QCOMPARE(stats.timeouts, static_cast<std::size_t>(0));
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+
+void tst_ConnectionPool::acquireTimeout() const
+{
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,              QSQLITE},
+        {database_,            QStringLiteral(":memory:")},
+        {pool_max_size,        1},
+        {pool_acquire_timeout, 10},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    {
+        const auto connection = m_dm->acquire(*connectionName);
+
+        QVERIFY_EXCEPTION_THROWN(m_dm->acquire(*connectionName),
+                                 ConnectionPoolTimeoutError);
+    }
+
+    const auto stats = m_dm->connectionPoolStats(*connectionName);
+    QCOMPARE(stats.acquired, static_cast<std::size_t>(1));
+    QCOMPARE(stats.timeouts, static_cast<std::size_t>(1));
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+
+void tst_ConnectionPool::keepAliveAndReaper() const
+{
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,                 QSQLITE},
+        {database_,               QStringLiteral(":memory:")},
+        {pool_max_size,           1},
+        {pool_keepalive_interval, 1},
+        {pool_max_idle_time,      200},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    auto &pool = m_dm->connectionPool(*connectionName);
+
+    // Open the physical connection
+    QCOMPARE(pool.acquire()->scalar("select 1").value<int>(), 1);
+
+    // Idle longer than the keepalive interval, pinged in this thread
+    QThread::msleep(10);
+    m_dm->maintainConnectionPools();
+
+    {
+        const auto stats = pool.stats();
+        QCOMPARE(stats.pings, static_cast<std::size_t>(1));
+        QCOMPARE(stats.reaped, static_cast<std::size_t>(0));
+        QCOMPARE(stats.revived, static_cast<std::size_t>(0));
+        QCOMPARE(stats.failed, static_cast<std::size_t>(0));
+        QCOMPARE(stats.idle, static_cast<std::size_t>(1));
+    }
+
+    // Idle longer than the max. idle time, closed by the background thread
+    QThread::msleep(250);
+    m_dm->startKeepAlive(std::chrono::milliseconds(10));
+    QVERIFY(m_dm->isKeepAliveRunning());
+
+    QTRY_COMPARE(pool.stats().reaped, static_cast<std::size_t>(1));
+
+    m_dm->stopKeepAlive();
+    QVERIFY(!m_dm->isKeepAliveRunning());
+
+    // Reconnects lazily
+    {
+        auto connection = pool.acquire();
+
+        QVERIFY(!connection->isOpen());
+        QCOMPARE(connection->scalar("select 1").value<int>(), 1);
+    }
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_ConnectionPool)
+
+#include "tst_connection_pool.moc"
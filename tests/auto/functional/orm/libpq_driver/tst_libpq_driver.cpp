@@ -0,0 +1,146 @@
+#include <QCoreApplication>
+#include <QtSql/QSqlError>
+#include <QtTest>
+
+#include <cmath>
+
+#include "orm/databasemanager.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::QPSQL;
+using Orm::Constants::libpq_native;
+
+using Orm::DatabaseManager;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_LibpqDriver : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void binaryResultsAndBatch() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_LibpqDriver";
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_LibpqDriver::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::POSTGRESQL});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::POSTGRESQL)
+              .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_LibpqDriver::binaryResultsAndBatch() const
+{
+#ifndef TINYORM_LIBPQ_DRIVER
+    QSKIP("The native libpq driver is not enabled (LIBPQ_DRIVER build option).", );
+#else
+    // Add new database connection
+    const auto connectionName =
+            Databases::createConnectionTempFrom(
+                Databases::POSTGRESQL, {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+                {{libpq_native, true}});
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::POSTGRESQL)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    // The native driver is transparent for the grammars and query processors
+    QCOMPARE(connection.driverName(), QPSQL);
+    QCOMPARE(connection.getQtConnection().driverName(), QStringLiteral("QPSQL_LIBPQ"));
+
+    // Prepared statements return values in the binary format
+    auto query = connection.selectOne(
+                     "select ?::integer as i, ?::bigint as b, ?::bytea as bytes, "
+                     "?::text as t, null::integer as n",
+                     {7, 9'000'000'000LL, QByteArray("\0\1\x7f", 3), "it's"});
+
+    QCOMPARE(query.value("i"), QVariant(7));
+    QCOMPARE(query.value("b"), QVariant(9'000'000'000LL));
+    QCOMPARE(query.value("bytes"), QVariant(QByteArray("\0\1\x7f", 3)));
+    QCOMPARE(query.value("t"), QVariant(QStringLiteral("it's")));
+    QVERIFY(query.isNull("n"));
+
+    // Forward-only cursor is streamed in the single-row mode
+    auto cursor = connection.cursor("select generate_series(1, ?) as id", {100});
+
+    auto expected = 0;
+    while (cursor.next())
+        QCOMPARE(cursor.value("id").value<int>(), ++expected);
+
+    QCOMPARE(expected, 100);
+
+    // The connection is usable after the cursor was partially read
+    auto partial = connection.cursor("select generate_series(1, 100) as id");
+    QVERIFY(partial.next());
+    QCOMPARE(connection.scalar("select 1").value<int>(), 1);
+
+    // The rest of the partially read cursor was discarded and reported
+    QVERIFY(!partial.next());
+    QVERIFY(partial.lastError().isValid());
+    QCOMPARE(partial.lastError().driverText(), QStringLiteral("Query results lost"));
+
+    // Special floating-point values in the text format (unprepared query)
+    auto special = connection.getQtQuery();
+    QVERIFY(special.exec("select 'NaN'::float8, 'Infinity'::float8, "
+                         "'-Infinity'::float8"));
+    QVERIFY(special.next());
+
+    QVERIFY(std::isnan(special.value(0).value<double>()));
+    QCOMPARE(special.value(1).value<double>(), std::numeric_limits<double>::infinity());
+    QCOMPARE(special.value(2).value<double>(), -std::numeric_limits<double>::infinity());
+
+    // Timestamps before the PostgreSQL epoch in the binary format
+    auto beforeEpoch = connection.selectOne(
+                           "select ?::timestamptz as ts",
+                           {QStringLiteral("1999-12-31 23:59:59.9985+00")});
+
+    QCOMPARE(beforeEpoch.value("ts").value<QDateTime>().toUTC(),
+             QDateTime(QDate(1999, 12, 31), QTime(23, 59, 59, 998), Qt::UTC));
+
+    // Batch is sent as one multi-statement query
+    connection.statement("create temporary table batch_counters (id integer primary key)");
+    connection.enableStatementsCounter();
+
+    const auto affected = connection.batch({
+        {"insert into batch_counters (id) values (?), (?)", {1, 2}},
+        {"update batch_counters set id = id + 10"},
+        {"delete from batch_counters where id = ?", {11}},
+    });
+
+    QCOMPARE(affected, QVector<int>({2, 2, 1}));
+    QCOMPARE(connection.getStatementsCounter().affecting, 3);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+#endif
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_LibpqDriver)
+
+#include "tst_libpq_driver.moc"
@@ -0,0 +1,133 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/connectors/hostselector.hpp"
+#include "orm/databasemanager.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::H127001;
+using Orm::Constants::P5432;
+using Orm::Constants::PUBLIC;
+using Orm::Constants::QPSQL;
+using Orm::Constants::UTF8;
+using Orm::Constants::application_name;
+using Orm::Constants::charset_;
+using Orm::Constants::database_;
+using Orm::Constants::driver_;
+using Orm::Constants::host_;
+using Orm::Constants::host_cooldown;
+using Orm::Constants::password_;
+using Orm::Constants::port_;
+using Orm::Constants::search_path;
+using Orm::Constants::username_;
+
+using Orm::Connectors::HostSelector;
+using Orm::DatabaseManager;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_MultipleHosts : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void failedHostCooldown() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_MultipleHosts";
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_MultipleHosts::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::POSTGRESQL});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::POSTGRESQL)
+              .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_MultipleHosts::failedHostCooldown() const
+{
+    const auto invalidHost = QStringLiteral("tinyorm-failover.invalid");
+    const auto host = qEnvironmentVariable("DB_PGSQL_HOST", H127001);
+
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::POSTGRESQL,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,          QPSQL},
+        {application_name, QStringLiteral("TinyORM tests - tst_multiple_hosts")},
+        {host_,            QStringList {invalidHost, host}},
+        {host_cooldown,    60000},
+        {port_,            qEnvironmentVariable("DB_PGSQL_PORT", P5432)},
+        {database_,        qEnvironmentVariable("DB_PGSQL_DATABASE", "")},
+        {search_path,      qEnvironmentVariable("DB_PGSQL_SEARCHPATH", PUBLIC)},
+        {username_,        qEnvironmentVariable("DB_PGSQL_USERNAME",
+                                                QStringLiteral("postgres"))},
+        {password_,        qEnvironmentVariable("DB_PGSQL_PASSWORD", "")},
+        {charset_,         qEnvironmentVariable("DB_PGSQL_CHARSET", UTF8)},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::POSTGRESQL)
+              .toUtf8().constData(), );
+
+    HostSelector::resetHealth();
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    // The invalid host is tried first and it fails
+    connection.connectEagerly();
+
+    QCOMPARE(connection.getRawQtConnection().hostName(), host);
+
+    const auto &config = connection.getConfig();
+    {
+        const auto invalidHealth = HostSelector::health(config, invalidHost);
+        QVERIFY(invalidHealth);
+        QCOMPARE(invalidHealth->failures, static_cast<std::size_t>(1));
+        QVERIFY(invalidHealth->coolingDown);
+
+        const auto health = HostSelector::health(config, host);
+        QVERIFY(health);
+        QCOMPARE(health->successes, static_cast<std::size_t>(1));
+        QVERIFY(health->latency >= 0);
+        QVERIFY(!health->coolingDown);
+    }
+
+    // The invalid host is in the cool-down, so it's tried as the last one
+    m_dm->reconnect(*connectionName).connectEagerly();
+
+    QCOMPARE(HostSelector::health(config, invalidHost)->failures,
+             static_cast<std::size_t>(1));
+    QCOMPARE(HostSelector::health(config, host)->successes,
+             static_cast<std::size_t>(2));
+
+    // Restore
+    HostSelector::resetHealth();
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_MultipleHosts)
+
+#include "tst_multiple_hosts.moc"
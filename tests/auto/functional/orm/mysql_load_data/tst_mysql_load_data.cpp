@@ -0,0 +1,146 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/databasemanager.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/mysqlconnection.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::options_;
+using Orm::Constants::qt_timezone;
+
+using Orm::DatabaseManager;
+using Orm::Exceptions::InvalidArgumentError;
+using Orm::MySqlConnection;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_MySql_LoadData : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void escapingNullsAndTimeZone() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_MySql_LoadData";
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_MySql_LoadData::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::MYSQL});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::MYSQL)
+              .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_MySql_LoadData::escapingNullsAndTimeZone() const
+{
+    // Add new database connection
+    const auto connectionName =
+            Databases::createConnectionTempFrom(
+                Databases::MYSQL, {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+                {{options_,     QVariantHash {{"MYSQL_OPT_LOCAL_INFILE", 1}}},
+                 {qt_timezone,  QVariant::fromValue(Qt::UTC)}});
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::MYSQL)
+              .toUtf8().constData(), );
+
+    auto &connection = dynamic_cast<MySqlConnection &>(m_dm->connection(*connectionName));
+
+    if (!connection.scalar("select @@local_infile").value<bool>())
+        QSKIP("The local_infile is disabled on the MySQL server.", );
+
+    connection.statement("create temporary table load_data_rows "
+                         "(id int primary key, name varchar(32) null, "
+                         "data varbinary(8) null, active tinyint(1), "
+                         "created_at datetime null)");
+
+    const QVector<QString> columns {"id", "name", "data", "active", "created_at"};
+
+    // Converted to the qt_timezone (UTC) before it's written to the file
+    const QDateTime createdAt({2023, 1, 2}, {15, 4, 5}, QTimeZone(7200));
+
+    // Special characters have to be escaped
+    const QVector<QVector<QVariant>> rows {
+        {1, "tab\tnew\nline", QByteArray("\0\\\r", 3), true, createdAt},
+        {2, "back\\slash \\N", {}, false, {}},
+        {3, {}, QByteArray("\x7f", 1), true, createdAt},
+    };
+
+    QCOMPARE(connection.loadData("load_data_rows", columns, rows), 3);
+
+    // Row producer
+    auto id = 3;
+    QCOMPARE(connection.loadData("load_data_rows", columns,
+                                 [&id](QVector<QVariant> &row)
+    {
+        if (id == 6)
+            return false;
+
+        row = {++id, QStringLiteral("row %1").arg(id), {}, false, {}};
+
+        return true;
+    }), 3);
+
+    // Nothing to load
+    QCOMPARE(connection.loadData("load_data_rows", columns,
+                                 QVector<QVector<QVariant>>()),
+             0);
+
+    QCOMPARE(connection.scalar("select count(*) from load_data_rows").value<int>(), 6);
+    QCOMPARE(connection.scalar("select name from load_data_rows where id = ?", {1})
+             .value<QString>(),
+             QStringLiteral("tab\tnew\nline"));
+    QCOMPARE(connection.scalar("select data from load_data_rows where id = ?", {1})
+             .value<QByteArray>(),
+             QByteArray("\0\\\r", 3));
+    QCOMPARE(connection.scalar("select cast(created_at as char) from load_data_rows "
+                               "where id = ?", {1})
+             .value<QString>(),
+             QStringLiteral("2023-01-02 13:04:05"));
+    QCOMPARE(connection.scalar("select name from load_data_rows where id = ?", {2})
+             .value<QString>(),
+             QStringLiteral("back\\slash \\N"));
+    QVERIFY(connection.scalar("select data from load_data_rows where id = ?", {2})
+            .isNull());
+    QVERIFY(connection.scalar("select name from load_data_rows where id = ?", {3})
+            .isNull());
+    QCOMPARE(connection.scalar("select name from load_data_rows where id = ?", {6})
+             .value<QString>(),
+             QStringLiteral("row 6"));
+
+    // The number of values has to match the number of columns
+    QVERIFY_EXCEPTION_THROWN(
+                connection.loadData("load_data_rows", columns,
+                                    QVector<QVector<QVariant>> {{7, "seven"}}),
+                InvalidArgumentError);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_MySql_LoadData)
+
+#include "tst_mysql_load_data.moc"
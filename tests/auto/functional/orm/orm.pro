@@ -1,10 +1,26 @@
 TEMPLATE = subdirs
 
 subdirsList = \
+    async_queries \
+    batch \
+    circuit_breaker \
+    connection_pool \
     databasemanager \
+    libpq_driver \
+    multiple_hosts \
+    mysql_load_data \
     postgresql_connection \
+    postgresql_copy \
     query \
+    read_write_connection \
+    scatter_gather \
     schema \
+    sqlite3_driver \
+    sqlite_pragmas \
+    statement_cache \
+    statement_timeout \
+    transaction_retry \
+    warm_up \
 
 !disable_orm: \
     subdirsList += \
@@ -0,0 +1,166 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/databasemanager.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/exceptions/sqlerror.hpp"
+#include "orm/postgresconnection.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::DatabaseManager;
+using Orm::Exceptions::InvalidArgumentError;
+using Orm::Exceptions::SqlError;
+using Orm::PostgresConnection;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_PostgreSQL_Copy : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void inAndOut() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_PostgreSQL_Copy";
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_PostgreSQL_Copy::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::POSTGRESQL});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::POSTGRESQL)
+              .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_PostgreSQL_Copy::inAndOut() const
+{
+#ifndef TINYORM_LIBPQ_DRIVER
+    QSKIP("The COPY needs the libpq library (LIBPQ_DRIVER build option).", );
+#else
+    // Add new database connection
+    const auto connectionName =
+            Databases::createConnectionTempFrom(
+                Databases::POSTGRESQL, {ClassName, QString::fromUtf8(__func__)}); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::POSTGRESQL)
+              .toUtf8().constData(), );
+
+    auto &connection =
+            dynamic_cast<PostgresConnection &>(m_dm->connection(*connectionName));
+
+    connection.statement("create temporary table copy_rows "
+                         "(id integer primary key, name text null, data bytea null, "
+                         "active boolean not null)");
+    connection.statement("create temporary table copy_rows_clone "
+                         "(like copy_rows)");
+
+    const QVector<QString> columns {"id", "name", "data", "active"};
+
+    // Special characters have to be escaped
+    QCOMPARE(connection.copyIn("copy_rows", columns, {
+                 {1, "tab\tnew\nline \\N", QByteArray("\0\\", 2), true},
+                 {2, {}, {}, false},
+             }),
+             2ULL);
+
+    // Row producer
+    auto id = 2;
+    QCOMPARE(connection.copyIn("copy_rows", columns, [&id](QVector<QVariant> &row)
+    {
+        if (id == 5)
+            return false;
+
+        row = {++id, QStringLiteral("row %1").arg(id), {}, true};
+
+        return true;
+    }), 3ULL);
+
+    // The failed COPY is aborted and the connection can be used again
+    QVERIFY_EXCEPTION_THROWN(
+                connection.copyIn("copy_rows", columns, {{6, "six", {}, true},
+                                                         {1, "duplicate", {}, true}}),
+                SqlError);
+    QVERIFY_EXCEPTION_THROWN(
+                connection.copyIn("copy_rows", columns, {{7, "seven"}}),
+                InvalidArgumentError);
+
+    QCOMPARE(connection.scalar("select count(*) from copy_rows").value<int>(), 5);
+    QCOMPARE(connection.scalar("select data from copy_rows where id = ?", {1})
+             .value<QByteArray>(),
+             QByteArray("\0\\", 2));
+
+    // Values are returned in the text format
+    QVector<QVector<QVariant>> rows;
+    auto query = connection.table("copy_rows");
+    query->select({"id", "name", "active"}).where("id", "<", 4).orderBy("id");
+
+    QCOMPARE(connection.copyOut(*query, [&rows](QVector<QVariant> &&row)
+    {
+        rows << std::move(row);
+    }), 3ULL);
+
+    QCOMPARE(rows,
+             QVector<QVector<QVariant>>({
+                 {QStringLiteral("1"), QStringLiteral("tab\tnew\nline \\N"),
+                  QStringLiteral("t")},
+                 {QStringLiteral("2"), QVariant(), QStringLiteral("f")},
+                 {QStringLiteral("3"), QStringLiteral("row 3"), QStringLiteral("t")},
+             }));
+
+    // The binary format can be passed through without parsing
+    QByteArray data;
+    QCOMPARE(connection.copyOutRaw("select * from copy_rows where id > ?", {2},
+                                   PostgresConnection::CopyFormat::Binary,
+                                   [&data](const QByteArray &chunk)
+    {
+        data += chunk;
+    }), 3ULL);
+
+    auto sent = false;
+    QCOMPARE(connection.copyInRaw("copy_rows_clone", {},
+                                  PostgresConnection::CopyFormat::Binary,
+                                  [&data, &sent](QByteArray &chunk)
+    {
+        if (std::exchange(sent, true))
+            return false;
+
+        chunk = data;
+
+        return true;
+    }), 3ULL);
+
+    QCOMPARE(connection.scalar("select string_agg(name, ',' order by id) "
+                               "from copy_rows_clone")
+             .value<QString>(),
+             QStringLiteral("row 3,row 4,row 5"));
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+#endif
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_PostgreSQL_Copy)
+
+#include "tst_postgresql_copy.moc"
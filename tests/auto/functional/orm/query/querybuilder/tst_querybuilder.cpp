@@ -50,8 +50,11 @@ private Q_SLOTS:
 
     void first() const;
 
+    void cursor() const;
+
     void pluck() const;
     void pluck_EmptyResult() const;
+    void pluck_SizeHint() const;
     void pluck_QualifiedColumnOrKey() const;
 
     void implode() const;
@@ -285,6 +288,30 @@ void tst_QueryBuilder::first() const
     QCOMPARE(query.value(NAME), QVariant("test2"));
 }
 
+void tst_QueryBuilder::cursor() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto builder = createQuery(connection);
+
+    auto query = builder->from("torrents").orderBy(ID).cursor({ID, NAME});
+
+    QVERIFY(query.isForwardOnly());
+
+    QVector<QVariant> names;
+    while (query.next())
+        names << query.value(NAME);
+
+    QVector<QVariant> expected {
+        "test1", "test2", "test3", "test4", "test5", "test6",
+    };
+    QCOMPARE(names, expected);
+
+    // The get() method returns the scrollable result for the same query
+    QVERIFY(!createQuery(connection)->from("torrents").orderBy(ID).get({ID, NAME})
+             .isForwardOnly());
+}
+
 void tst_QueryBuilder::pluck() const
 {
     QFETCH_GLOBAL(QString, connection);
@@ -361,6 +388,31 @@ void tst_QueryBuilder::pluck_EmptyResult() const
     }
 }
 
+void tst_QueryBuilder::pluck_SizeHint() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    // The size hint only reserves the result, it doesn't limit it
+    {
+        auto builder = createQuery(connection);
+
+        auto result = builder->from("torrents").orderBy(NAME).sizeHint(2).pluck(NAME);
+
+        QVector<QVariant> expected {
+            "test1", "test2", "test3", "test4", "test5", "test6",
+        };
+        QCOMPARE(result, expected);
+    }
+    {
+        auto builder = createQuery(connection);
+
+        auto result = builder->from("torrents")
+                      .whereEq(NAME, "dummy-NON_EXISTENT").sizeHint(100).pluck(NAME);
+
+        QCOMPARE(result, QVector<QVariant>());
+    }
+}
+
 void tst_QueryBuilder::pluck_QualifiedColumnOrKey() const
 {
     QFETCH_GLOBAL(QString, connection);
@@ -0,0 +1,187 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/databasemanager.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::QSQLITE;
+using Orm::Constants::database_;
+using Orm::Constants::driver_;
+using Orm::Constants::max_replica_lag;
+using Orm::Constants::read_;
+using Orm::Constants::replica_lag_interval;
+using Orm::Constants::sticky;
+
+using Orm::DatabaseManager;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_ReadWriteConnection : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void readWriteConnection_Sticky() const;
+    void readWriteConnection_MaxReplicaLag() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_ReadWriteConnection";
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_ReadWriteConnection::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::SQLITE});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_ReadWriteConnection::readWriteConnection_Sticky() const
+{
+    /* Every SQLite :memory: connection has its own database, so the read and write
+       connections can be distinguished by the data they contain. */
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,   QSQLITE},
+        {database_, QStringLiteral(":memory:")},
+        {read_,     QVariantHash()},
+        {sticky,    true},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    QVERIFY(connection.hasReadConnection());
+
+    // Prepare the read connection
+    {
+        auto readConnection = connection.getReadQtConnection();
+
+        QCOMPARE(readConnection.connectionName(),
+                 QStringLiteral("%1-read").arg(*connectionName));
+
+        QSqlQuery query(readConnection);
+        QVERIFY(query.exec("create table tbl1 (one varchar(10))"));
+        QVERIFY(query.exec("insert into tbl1 values('read')"));
+    }
+
+    // Prepare the write connection
+    connection.statement("create table tbl1 (one varchar(10))");
+    connection.insert("insert into tbl1 values(?)", {"write"});
+
+    // Sticky, records have been modified so the write connection is used
+    QCOMPARE(connection.scalar("select one from tbl1").value<QString>(),
+             QStringLiteral("write"));
+
+    connection.forgetRecordModificationState();
+
+    QCOMPARE(connection.scalar("select one from tbl1").value<QString>(),
+             QStringLiteral("read"));
+    {
+        auto query = connection.selectFromWriteConnection("select one from tbl1");
+
+        QVERIFY(query.first());
+        QCOMPARE(query.value("one").value<QString>(), QStringLiteral("write"));
+    }
+    QCOMPARE(connection.table("tbl1")->useWriteConnection().value("one")
+                       .value<QString>(),
+             QStringLiteral("write"));
+    QCOMPARE(connection.table("tbl1")->lockForUpdate().value("one").value<QString>(),
+             QStringLiteral("write"));
+
+    // Transaction always uses the write connection
+    connection.beginTransaction();
+    QCOMPARE(connection.scalar("select one from tbl1").value<QString>(),
+             QStringLiteral("write"));
+    connection.rollBack();
+
+    QCOMPARE(connection.scalar("select one from tbl1").value<QString>(),
+             QStringLiteral("read"));
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+
+void tst_ReadWriteConnection::readWriteConnection_MaxReplicaLag() const
+{
+    // The SQLite read connection isn't a replica, so it never lags
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,              QSQLITE},
+        {database_,            QStringLiteral(":memory:")},
+        {read_,                QVariantHash()},
+        {max_replica_lag,      2000},
+        {replica_lag_interval, 60000},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    QCOMPARE(connection.getMaxReplicaLag(),
+             std::make_optional(std::chrono::milliseconds(2000)));
+    QCOMPARE(connection.replicaLag(),
+             std::make_optional(std::chrono::milliseconds::zero()));
+
+    // Prepare the read connection
+    {
+        QSqlQuery query(connection.getReadQtConnection());
+        QVERIFY(query.exec("create table tbl1 (one varchar(10))"));
+        QVERIFY(query.exec("insert into tbl1 values('read')"));
+    }
+
+    // Prepare the write connection
+    connection.statement("create table tbl1 (one varchar(10))");
+    connection.insert("insert into tbl1 values(?)", {"write"});
+
+    // The replica isn't lagging, reads are sent to it
+    QCOMPARE(connection.scalar("select one from tbl1").value<QString>(),
+             QStringLiteral("read"));
+    QCOMPARE(connection.table("tbl1")->maxStaleness(std::chrono::milliseconds(0))
+                       .value("one").value<QString>(),
+             QStringLiteral("read"));
+
+    // Reads aren't routed by the replication lag if it's unbounded
+    connection.setMaxReplicaLag(std::nullopt);
+
+    QVERIFY(!connection.getMaxReplicaLag());
+    QCOMPARE(connection.scalar("select one from tbl1").value<QString>(),
+             QStringLiteral("read"));
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_ReadWriteConnection)
+
+#include "tst_read_write_connection.moc"
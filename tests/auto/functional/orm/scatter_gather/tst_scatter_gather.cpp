@@ -0,0 +1,205 @@
+#include <QCoreApplication>
+#include <QtSql/QSqlField>
+#include <QtTest>
+
+#include "orm/databasemanager.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/support/scattergather.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::DESC;
+using Orm::Constants::ID;
+using Orm::Constants::QSQLITE;
+using Orm::Constants::database_;
+using Orm::Constants::driver_;
+
+using Orm::DatabaseManager;
+using Orm::Exceptions::InvalidArgumentError;
+using Orm::Support::ScatterGather;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_ScatterGather : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void onConnections_MergeOrderByAndLimit() const;
+    void mergeSorted_NullsAndUnsignedValues() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_ScatterGather";
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_ScatterGather::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::SQLITE});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_ScatterGather::onConnections_MergeOrderByAndLimit() const
+{
+    // Two shards, every SQLite :memory: connection has its own database
+    const auto shard1 = Databases::createConnectionTemp(
+                            Databases::SQLITE,
+                            {ClassName, QStringLiteral("%1_shard1")
+                                        .arg(QString::fromUtf8(__func__))}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,   QSQLITE},
+        {database_, QStringLiteral(":memory:")},
+    });
+
+    if (!shard1)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    const auto shard2 = Databases::createConnectionTemp(
+                            Databases::SQLITE,
+                            {ClassName, QStringLiteral("%1_shard2")
+                                        .arg(QString::fromUtf8(__func__))}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,   QSQLITE},
+        {database_, QStringLiteral(":memory:")},
+    });
+
+    const QStringList shards {*shard1, *shard2};
+
+    // Raw query, results are concatenated in the order of the connections
+    {
+        const auto records = m_dm->parallel(shards, "select ? as one", {7});
+
+        QCOMPARE(records.size(), 2);
+        QCOMPARE(records.at(0).value("one").value<int>(), 7);
+        QCOMPARE(records.at(1).value("one").value<int>(), 7);
+    }
+
+    // Every shard returns 3, 1, 2 sorted, merged as 1, 1, 2, 2, 3, 3
+    {
+        const auto records =
+                m_dm->query(*shard1)->fromRaw(
+                    "(select 3 as id union all select 1 union all select 2) as t")
+                .orderBy("t.id").offset(1).limit(3).onConnections(shards);
+
+        QCOMPARE(records.size(), 3);
+        QCOMPARE(records.at(0).value("id").value<int>(), 1);
+        QCOMPARE(records.at(1).value("id").value<int>(), 2);
+        QCOMPARE(records.at(2).value("id").value<int>(), 2);
+    }
+
+    // Raw orders can't be merged
+    QVERIFY_EXCEPTION_THROWN(
+                m_dm->query(*shard1)->fromRaw("(select 1 as id) as t")
+                .orderByRaw("id desc").onConnections(shards),
+                InvalidArgumentError);
+
+    // The order by column has to be in the select list
+    QVERIFY_EXCEPTION_THROWN(
+                m_dm->query(*shard1)->fromRaw("(select 1 as id, 2 as votes) as t")
+                .select("id").orderBy("votes").onConnections(shards),
+                InvalidArgumentError);
+
+    // The timeout and the write connection are passed to every connection
+    {
+        auto query = m_dm->query(*shard1);
+        query->fromRaw("(select 1 as id) as t")
+              .useWriteConnection().timeout(std::chrono::milliseconds(5000));
+
+        const auto records = query->onConnections(shards);
+
+        QCOMPARE(records.size(), 2);
+    }
+
+    // Every connection is queried by its own worker thread
+    QVERIFY(ScatterGather::threadPool().maxThreadCount() >= 2);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*shard1));
+    QVERIFY(Databases::removeConnection(*shard2));
+}
+void tst_ScatterGather::mergeSorted_NullsAndUnsignedValues() const
+{
+    const auto records = [](const QVector<QVariant> &values)
+    {
+        QVector<QSqlRecord> result;
+        result.reserve(values.size());
+
+        for (const auto &value : values) {
+            QSqlRecord record;
+            record.append(QSqlField(ID));
+            record.setValue(ID, value);
+
+            result << std::move(record);
+        }
+
+        return result;
+    };
+
+    const auto ids = [](const QVector<QSqlRecord> &merged)
+    {
+        QVector<QVariant> result;
+        result.reserve(merged.size());
+
+        for (const auto &record : merged)
+            result << record.value(ID);
+
+        return result;
+    };
+
+    const auto maxUnsigned = std::numeric_limits<quint64>::max();
+
+    // Unsigned values above INT64_MAX don't wrap, nulls are the smallest
+    {
+        auto merged = ScatterGather::mergeSorted(
+                          {records({QVariant(), QVariant::fromValue(maxUnsigned)}),
+                           records({QVariant(-1), QVariant(2)})},
+                          {{ID}});
+
+        QCOMPARE(ids(merged),
+                 QVector<QVariant>({QVariant(), QVariant(-1), QVariant(2),
+                                    QVariant::fromValue(maxUnsigned)}));
+    }
+
+    // PostgreSQL sorts nulls last in the ascending order and first in the descending
+    {
+        auto merged = ScatterGather::mergeSorted(
+                          {records({QVariant(1), QVariant()}),
+                           records({QVariant(2)})},
+                          {{ID}}, true);
+
+        QCOMPARE(ids(merged), QVector<QVariant>({QVariant(1), QVariant(2), QVariant()}));
+    }
+    {
+        auto merged = ScatterGather::mergeSorted(
+                          {records({QVariant(), QVariant(1)}),
+                           records({QVariant(2)})},
+                          {{ID, DESC}}, true);
+
+        QCOMPARE(ids(merged), QVector<QVariant>({QVariant(), QVariant(2), QVariant(1)}));
+    }
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_ScatterGather)
+
+#include "tst_scatter_gather.moc"
@@ -0,0 +1,177 @@
+#include <QCoreApplication>
+#include <QVersionNumber>
+#include <QtTest>
+
+#include "orm/databasemanager.hpp"
+#ifdef TINYORM_SQLITE3_DRIVER
+#  include "orm/drivers/sqlite3driver.hpp"
+#endif
+#include "orm/exceptions/multiplerecordsfounderror.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::ID;
+using Orm::Constants::QSQLITE;
+using Orm::Constants::database_;
+using Orm::Constants::driver_;
+using Orm::Constants::sqlite3_native;
+
+using Orm::DatabaseManager;
+using Orm::Exceptions::MultipleRecordsFoundError;
+using Orm::Types::SqlQuery;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_SQLite3Driver : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void statementCacheAndTypes() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_SQLite3Driver";
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_SQLite3Driver::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::SQLITE});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_SQLite3Driver::statementCacheAndTypes() const
+{
+#ifndef TINYORM_SQLITE3_DRIVER
+    QSKIP("The native sqlite3 driver is not enabled (SQLITE3_DRIVER build option).", );
+#else
+    // Add new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,        QSQLITE},
+        {database_,      QStringLiteral(":memory:")},
+        {sqlite3_native, true},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    // The native driver is transparent for the grammars and query processors
+    QCOMPARE(connection.driverName(), QSQLITE);
+    QCOMPARE(connection.getQtConnection().driverName(), QStringLiteral("QSQLITE_LIB"));
+
+    const auto *const driver = dynamic_cast<const Orm::Drivers::SQLite3Driver *>(
+                                   connection.getQtConnection().driver());
+    QVERIFY(driver != nullptr);
+
+    connection.statement("create table natives "
+                         "(id integer primary key, amount real, data blob, name text)");
+
+    // Bound values are bound by their type
+    for (auto id = 1; id <= 3; ++id)
+        connection.insert(
+                    "insert into natives (id, amount, data, name) values (?, ?, ?, ?)",
+                    {id, id * 1.5, QByteArray("\0\1", 2),
+                     id == 3 ? QVariant() : QVariant(QStringLiteral("it's"))});
+
+    // The insert was prepared once and taken from the statement cache twice
+    const auto hits = driver->statementCacheHits();
+    QVERIFY(hits >= 2);
+
+    // The statement is returned to the cache when the query is destroyed
+    {
+        auto query = connection.select("select id, amount, data, name from natives "
+                                       "where id >= ? order by id", {1});
+
+        QVERIFY(query.next());
+        QCOMPARE(query.value("id"), QVariant(static_cast<qint64>(1)));
+        QCOMPARE(query.value("amount"), QVariant(1.5));
+        QCOMPARE(query.value("data"), QVariant(QByteArray("\0\1", 2)));
+        QCOMPARE(query.value("name"), QVariant(QStringLiteral("it's")));
+
+        // Moving backward uses the cached rows, the statement isn't re-executed
+        QVERIFY(query.last());
+        QCOMPARE(query.value("id").value<int>(), 3);
+        QVERIFY(query.isNull("name"));
+        QVERIFY(query.first());
+        QCOMPARE(query.value("id").value<int>(), 1);
+    }
+
+    // The same query is served from the statement cache
+    QVERIFY(connection.select("select id, amount, data, name from natives "
+                              "where id >= ? order by id", {3}).next());
+    QVERIFY(driver->statementCacheHits() > hits);
+
+    // The chunk() and sole() count the rows first and then iterate them again
+    QVector<int> ids;
+    QVERIFY(connection.query()->from("natives").orderBy(ID)
+            .chunk(2, [&ids](SqlQuery &query, const int /*unused*/)
+    {
+        while (query.next())
+            ids << query.value(ID).value<int>();
+
+        return true;
+    }));
+    QCOMPARE(ids, QVector<int>({1, 2, 3}));
+
+    auto sole = connection.query()->from("natives").whereEq(ID, 2).sole();
+    QCOMPARE(sole.value(ID).value<int>(), 2);
+
+    QVERIFY_EXCEPTION_THROWN(connection.query()->from("natives").sole(),
+                             MultipleRecordsFoundError);
+
+    // Seeking doesn't repeat the side effects of the RETURNING clause
+    if (QVersionNumber::fromString(
+            connection.scalar("select sqlite_version()").value<QString>()) >=
+        QVersionNumber(3, 35)
+    ) {
+        auto returning = connection.select(
+                             "insert into natives (id, amount) values (?, ?), (?, ?) "
+                             "returning id", {4, 1, 5, 2});
+
+        QVERIFY(returning.last());
+        QCOMPARE(returning.value(ID).value<int>(), 5);
+        QVERIFY(returning.first());
+        QCOMPARE(returning.value(ID).value<int>(), 4);
+
+        QCOMPARE(connection.scalar("select count(*) from natives").value<int>(), 5);
+    }
+
+    const auto [affected, updateQuery] =
+            connection.update("update natives set amount = amount * 2 where id < ?",
+                              {3});
+    QCOMPARE(affected, 2);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+#endif
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_SQLite3Driver)
+
+#include "tst_sqlite3_driver.moc"
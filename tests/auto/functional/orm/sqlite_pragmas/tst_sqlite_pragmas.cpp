@@ -0,0 +1,200 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/databasemanager.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/exceptions/sqlerror.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::EMPTY;
+using Orm::Constants::QSQLITE;
+using Orm::Constants::busy_timeout;
+using Orm::Constants::cache_size;
+using Orm::Constants::check_database_exists;
+using Orm::Constants::database_;
+using Orm::Constants::driver_;
+using Orm::Constants::journal_mode;
+using Orm::Constants::synchronous;
+using Orm::Constants::temp_store;
+using Orm::Constants::wal_readers;
+
+using Orm::DatabaseManager;
+using Orm::Exceptions::InvalidArgumentError;
+using Orm::Exceptions::SqlError;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_SQLite_Pragmas : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void pragmasAndWalReaders() const;
+    void invalidPragma_ThrowsException() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_SQLite_Pragmas";
+
+    /*! Path to the SQLite database file, for testing the 'wal_readers'
+        configuration option. */
+    static const QString &walReadersFile();
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_SQLite_Pragmas::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::SQLITE});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_SQLite_Pragmas::pragmasAndWalReaders() const
+{
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,               QSQLITE},
+        {database_,             walReadersFile()},
+        {check_database_exists, false},
+        {wal_readers,           2},
+        {synchronous,           "normal"},
+        {cache_size,            -4000},
+        {temp_store,            "memory"},
+        {busy_timeout,          2000},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    auto &writer = m_dm->connection(*connectionName);
+
+    // The wal_readers option switches the journal mode to the WAL
+    QCOMPARE(writer.scalar("pragma journal_mode").value<QString>(),
+             QStringLiteral("wal"));
+    QCOMPARE(writer.scalar("pragma synchronous").value<int>(), 1);
+    QCOMPARE(writer.scalar("pragma cache_size").value<int>(), -4000);
+    QCOMPARE(writer.scalar("pragma temp_store").value<int>(), 2);
+    QCOMPARE(writer.scalar("pragma busy_timeout").value<int>(), 2000);
+
+    writer.statement("create table wal_items (id integer primary key, name text)");
+    writer.insert("insert into wal_items (name) values (?)", {"committed"});
+
+    // The reader pool contains the wal_readers read-only readers
+    QCOMPARE(m_dm->readerPool(*connectionName).maxSize(),
+             static_cast<std::size_t>(2));
+
+    // The connection pool stays writable
+    {
+        auto pooled = m_dm->acquire(*connectionName);
+
+        QCOMPARE(pooled->scalar("pragma query_only").value<int>(), 0);
+        QCOMPARE(pooled->scalar("pragma journal_mode").value<QString>(),
+                 QStringLiteral("wal"));
+    }
+
+    writer.beginTransaction();
+    writer.insert("insert into wal_items (name) values (?)", {"uncommitted"});
+
+    {
+        auto reader = m_dm->readerPool(*connectionName).acquire();
+
+        // The reader doesn't wait for the writer's transaction
+        QCOMPARE(reader->scalar("select count(*) from wal_items").value<int>(), 1);
+        QCOMPARE(reader->scalar("pragma query_only").value<int>(), 1);
+
+        QVERIFY_EXCEPTION_THROWN(
+                    reader->insert("insert into wal_items (name) values (?)", {"no"}),
+                    SqlError);
+    }
+
+    writer.commit();
+
+    {
+        auto reader = m_dm->readerPool(*connectionName).acquire();
+
+        QCOMPARE(reader->scalar("select count(*) from wal_items").value<int>(), 2);
+    }
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+
+    // Remove the SQLite database file and the WAL files
+    for (const auto &suffix : {"", "-wal", "-shm"})
+        QFile::remove(walReadersFile() + QString::fromLatin1(suffix));
+
+    QVERIFY(!QFile::exists(walReadersFile()));
+}
+
+void tst_SQLite_Pragmas::invalidPragma_ThrowsException() const
+{
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,       QSQLITE},
+        {database_,     QStringLiteral(":memory:")},
+        {journal_mode,  "wal; drop table users"},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    // Values are interpolated into the PRAGMA query, so they are validated
+    QVERIFY_EXCEPTION_THROWN(m_dm->connection(*connectionName).select("select 1"),
+                             InvalidArgumentError);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+/* private */
+
+const QString &tst_SQLite_Pragmas::walReadersFile()
+{
+    static const auto cached = []() -> QString
+    {
+        auto databasePath = qEnvironmentVariable("DB_SQLITE_DATABASE", EMPTY);
+
+        /* Return EMPTY, the Databases::createConnectionTemp() will check env. variable
+           and QSKIP() will be called if it's undefined. */
+        if (databasePath.isEmpty())
+            return EMPTY;
+
+        databasePath.truncate(QDir::fromNativeSeparators(databasePath)
+                              .lastIndexOf(QChar('/')));
+
+        return databasePath + "/tinyorm_test-wal_readers.sqlite3";
+    }();
+
+    return cached;
+}
+
+QTEST_MAIN(tst_SQLite_Pragmas)
+
+#include "tst_sqlite_pragmas.moc"
@@ -0,0 +1,220 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/databasemanager.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::QSQLITE;
+using Orm::Constants::database_;
+using Orm::Constants::driver_;
+using Orm::Constants::statement_cache_size;
+
+using Orm::DatabaseManager;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_StatementCache : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void hitsMissesAndEvictions() const;
+    void clearedOnDisconnect() const;
+    void busyStatementNotReused() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_StatementCache";
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_StatementCache::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::SQLITE});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_StatementCache::hitsMissesAndEvictions() const
+{
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,              QSQLITE},
+        {database_,            QStringLiteral(":memory:")},
+        {statement_cache_size, 2},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    QCOMPARE(connection.getStatementCacheSize(), static_cast<std::size_t>(2));
+
+    connection.statement("create table tbl1 (one varchar(10))");
+    connection.resetStatementCacheStats();
+
+    const auto insertSql = QStringLiteral("insert into tbl1 values(?)");
+    connection.insert(insertSql, {"one"});
+    connection.insert(insertSql, {"two"});
+
+    // Bindings of the previous execution must not leak to the cached statement
+    QCOMPARE(connection.scalar("select count(*) from tbl1 where one = ?", {"two"})
+                       .value<int>(),
+             1);
+    QCOMPARE(connection.scalar("select count(*) from tbl1 where one = ?", {"one"})
+                       .value<int>(),
+             1);
+
+    {
+        const auto stats = connection.statementCacheStats();
+        QCOMPARE(stats.size, static_cast<std::size_t>(2));
+        QCOMPARE(stats.hits, static_cast<std::size_t>(2));
+        QCOMPARE(stats.misses, static_cast<std::size_t>(2));
+        // The create table statement
+        QCOMPARE(stats.evictions, static_cast<std::size_t>(1));
+    }
+
+    // Evicts the least recently used insert statement
+    QCOMPARE(connection.scalar("select count(*) from tbl1").value<int>(), 2);
+
+    // Has to be prepared again
+    connection.insert(insertSql, {"three"});
+
+    {
+        const auto stats = connection.statementCacheStats();
+        QCOMPARE(stats.size, static_cast<std::size_t>(2));
+        QCOMPARE(stats.hits, static_cast<std::size_t>(2));
+        QCOMPARE(stats.misses, static_cast<std::size_t>(4));
+        QCOMPARE(stats.evictions, static_cast<std::size_t>(3));
+    }
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+
+void tst_StatementCache::clearedOnDisconnect() const
+{
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,              QSQLITE},
+        {database_,            QStringLiteral(":memory:")},
+        {statement_cache_size, 10},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    QCOMPARE(connection.scalar("select 1").value<int>(), 1);
+    QCOMPARE(connection.statementCacheStats().size, static_cast<std::size_t>(1));
+
+    m_dm->disconnect(*connectionName);
+
+    QCOMPARE(connection.statementCacheStats().size, static_cast<std::size_t>(0));
+
+    // Reconnects lazily and prepares the statement again
+    QCOMPARE(connection.scalar("select 1").value<int>(), 1);
+
+    const auto stats = connection.statementCacheStats();
+    QCOMPARE(stats.size, static_cast<std::size_t>(1));
+    QCOMPARE(stats.hits, static_cast<std::size_t>(0));
+    QCOMPARE(stats.misses, static_cast<std::size_t>(2));
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+
+void tst_StatementCache::busyStatementNotReused() const
+{
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,              QSQLITE},
+        {database_,            QStringLiteral(":memory:")},
+        {statement_cache_size, 10},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    connection.statement("create table tbl1 (one varchar(10))");
+    connection.insert("insert into tbl1 values(?)", {"one"});
+    connection.insert("insert into tbl1 values(?)", {"two"});
+    connection.resetStatementCacheStats();
+
+    const auto selectSql = QStringLiteral("select one from tbl1 order by one");
+
+    {
+        auto outer = connection.select(selectSql);
+        QVERIFY(outer.next());
+        QCOMPARE(outer.value(0).value<QString>(), QString("one"));
+
+        {
+            // The same query while the outer result is still being read
+            auto inner = connection.select(selectSql);
+            QVERIFY(inner.next());
+            QCOMPARE(inner.value(0).value<QString>(), QString("one"));
+        }
+
+        // The outer result wasn't reset by the inner query
+        QVERIFY(outer.next());
+        QCOMPARE(outer.value(0).value<QString>(), QString("two"));
+        QVERIFY(!outer.next());
+    }
+
+    {
+        const auto stats = connection.statementCacheStats();
+        QCOMPARE(stats.hits, static_cast<std::size_t>(0));
+        // The outer statement was checked out so the inner one was prepared again
+        QCOMPARE(stats.misses, static_cast<std::size_t>(2));
+        // Both selects were checked in, but only one of them is kept
+        QCOMPARE(stats.size, static_cast<std::size_t>(3));
+    }
+
+    // Served from the cache again
+    QVERIFY(connection.select(selectSql).next());
+    QCOMPARE(connection.statementCacheStats().hits, static_cast<std::size_t>(1));
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_StatementCache)
+
+#include "tst_statement_cache.moc"
@@ -0,0 +1,154 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include <thread>
+
+#include "orm/databasemanager.hpp"
+#include "orm/exceptions/querytimeouterror.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::statement_timeout;
+
+using Orm::DatabaseManager;
+using Orm::Exceptions::QueryCanceledError;
+using Orm::Exceptions::QueryTimeoutError;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_StatementTimeout : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void statementTimeout_PostgreSQL_QueryTimeoutError() const;
+    void cancelHandle_PostgreSQL_QueryCanceledError() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_StatementTimeout";
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_StatementTimeout::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::POSTGRESQL});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::POSTGRESQL)
+              .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_StatementTimeout::statementTimeout_PostgreSQL_QueryTimeoutError() const
+{
+    // Add new database connection
+    const auto connectionName =
+            Databases::createConnectionTempFrom(
+                Databases::POSTGRESQL, {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+                {{statement_timeout, 5000}});
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::POSTGRESQL)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    QCOMPARE(connection.getStatementTimeout(),
+             std::make_optional(std::chrono::milliseconds(5000)));
+    QCOMPARE(connection.scalar("show statement_timeout").value<QString>(),
+             QStringLiteral("5s"));
+
+    // The Builder::timeout() overrides the connection default
+    QVERIFY_EXCEPTION_THROWN(
+                connection.query()->fromRaw("pg_sleep(1)")
+                .timeout(std::chrono::milliseconds(50)).get(),
+                QueryTimeoutError);
+
+    // The connection default is restored before the next query
+    QCOMPARE(connection.scalar("show statement_timeout").value<QString>(),
+             QStringLiteral("5s"));
+
+    // The rollback reverts the SET statement_timeout, it must be re-applied
+    connection.setStatementTimeout(std::chrono::milliseconds(1000));
+
+    connection.beginTransaction();
+    QCOMPARE(connection.scalar("show statement_timeout").value<QString>(),
+             QStringLiteral("1s"));
+    connection.rollBack();
+
+    QCOMPARE(connection.scalar("show statement_timeout").value<QString>(),
+             QStringLiteral("1s"));
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+
+void tst_StatementTimeout::cancelHandle_PostgreSQL_QueryCanceledError() const
+{
+    // Add new database connection
+    const auto connectionName =
+            Databases::createConnectionTempFrom(
+                Databases::POSTGRESQL, {ClassName, QString::fromUtf8(__func__)}); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::POSTGRESQL)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    const auto handle = connection.cancelHandle();
+    QVERIFY(handle.isValid());
+
+    // Cancel the running query from another thread
+    std::thread canceler([&handle]
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+        handle.cancel();
+    });
+
+    try {
+        connection.select("select pg_sleep(5)");
+
+        canceler.join();
+        QFAIL("The query was not canceled.");
+
+    } catch (const QueryTimeoutError &/*unused*/) {
+        canceler.join();
+        QFAIL("The canceled query must not throw the QueryTimeoutError.");
+
+    } catch (const QueryCanceledError &/*unused*/) {
+        canceler.join();
+    }
+
+    // The connection is usable after the cancel
+    QCOMPARE(connection.scalar("select 1").value<int>(), 1);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+
+    // The handle doesn't keep the password of the destroyed connection
+    QVERIFY(handle.isValid());
+    QVERIFY(!handle.cancel());
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_StatementTimeout)
+
+#include "tst_statement_timeout.moc"
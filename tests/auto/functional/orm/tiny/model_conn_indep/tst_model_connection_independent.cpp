@@ -3,6 +3,7 @@
 #include <QtTest>
 
 #include "orm/db.hpp"
+#include "orm/query/grammars/grammar.hpp"
 
 #include "databases.hpp"
 
@@ -105,6 +106,7 @@ private Q_SLOTS:
     /* Eager loading */
     void with_WithSelectConstraint_QueryWithoutRelatedTable() const;
     void with_BelongsToMany_WithSelectConstraint_QualifiedColumnsForRelatedTable() const;
+    void with_ChunkedByMaxBindings() const;
 
     /* Retrieving results */
     void pluck() const;
@@ -960,7 +962,7 @@ void tst_Model_Connection_Independent::
     QCOMPARE(queryLog->at(1).query,
              QString("select `id`, `torrent_id`, `filepath` "
                      "from `torrent_previewable_files` "
-                     "where `torrent_previewable_files`.`torrent_id` in (?)"));
+                     "where `torrent_previewable_files`.`torrent_id` in (2)"));
 }
 
 void tst_Model_Connection_Independent::
@@ -988,7 +990,63 @@ void tst_Model_Connection_Independent::
                  "from `torrent_tags` "
                      "inner join `tag_torrent` "
                          "on `torrent_tags`.`id` = `tag_torrent`.`tag_id` "
-                 "where `tag_torrent`.`torrent_id` in (?)"));
+                 "where `tag_torrent`.`torrent_id` in (3)"));
+}
+
+void tst_Model_Connection_Independent::with_ChunkedByMaxBindings() const
+{
+    auto &grammar = DB::connection(m_connection).getQueryGrammar();
+    const auto maxBindings = grammar.getMaxBindings();
+    /* The user constraint binds three values, so they don't fit with any key
+       and every chunk contains only one parent model. */
+    grammar.setMaxBindings(2);
+
+    // Restore the default, the grammar is shared by all tests
+    auto restoreMaxBindings = qScopeGuard([&grammar, maxBindings]
+    {
+        grammar.setMaxBindings(maxBindings);
+    });
+
+    DB::flushQueryLog(m_connection);
+    DB::enableQueryLog(m_connection);
+    auto torrents = Torrent::with({{"torrentFiles", [](auto &query)
+                                    {
+                                        query.whereNotIn("filepath", {"a", "b"})
+                                             .where("filepath", "!=", "c");
+                                    }}})
+                    ->whereIn(ID, {2, 3}).orderBy(ID).get();
+    DB::disableQueryLog(m_connection);
+
+    // One query for the parent models and one for every chunk
+    const auto queryLog = DB::getQueryLog(m_connection);
+    QCOMPARE(queryLog->size(), 3);
+    QCOMPARE(queryLog->at(1).query,
+             QString("select * from `torrent_previewable_files` "
+                     "where `torrent_previewable_files`.`torrent_id` in (2) "
+                     "and `filepath` not in (?, ?) and `filepath` != ?"));
+    QCOMPARE(queryLog->at(2).query,
+             QString("select * from `torrent_previewable_files` "
+                     "where `torrent_previewable_files`.`torrent_id` in (3) "
+                     "and `filepath` not in (?, ?) and `filepath` != ?"));
+
+    // The merged results are matched to the correct parent models
+    QCOMPARE(torrents.size(), 2);
+
+    const QVector<QVector<QVariant>> expectedFileIds {{2, 3}, {4}};
+
+    for (QVector<Torrent>::size_type index = 0; index < torrents.size(); ++index) {
+        auto &torrent = torrents[index];
+        const auto files = torrent.getRelation<TorrentPreviewableFile>("torrentFiles");
+        const auto &fileIds = expectedFileIds.at(index);
+
+        QCOMPARE(files.size(), fileIds.size());
+
+        for (auto *const file : files) {
+            QVERIFY(file);
+            QCOMPARE(file->getAttribute("torrent_id"), torrent.getAttribute(ID));
+            QVERIFY(fileIds.contains(file->getAttribute(ID)));
+        }
+    }
 }
 
 /* Retrieving results */
@@ -0,0 +1,276 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/db.hpp"
+#include "orm/exceptions/runtimeerror.hpp"
+#include "orm/tiny/model.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::DESC;
+using Orm::Constants::EMPTY;
+using Orm::Constants::ID;
+using Orm::Constants::QSQLITE;
+using Orm::Constants::check_database_exists;
+using Orm::Constants::database_;
+using Orm::Constants::driver_;
+
+using Orm::DB;
+using Orm::Exceptions::RuntimeError;
+using Orm::Tiny::Model;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+namespace
+{
+    // NOLINTNEXTLINE(misc-no-recursion, bugprone-exception-escape)
+    class Order final : public Model<Order>
+    {
+        friend Model;
+        using Model::Model;
+
+    public:
+        /*! Connection names of all shards (created in the initTestCase()). */
+        inline static QStringList u_shards; // clazy:exclude=non-pod-global-static
+
+    private:
+        /*! The table associated with the model. */
+        QString u_table {"orders"};
+
+        /*! Indicates whether the model should be timestamped. */
+        bool u_timestamps = false;
+
+        /*! The shard key column. */
+        inline static const QString u_shardKey {"tenant_id"}; // NOLINT(cppcoreguidelines-interfaces-global-init)
+
+        /*! Even tenants are on the first shard and odd tenants on the second. */
+        inline static const ShardResolver u_shardResolver = // NOLINT(cppcoreguidelines-interfaces-global-init)
+                [](const QVariant &tenantId)
+        {
+            return u_shards.at(tenantId.value<int>() % 2);
+        };
+    };
+} // namespace
+
+class tst_Sharding : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase() const;
+
+    void get_RoutedByShardKey() const;
+    void find_RoutedByShardKey() const;
+    void count_RoutedByShardKey() const;
+
+    void get_OnAllShards_MergedByOrderBy() const;
+    void get_OrWhere_OnAllShards() const;
+    void get_WhereIn_OnAllShards() const;
+
+    void unroutedQuery_ThrowsException() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Get the SQLite database filepath of the given shard. */
+    static QString shardFile(int shard);
+
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_Sharding";
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_Sharding::initTestCase()
+{
+    // Initialize the DatabaseManager, the shards are temporary connections
+    const auto connections = Databases::createConnections({Databases::SQLITE});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    Order::u_shards.clear();
+
+    for (const auto shard : {0, 1}) {
+        const auto connectionName = Databases::createConnectionTemp(
+                                        Databases::SQLITE,
+                                        {ClassName, QStringLiteral("shard%1").arg(shard)},
+        {
+            {driver_,               QSQLITE},
+            {database_,             shardFile(shard)},
+            {check_database_exists, false},
+        });
+
+        if (!connectionName)
+            QSKIP(TestUtils::AutoTestSkipped
+                  .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+                  .toUtf8().constData(), );
+
+        Order::u_shards << *connectionName;
+
+        auto &connection = DB::connection(*connectionName);
+
+        connection.statement("drop table if exists orders");
+        connection.statement("create table orders (id integer primary key, "
+                             "tenant_id integer, total integer)");
+    }
+
+    // Even tenants
+    DB::connection(Order::u_shards.at(0))
+            .insert("insert into orders (id, tenant_id, total) values "
+                    "(1, 2, 10), (2, 4, 30)");
+    // Odd tenants
+    DB::connection(Order::u_shards.at(1))
+            .insert("insert into orders (id, tenant_id, total) values "
+                    "(3, 1, 20), (4, 3, 40)");
+}
+
+void tst_Sharding::cleanupTestCase() const
+{
+    for (const auto &shard : std::as_const(Order::u_shards))
+        QVERIFY(Databases::removeConnection(shard));
+
+    for (const auto shard : {0, 1})
+        QFile::remove(shardFile(shard));
+}
+
+void tst_Sharding::get_RoutedByShardKey() const
+{
+    const auto &shard0 = Order::u_shards.at(0);
+
+    DB::flushQueryLog(shard0);
+    DB::enableQueryLog(shard0);
+    auto orders = Order::whereEq("tenant_id", 3)->get();
+    DB::disableQueryLog(shard0);
+
+    QCOMPARE(orders.size(), 1);
+    QCOMPARE(orders.first().getAttribute(ID).value<int>(), 4);
+    // Hydrated with the shard connection
+    QCOMPARE(orders.first().getConnectionName(), Order::u_shards.at(1));
+
+    // The other shard wasn't queried
+    QVERIFY(DB::getQueryLog(shard0)->isEmpty());
+}
+
+void tst_Sharding::find_RoutedByShardKey() const
+{
+    auto order = Order::whereEq("tenant_id", 4)->find(2);
+
+    QVERIFY(order);
+    QVERIFY(order->exists);
+    QCOMPARE(order->getAttribute("total").value<int>(), 30);
+    QCOMPARE(order->getConnectionName(), Order::u_shards.at(0));
+
+    // Not on the shard of the tenant
+    QVERIFY(!Order::whereEq("tenant_id", 4)->find(3));
+}
+
+void tst_Sharding::count_RoutedByShardKey() const
+{
+    QCOMPARE(Order::whereEq("tenant_id", 2)->count(), static_cast<quint64>(1));
+    QCOMPARE(Order::whereEq("tenant_id", 6)->count(), static_cast<quint64>(0));
+}
+
+void tst_Sharding::get_OnAllShards_MergedByOrderBy() const
+{
+    {
+        auto orders = Order::orderBy("total", DESC)->get();
+
+        QVector<int> totals;
+        QStringList connections;
+
+        for (const auto &order : orders) {
+            totals << order.getAttribute("total").value<int>();
+            connections << order.getConnectionName();
+        }
+
+        QCOMPARE(totals, QVector<int>({40, 30, 20, 10}));
+        // Every model is hydrated with the shard connection it comes from
+        const auto &shard0 = Order::u_shards.at(0);
+        const auto &shard1 = Order::u_shards.at(1);
+        QCOMPARE(connections, QStringList({shard1, shard0, shard1, shard0}));
+    }
+
+    // The limit is applied after the merge
+    {
+        auto orders = Order::orderBy("total")->take(3).get();
+
+        QVector<int> totals;
+        for (const auto &order : orders)
+            totals << order.getAttribute("total").value<int>();
+
+        QCOMPARE(totals, QVector<int>({10, 20, 30}));
+    }
+}
+
+void tst_Sharding::get_OrWhere_OnAllShards() const
+{
+    // The OR can't be routed by the first condition, rows are on both shards
+    auto orders = Order::whereEq("tenant_id", 2)->orWhereEq("tenant_id", 3)
+                  .orderBy(ID).get();
+
+    QVector<int> ids;
+    for (const auto &order : orders)
+        ids << order.getAttribute(ID).value<int>();
+
+    QCOMPARE(ids, QVector<int>({1, 4}));
+}
+
+void tst_Sharding::get_WhereIn_OnAllShards() const
+{
+    auto orders = Order::whereIn("tenant_id", {1, 2})->orderBy(ID).get();
+
+    QVector<int> ids;
+    for (const auto &order : orders)
+        ids << order.getAttribute(ID).value<int>();
+
+    QCOMPARE(ids, QVector<int>({1, 3}));
+}
+
+void tst_Sharding::unroutedQuery_ThrowsException() const
+{
+    QVERIFY_EXCEPTION_THROWN(Order::query()->count(), RuntimeError);
+    QVERIFY_EXCEPTION_THROWN(Order::whereIn("tenant_id", {1, 2})->count(),
+                             RuntimeError);
+    QVERIFY_EXCEPTION_THROWN(
+                Order::whereEq("tenant_id", 1)->orWhereEq("tenant_id", 2)
+                .update({{"total", 0}}),
+                RuntimeError);
+    QVERIFY_EXCEPTION_THROWN(Order::where("total", ">", 0)->remove(), RuntimeError);
+    QVERIFY_EXCEPTION_THROWN(
+                Order::query()->cursor([](Order &&/*unused*/) { return true; }),
+                RuntimeError);
+
+    // Nothing was updated or deleted
+    QCOMPARE(Order::whereEq("tenant_id", 1)->value("total").value<int>(), 20);
+    QCOMPARE(Order::whereEq("tenant_id", 2)->value("total").value<int>(), 10);
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+/* private */
+
+QString tst_Sharding::shardFile(const int shard)
+{
+    auto databasePath = qEnvironmentVariable("DB_SQLITE_DATABASE", EMPTY);
+
+    /* Return EMPTY, the Databases::createConnectionTemp() will check env. variable
+       and QSKIP() will be called if it's undefined. */
+    if (databasePath.isEmpty())
+        return EMPTY;
+
+    databasePath.truncate(QDir::fromNativeSeparators(databasePath)
+                          .lastIndexOf(QChar('/')));
+
+    return QStringLiteral("%1/tinyorm_test-shard_%2.sqlite3").arg(databasePath)
+                                                             .arg(shard);
+}
+
+QTEST_MAIN(tst_Sharding)
+
+#include "tst_sharding.moc"
@@ -8,5 +8,6 @@ SUBDIRS = \
     model_relations \
     relations_conn_indep \
     relations_insrt_updt \
+    sharding \
     softdeletes \
     tinybuilder \
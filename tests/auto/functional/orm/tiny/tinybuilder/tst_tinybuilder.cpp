@@ -9,6 +9,7 @@ using Orm::Constants::ID;
 using Orm::Constants::NAME;
 using Orm::Constants::SIZE;
 
+using Orm::Exceptions::LogicError;
 using Orm::Exceptions::QueryError;
 using Orm::Tiny::ConnectionOverride;
 using Orm::Tiny::Exceptions::ModelNotFoundError;
@@ -31,6 +32,11 @@ private Q_SLOTS:
     void get() const;
     void get_Columns() const;
 
+    void cursor() const;
+    void cursor_Columns() const;
+    void cursor_Stopped() const;
+    void cursor_WithRelations_ThrowsException() const;
+
     void value() const;
     void value_ModelNotFound() const;
 
@@ -107,6 +113,102 @@ void tst_TinyBuilder::get_Columns() const
     QCOMPARE(torrent.getAttributes().at(2).key, QString(SIZE));
 }
 
+void tst_TinyBuilder::cursor() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    QVector<quint64> ids;
+    QStringList names;
+    QStringList connections;
+    QVector<bool> exists;
+    QVector<int> attributesSizes;
+
+    // Every model is hydrated from its row
+    const auto result = Torrent::whereIn(ID, {2, 3, 4})->orderBy(ID)
+                        .cursor([&](Torrent &&torrent)
+    {
+        ids << torrent[ID].value<quint64>();
+        names << torrent[NAME].value<QString>();
+        connections << torrent.getConnectionName();
+        exists << torrent.exists;
+        attributesSizes << static_cast<int>(torrent.getAttributes().size());
+
+        return true;
+    });
+
+    QVERIFY(result);
+    QCOMPARE(ids, QVector<quint64>({2, 3, 4}));
+    QCOMPARE(names, QStringList({"test2", "test3", "test4"}));
+    QCOMPARE(connections, QStringList({connection, connection, connection}));
+    QCOMPARE(exists, QVector<bool>({true, true, true}));
+    QCOMPARE(attributesSizes, QVector<int>({10, 10, 10}));
+}
+
+void tst_TinyBuilder::cursor_Columns() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    QStringList keys;
+
+    const auto callback = [&keys](Torrent &&torrent)
+    {
+        for (const auto &attribute : torrent.getAttributes())
+            keys << attribute.key;
+
+        return true;
+    };
+
+    QVERIFY(Torrent::whereEq(ID, 2)->cursor(callback, {ID, NAME}));
+
+    QCOMPARE(keys, QStringList({ID, NAME}));
+}
+
+void tst_TinyBuilder::cursor_Stopped() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    QVector<quint64> ids;
+
+    const auto result = Torrent::orderBy(ID)->cursor([&ids](Torrent &&torrent)
+    {
+        ids << torrent[ID].value<quint64>();
+
+        // Stop after the second model
+        return ids.size() < 2;
+    });
+
+    QVERIFY(!result);
+    QCOMPARE(ids, QVector<quint64>({1, 2}));
+}
+
+void tst_TinyBuilder::cursor_WithRelations_ThrowsException() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    auto called = false;
+
+    const auto callback = [&called](Torrent &&/*unused*/)
+    {
+        called = true;
+
+        return true;
+    };
+
+    // The eager loading needs all models at once
+    QVERIFY_EXCEPTION_THROWN(Torrent::with("torrentFiles")->cursor(callback),
+                             LogicError);
+
+    QVERIFY(!called);
+}
+
 void tst_TinyBuilder::value() const
 {
     QFETCH_GLOBAL(QString, connection);
@@ -0,0 +1,142 @@
+#include <QCoreApplication>
+#include <QtSql/QSqlError>
+#include <QtTest>
+
+#include "orm/databasemanager.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/exceptions/sqlerror.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::QSQLITE;
+using Orm::Constants::database_;
+using Orm::Constants::driver_;
+
+using Orm::DatabaseManager;
+using Orm::Exceptions::InvalidArgumentError;
+using Orm::Exceptions::SqlError;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_TransactionRetry : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void retriesOnConcurrencyError() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_TransactionRetry";
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_TransactionRetry::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::SQLITE});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_TransactionRetry::retriesOnConcurrencyError() const
+{
+    // Add new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,   QSQLITE},
+        {database_, QStringLiteral(":memory:")},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    connection.statement("create table counters (id integer primary key)");
+    connection.enableStatementsCounter();
+
+    // The serialization failure, PostgreSQL uses the same SQLSTATE
+    const SqlError serializationFailure("Serialization failure.",
+                                        QSqlError("", "", QSqlError::StatementError,
+                                                  QStringLiteral("40001")));
+
+    // Re-run after the serialization failure
+    auto attempts = 0;
+
+    m_dm->transaction([&attempts, &serializationFailure](auto &transaction)
+    {
+        transaction.insert("insert into counters (id) values (?)", {++attempts});
+
+        if (attempts == 1)
+            throw serializationFailure; // NOLINT(cert-err09-cpp,cert-err61-cpp)
+    },
+        3, std::chrono::milliseconds(1), *connectionName);
+
+    QCOMPARE(attempts, 2);
+    QVERIFY(!connection.inTransaction());
+    QCOMPARE(connection.scalar("select count(*) from counters").value<int>(), 1);
+    QCOMPARE(connection.scalar("select id from counters").value<int>(), 2);
+    QCOMPARE(connection.getStatementsCounter().retried, 1);
+
+    // Other errors are never re-run
+    attempts = 0;
+
+    QVERIFY_EXCEPTION_THROWN(
+                m_dm->transaction([&attempts](auto &transaction)
+    {
+        transaction.insert("insert into counters (id) values (?)", {++attempts + 10});
+
+        throw InvalidArgumentError("Failed.");
+    },
+        3, std::chrono::milliseconds(1), *connectionName),
+                InvalidArgumentError);
+
+    QCOMPARE(attempts, 1);
+    QVERIFY(!connection.inTransaction());
+    QCOMPARE(connection.scalar("select count(*) from counters").value<int>(), 1);
+
+    // All attempts failed
+    attempts = 0;
+
+    QVERIFY_EXCEPTION_THROWN(
+                m_dm->transaction([&attempts, &serializationFailure](auto &)
+    {
+        ++attempts;
+
+        throw serializationFailure; // NOLINT(cert-err09-cpp,cert-err61-cpp)
+    },
+        2, std::chrono::milliseconds(1), *connectionName),
+                SqlError);
+
+    QCOMPARE(attempts, 2);
+    QVERIFY(!connection.inTransaction());
+    QCOMPARE(connection.getStatementsCounter().retried, 2);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_TransactionRetry)
+
+#include "tst_transaction_retry.moc"
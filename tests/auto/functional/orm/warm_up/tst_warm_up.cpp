@@ -0,0 +1,160 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/databasemanager.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::EMPTY;
+using Orm::Constants::QSQLITE;
+using Orm::Constants::check_database_exists;
+using Orm::Constants::database_;
+using Orm::Constants::driver_;
+using Orm::Constants::statement_cache_size;
+using Orm::Constants::warm_up_statements;
+
+using Orm::DatabaseManager;
+using Orm::Exceptions::InvalidArgumentError;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_WarmUp : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void connectsConcurrently() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_WarmUp";
+
+    /*! Path to the SQLite database file that doesn't exist, for
+        the connection that fails to warm up. */
+    static const QString &missingDatabaseFile();
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_WarmUp::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::SQLITE});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_WarmUp::connectsConcurrently() const
+{
+    // Add new database connections
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,              QSQLITE},
+        {database_,            QStringLiteral(":memory:")},
+        {statement_cache_size, 10},
+        {warm_up_statements,   QStringList {"select 1", "select 2"}},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    const auto failingName = Databases::createConnectionTemp(
+                                 Databases::SQLITE,
+                                 {ClassName, QStringLiteral("%1_failing")
+                                             .arg(QString::fromUtf8(__func__))}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,               QSQLITE},
+        {database_,             missingDatabaseFile()},
+        {check_database_exists, true},
+    });
+
+    const auto results = m_dm->warmUp({*connectionName, *failingName});
+
+    QCOMPARE(results.size(), 2);
+
+    const auto &warmedUp = results.at(0);
+    QCOMPARE(warmedUp.connection, *connectionName);
+    QVERIFY(warmedUp.connected);
+    QCOMPARE(warmedUp.preparedStatements, static_cast<std::size_t>(2));
+    QVERIFY(warmedUp.error.isEmpty());
+    QVERIFY(warmedUp.elapsed >= 0);
+
+    const auto &failed = results.at(1);
+    QCOMPARE(failed.connection, *failingName);
+    QVERIFY(!failed.connected);
+    QVERIFY(!failed.error.isEmpty());
+
+    // The warmed up connection was handed over to this thread
+    auto &connection = m_dm->connection(*connectionName);
+
+    QVERIFY(connection.isOpen());
+    QCOMPARE(connection.scalar("select 1").value<int>(), 1);
+
+    const auto stats = connection.statementCacheStats();
+    QCOMPARE(stats.hits, static_cast<std::size_t>(1));
+    QCOMPARE(stats.misses, static_cast<std::size_t>(0));
+
+    // The same connection is warmed up only once
+    const auto duplicateResults = m_dm->warmUp({*connectionName, *connectionName});
+
+    QCOMPARE(duplicateResults.size(), 1);
+    QCOMPARE(duplicateResults.constFirst().connection, *connectionName);
+    QVERIFY(duplicateResults.constFirst().connected);
+
+    // An unknown connection name throws before any connection is handed over
+    QVERIFY_EXCEPTION_THROWN(
+                m_dm->warmUp({*connectionName, QStringLiteral("dummy_unknown")}),
+                InvalidArgumentError);
+
+    QCOMPARE(connection.scalar("select 2").value<int>(), 2);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+    QVERIFY(Databases::removeConnection(*failingName));
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+/* private */
+
+const QString &tst_WarmUp::missingDatabaseFile()
+{
+    static const auto cached = []() -> QString
+    {
+        auto databasePath = qEnvironmentVariable("DB_SQLITE_DATABASE", EMPTY);
+
+        /* Return EMPTY, the Databases::createConnectionTemp() will check env. variable
+           and QSKIP() will be called if it's undefined. */
+        if (databasePath.isEmpty())
+            return EMPTY;
+
+        databasePath.truncate(QDir::fromNativeSeparators(databasePath)
+                              .lastIndexOf(QChar('/')));
+
+        return databasePath + "/tinyorm_test-warm_up_missing.sqlite3";
+    }();
+
+    return cached;
+}
+
+QTEST_MAIN(tst_WarmUp)
+
+#include "tst_warm_up.moc"
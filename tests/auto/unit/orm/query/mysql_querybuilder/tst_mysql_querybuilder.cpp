@@ -4,6 +4,7 @@
 #include "orm/db.hpp"
 #include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/mysqlconnection.hpp"
+#include "orm/query/grammars/grammar.hpp"
 #include "orm/utils/type.hpp"
 
 #include "databases.hpp"
@@ -174,6 +175,9 @@ private Q_SLOTS:
     void whereIn_Empty() const;
     void whereNotIn_Empty() const;
     void whereIn_ValueExpression() const;
+    void whereIntegerInRaw() const;
+    void whereIntegerNotInRaw() const;
+    void whereIn_InlinedByMaxBindings() const;
 
     void whereNull() const;
     void whereNotNull() const;
@@ -218,6 +222,7 @@ private Q_SLOTS:
 
     void insert() const;
     void insert_WithExpression() const;
+    void insert_ChunkedByMaxBindings() const;
 
     void update() const;
     void update_WithExpression() const;
@@ -2351,6 +2356,142 @@ void tst_MySql_QueryBuilder::whereIn_ValueExpression() const
     }
 }
 
+void tst_MySql_QueryBuilder::whereIntegerInRaw() const
+{
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereIntegerInRaw(ID, {2, "3", 4U});
+        QCOMPARE(builder->toSql(),
+                 "select * from `torrents` where `id` in (2, 3, 4)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>());
+    }
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereEq(ID, 1)
+                .orWhereIntegerInRaw(ID, {2, {}});
+        QCOMPARE(builder->toSql(),
+                 "select * from `torrents` where `id` = ? or `id` in (2, null)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(1)}));
+    }
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereIntegerInRaw(ID, {});
+        QCOMPARE(builder->toSql(),
+                 "select * from `torrents` where 0 = 1");
+    }
+
+    // Only integer values can be inlined
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery()->from("torrents").whereIntegerInRaw(ID, {"1 or 1 = 1"}),
+                InvalidArgumentError);
+    // Non-integral values aren't truncated
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery()->from("torrents").whereIntegerInRaw(ID, {1, 1.5}),
+                InvalidArgumentError);
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery()->from("torrents").whereIntegerInRaw(ID, {"1.5"}),
+                InvalidArgumentError);
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery()->from("torrents").whereIntegerInRaw(ID, {true}),
+                InvalidArgumentError);
+}
+
+void tst_MySql_QueryBuilder::whereIntegerNotInRaw() const
+{
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereIntegerNotInRaw(ID, {2, 3, 4});
+        QCOMPARE(builder->toSql(),
+                 "select * from `torrents` where `id` not in (2, 3, 4)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>());
+    }
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereEq(ID, 1)
+                .orWhereIntegerNotInRaw(ID, {2, 3});
+        QCOMPARE(builder->toSql(),
+                 "select * from `torrents` where `id` = ? or `id` not in (2, 3)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(1)}));
+    }
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereIntegerNotInRaw(ID, {});
+        QCOMPARE(builder->toSql(),
+                 "select * from `torrents` where 1 = 1");
+    }
+}
+
+void tst_MySql_QueryBuilder::whereIn_InlinedByMaxBindings() const
+{
+    auto &grammar = DB::connection(m_connection).getQueryGrammar();
+    const auto maxBindings = grammar.getMaxBindings();
+    grammar.setMaxBindings(2);
+
+    // Restore the default, the grammar is shared by all tests
+    auto restoreMaxBindings = qScopeGuard([&grammar, maxBindings]
+    {
+        grammar.setMaxBindings(maxBindings);
+    });
+
+    // Integers over the limit are inlined
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereIn(ID, {1, 2, {}})
+                .orWhereNotIn(ID, {4, 5, 6});
+        QCOMPARE(builder->toSql(),
+                 "select * from `torrents` where `id` in (1, 2, null) "
+                 "or `id` not in (4, 5, 6)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>());
+    }
+
+    // Under the limit
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereIn(ID, {1, 2});
+        QCOMPARE(builder->toSql(),
+                 "select * from `torrents` where `id` in (?, ?)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(1), QVariant(2)}));
+    }
+
+    // Other values can't be inlined
+    QVERIFY_EXCEPTION_THROWN(createQuery()->from("torrents")
+                             .whereIn(NAME, {"a", "b", "c"}),
+                             InvalidArgumentError);
+    QVERIFY_EXCEPTION_THROWN(createQuery()->from("torrents")
+                             .whereNotIn(NAME, {"a", 1, "c"}),
+                             InvalidArgumentError);
+
+    // Expressions aren't bound
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents")
+                .whereIn(NAME, {"a", "b", Raw("upper('c')")});
+        QCOMPARE(builder->toSql(),
+                 "select * from `torrents` where `name` in (?, ?, upper('c'))");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant("a"), QVariant("b")}));
+    }
+}
+
 void tst_MySql_QueryBuilder::whereNull() const
 {
     {
@@ -3277,6 +3418,39 @@ void tst_MySql_QueryBuilder::insert_WithExpression() const
              QVector<QVariant>({QVariant(6)}));
 }
 
+void tst_MySql_QueryBuilder::insert_ChunkedByMaxBindings() const
+{
+    auto &grammar = DB::connection(m_connection).getQueryGrammar();
+    const auto maxBindings = grammar.getMaxBindings();
+    // Two rows with two columns per insert statement
+    grammar.setMaxBindings(5);
+
+    // Restore the default, the grammar is shared by all tests
+    auto restoreMaxBindings = qScopeGuard([&grammar, maxBindings]
+    {
+        grammar.setMaxBindings(maxBindings);
+    });
+
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        connection.query()->from("torrents").insert(
+                    {NAME, SIZE}, {{"a", 1}, {"b", 2}, {"c", 3}});
+    });
+
+    QCOMPARE(log.size(), 4);
+    QCOMPARE(log.at(0).query, QString("START TRANSACTION"));
+    QCOMPARE(log.at(1).query,
+             "insert into `torrents` (`name`, `size`) values (?, ?), (?, ?)");
+    QCOMPARE(log.at(1).boundValues,
+             QVector<QVariant>({QVariant("a"), QVariant(1),
+                                QVariant("b"), QVariant(2)}));
+    QCOMPARE(log.at(2).query,
+             "insert into `torrents` (`name`, `size`) values (?, ?)");
+    QCOMPARE(log.at(2).boundValues,
+             QVector<QVariant>({QVariant("c"), QVariant(3)}));
+    QCOMPARE(log.at(3).query, QString("COMMIT"));
+}
+
 void tst_MySql_QueryBuilder::update() const
 {
     auto log = DB::connection(m_connection).pretend([](auto &connection)
@@ -2,6 +2,7 @@
 #include <QtTest>
 
 #include "orm/db.hpp"
+#include "orm/query/grammars/grammar.hpp"
 #include "orm/utils/type.hpp"
 
 #include "databases.hpp"
@@ -105,6 +106,7 @@ private Q_SLOTS:
     void whereIn_Empty() const;
     void whereNotIn_Empty() const;
     void whereIn_ValueExpression() const;
+    void whereIn_ArrayBinding() const;
 
     void whereNull() const;
     void whereNotNull() const;
@@ -1467,6 +1469,64 @@ void tst_PostgreSQL_QueryBuilder::whereIn_ValueExpression() const
     }
 }
 
+void tst_PostgreSQL_QueryBuilder::whereIn_ArrayBinding() const
+{
+    auto &grammar = DB::connection(m_connection).getQueryGrammar();
+    const auto threshold = grammar.getInArrayThreshold();
+    grammar.setInArrayThreshold(3);
+
+    // Restore the threshold, the grammar is shared by all tests
+    auto restoreThreshold = qScopeGuard([&grammar, threshold]
+    {
+        grammar.setInArrayThreshold(threshold);
+    });
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereIn(ID, {2, 3, 4});
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" = any(?)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(QString("{2,3,4}"))}));
+    }
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereEq(ID, 1)
+                .orWhereNotIn(NAME, {"a\"b", {}, "c\\d"});
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" = ? "
+                 "or \"name\" <> all(?)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(1),
+                                    QVariant(QString(R"({"a\"b",NULL,"c\\d"})"))}));
+    }
+
+    // Under the threshold
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereIn(ID, {2, 3});
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" in (?, ?)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(2), QVariant(3)}));
+    }
+
+    // Expressions are never bound as the array
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereIn(ID, {2, 3, Raw(4)});
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" in (?, ?, 4)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(2), QVariant(3)}));
+    }
+}
+
 void tst_PostgreSQL_QueryBuilder::whereNull() const
 {
     {
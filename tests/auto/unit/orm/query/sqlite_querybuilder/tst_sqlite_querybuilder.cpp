@@ -2,6 +2,7 @@
 #include <QtTest>
 
 #include "orm/db.hpp"
+#include "orm/query/grammars/grammar.hpp"
 #include "orm/utils/type.hpp"
 
 #include "databases.hpp"
@@ -104,6 +105,8 @@ private Q_SLOTS:
     void whereIn_Empty() const;
     void whereNotIn_Empty() const;
     void whereIn_ValueExpression() const;
+    void whereIn_ArrayBinding() const;
+    void whereIn_ArrayBinding_DisabledByDefault() const;
 
     void whereNull() const;
     void whereNotNull() const;
@@ -1421,6 +1424,73 @@ void tst_SQLite_QueryBuilder::whereIn_ValueExpression() const
     }
 }
 
+void tst_SQLite_QueryBuilder::whereIn_ArrayBinding() const
+{
+    auto &grammar = DB::connection(m_connection).getQueryGrammar();
+    const auto threshold = grammar.getInArrayThreshold();
+    grammar.setInArrayThreshold(3);
+
+    // Restore the threshold, the grammar is shared by all tests
+    auto restoreThreshold = qScopeGuard([&grammar, threshold]
+    {
+        grammar.setInArrayThreshold(threshold);
+    });
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereIn(ID, {2, 3, 4});
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" in "
+                 "(select value from json_each(?))");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(QString("[2,3,4]"))}));
+    }
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereEq(ID, 1)
+                .orWhereNotIn(NAME, {"a\"b", {}, "c\nd"});
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" = ? "
+                 "or \"name\" not in (select value from json_each(?))");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(1),
+                                    QVariant(QString(R"(["a\"b",null,"c\u000ad"])"))}));
+    }
+
+    // Under the threshold
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereIn(ID, {2, 3});
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" in (?, ?)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(2), QVariant(3)}));
+    }
+}
+
+void tst_SQLite_QueryBuilder::whereIn_ArrayBinding_DisabledByDefault() const
+{
+    // The in_array_threshold configuration option isn't set for the test connection
+    QCOMPARE(DB::connection(m_connection).getQueryGrammar().getInArrayThreshold(),
+             static_cast<std::size_t>(0));
+
+    QVector<QVariant> values;
+    values.reserve(100);
+
+    for (int id = 1; id <= 100; ++id)
+        values << id;
+
+    auto builder = createQuery();
+
+    builder->select("*").from("torrents").whereIn(ID, values);
+    QVERIFY(!builder->toSql().contains(QStringLiteral("json_each")));
+    QCOMPARE(builder->getBindings(), values);
+}
+
 void tst_SQLite_QueryBuilder::whereNull() const
 {
     {
@@ -0,0 +1,129 @@
+#include <QCoreApplication>
+#include <QThreadPool>
+#include <QtSql/QSqlDatabase>
+#include <QtTest>
+
+#include <atomic>
+
+#include "orm/databasemanager.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::QSQLITE;
+using Orm::Constants::database_;
+using Orm::Constants::driver_;
+using Orm::Constants::pool_max_size;
+
+using Orm::DatabaseManager;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_QtConnection : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void getQtConnection_Concurrent_Benchmark_data() const;
+    void getQtConnection_Concurrent_Benchmark() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Test case class name. */
+    inline static const auto *ClassName = "tst_QtConnection";
+
+    /*! The Database Manager used in this test case. */
+    std::shared_ptr<DatabaseManager> m_dm {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_QtConnection::initTestCase()
+{
+    const auto connections = Databases::createConnections({Databases::SQLITE});
+
+    if (connections.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    m_dm = Databases::managerShared();
+}
+
+void tst_QtConnection::getQtConnection_Concurrent_Benchmark_data() const
+{
+    QTest::addColumn<bool>("cached");
+
+    QTest::newRow("cached handle")         << true;
+    QTest::newRow("connection repository") << false;
+}
+
+void tst_QtConnection::getQtConnection_Concurrent_Benchmark() const
+{
+    QFETCH(bool, cached);
+
+    constexpr auto Threads = 8;
+    constexpr auto Iterations = 10000;
+
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,       QSQLITE},
+        {database_,     QStringLiteral(":memory:")},
+        {pool_max_size, Threads},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    // Configurations are thread_local, the pool has to be obtained in this thread
+    auto &pool = m_dm->connectionPool(*connectionName);
+
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(Threads);
+
+    std::atomic<int> closed = 0;
+
+    /* Every thread borrows its own connection and obtains the QSqlDatabase the same
+       way as the query hot path does, the connection repository variant is
+       the QSqlDatabase::database() call that was used before. */
+    QBENCHMARK {
+        for (auto i = 0; i < Threads; ++i)
+            threadPool.start([&pool, &closed, cached]
+            {
+                auto connection = pool.acquire();
+
+                // Open the connection in this thread
+                const auto name = connection->getQtConnection().connectionName();
+
+                for (auto j = 0; j < Iterations; ++j)
+                    if (const auto database = cached
+                                              ? connection->getQtConnection()
+                                              : QSqlDatabase::database(name, true);
+                        !database.isOpen()
+                    )
+                        ++closed;
+            });
+
+        threadPool.waitForDone();
+    }
+
+    QCOMPARE(closed.load(), 0);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_QtConnection)
+
+#include "tst_qtconnection.moc"
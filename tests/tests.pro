@@ -2,9 +2,11 @@ TEMPLATE = subdirs
 
 SUBDIRS = \
     auto \
+    benchmarks \
     TinyUtils \
 
 !disable_tom: \
     SUBDIRS += testdata_tom
 
 auto.depends = TinyUtils
+benchmarks.depends = TinyUtils